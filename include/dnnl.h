@@ -270,6 +270,18 @@ dnnl_status_t DNNL_API dnnl_primitive_get_primitive_desc(
         const_dnnl_primitive_t primitive,
         const_dnnl_primitive_desc_t *primitive_desc);
 
+/// Returns the memory footprint of a primitive: the size of the scratchpad,
+/// the size of the JIT code and the size of the buffers the primitive
+/// allocated at creation. The sizes include the primitives nested into the
+/// primitive. The scratchpad is reported regardless of the scratchpad mode.
+///
+/// @param primitive Primitive to query for the memory footprint.
+/// @param footprint Output memory footprint.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_get_memory_footprint(
+        const_dnnl_primitive_t primitive, dnnl_memory_footprint_t *footprint);
+
 /// Destroys a primitive.
 ///
 /// @param primitive The primitive to destroy.
@@ -1821,6 +1833,31 @@ dnnl_status_t DNNL_API dnnl_softmax_forward_desc_init(
         dnnl_softmax_desc_t *softmax_desc, dnnl_prop_kind_t prop_kind,
         const dnnl_memory_desc_t *data_desc, int softmax_axis);
 
+/// Initializes a descriptor for softmax forward propagation primitive with
+/// a destination of its own and an optional additive mask.
+///
+/// The source is multiplied by the scale set for #DNNL_ARG_SRC with
+/// dnnl_primitive_attr_set_scales() and the mask is added to it before the
+/// softmax. The result is multiplied by the scale set for #DNNL_ARG_DST and
+/// converted to the data type of the destination. The mask is passed as
+/// #DNNL_ARG_SRC_1 at execution.
+///
+/// @param softmax_desc Output descriptor for a softmax primitive.
+/// @param prop_kind Propagation kind. Possible values are
+///     #dnnl_forward_training and #dnnl_forward_inference.
+/// @param src_desc Source memory descriptor.
+/// @param dst_desc Destination memory descriptor.
+/// @param mask_desc Mask memory descriptor. The mask is broadcast along the
+///     dimensions of size 1. May be NULL or a zero memory descriptor if
+///     there is no mask.
+/// @param softmax_axis Axis over which softmax is computed.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_softmax_forward_desc_init_v2(
+        dnnl_softmax_desc_t *softmax_desc, dnnl_prop_kind_t prop_kind,
+        const dnnl_memory_desc_t *src_desc, const dnnl_memory_desc_t *dst_desc,
+        const dnnl_memory_desc_t *mask_desc, int softmax_axis);
+
 /// Initializes a descriptor for softmax backward propagation primitive.
 ///
 /// @param softmax_desc Output descriptor for a softmax primitive.
@@ -2048,6 +2085,42 @@ dnnl_status_t DNNL_API dnnl_layer_normalization_forward_desc_init(
         const dnnl_memory_desc_t *data_desc,
         const dnnl_memory_desc_t *stat_desc, float epsilon, unsigned flags);
 
+/// Initializes a descriptor for layer normalization forward propagation
+/// primitive with a destination of its own, an optional residual and an
+/// optional output of the sum of the source and the residual.
+///
+/// The residual is added to the source before the normalization, so the
+/// statistics are the ones of the sum. The result is multiplied by the output
+/// scale set with dnnl_primitive_attr_set_output_scales() and converted to
+/// the data type of the destination. The residual is passed as
+/// #DNNL_ARG_SRC_1 and the sum as #DNNL_ARG_DST_1 at execution.
+///
+/// @param lnrm_desc Output descriptor for layer normalization primitive.
+/// @param prop_kind Propagation kind. Possible values are
+///     #dnnl_forward_training and #dnnl_forward_inference.
+/// @param src_desc Source memory descriptor.
+/// @param dst_desc Destination memory descriptor.
+/// @param residual_desc Residual memory descriptor. May be NULL or a zero
+///     memory descriptor if there is no residual.
+/// @param sum_desc Memory descriptor of the sum of the source and the
+///     residual. May be NULL or a zero memory descriptor if the sum is not
+///     needed. Requires the residual.
+/// @param stat_desc Memory descriptor for mean and variance. If this
+///     parameter is NULL, a zero memory descriptor, or a memory descriptor
+///     with format_kind set to #dnnl_format_kind_undef, then the memory
+///     descriptor for stats is derived from @p src_desc by removing the last
+///     dimension.
+/// @param epsilon Layer normalization epsilon parameter.
+/// @param flags Layer normalization flags (@ref dnnl_normalization_flags_t).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_layer_normalization_forward_desc_init_v2(
+        dnnl_layer_normalization_desc_t *lnrm_desc, dnnl_prop_kind_t prop_kind,
+        const dnnl_memory_desc_t *src_desc, const dnnl_memory_desc_t *dst_desc,
+        const dnnl_memory_desc_t *residual_desc,
+        const dnnl_memory_desc_t *sum_desc, const dnnl_memory_desc_t *stat_desc,
+        float epsilon, unsigned flags);
+
 /// Initializes a descriptor for a layer normalization backward propagation
 /// primitive.
 ///
@@ -2078,6 +2151,58 @@ dnnl_status_t DNNL_API dnnl_layer_normalization_backward_desc_init(
 
 /// @} dnnl_api_layer_normalization
 
+/// @addtogroup dnnl_api_group_normalization
+/// @{
+
+/// Initializes a descriptor for group normalization forward propagation
+/// primitive.
+///
+/// @note
+///     In-place operation is supported: the dst can refer to the same memory
+///     as the src.
+///
+/// @param gnrm_desc Output descriptor for group normalization primitive.
+/// @param prop_kind Propagation kind. Possible values are
+///     #dnnl_forward_training and #dnnl_forward_inference.
+/// @param data_desc Source and destination memory descriptor.
+/// @param groups The number of groups the channels are split into. Must
+///     divide the number of channels. Instance normalization corresponds to
+///     the number of groups equal to the number of channels.
+/// @param epsilon Group normalization epsilon parameter.
+/// @param flags Group normalization flags (@ref dnnl_normalization_flags_t).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_group_normalization_forward_desc_init(
+        dnnl_group_normalization_desc_t *gnrm_desc, dnnl_prop_kind_t prop_kind,
+        const dnnl_memory_desc_t *data_desc, dnnl_dim_t groups, float epsilon,
+        unsigned flags);
+
+/// Initializes a descriptor for a group normalization backward propagation
+/// primitive.
+///
+/// @note
+///     In-place operation is supported: the diff_dst can refer to the same
+///     memory as the diff_src.
+///
+/// @param gnrm_desc Output descriptor for group normalization primitive.
+/// @param prop_kind Propagation kind. Possible values are
+///     #dnnl_backward_data and #dnnl_backward (diffs for all parameters are
+///     computed in this case).
+/// @param diff_data_desc Diff source and diff destination memory descriptor.
+/// @param data_desc Source memory descriptor.
+/// @param groups The number of groups the channels are split into.
+/// @param epsilon Group normalization epsilon parameter.
+/// @param flags Group normalization flags (@ref dnnl_normalization_flags_t).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_group_normalization_backward_desc_init(
+        dnnl_group_normalization_desc_t *gnrm_desc, dnnl_prop_kind_t prop_kind,
+        const dnnl_memory_desc_t *diff_data_desc,
+        const dnnl_memory_desc_t *data_desc, dnnl_dim_t groups, float epsilon,
+        unsigned flags);
+
+/// @} dnnl_api_group_normalization
+
 /// @addtogroup dnnl_api_inner_product
 /// @{
 
@@ -3363,6 +3488,72 @@ dnnl_status_t DNNL_API dnnl_set_jit_profiling_flags(unsigned flags);
 /// @returns #dnnl_unimplemented/#dnnl::status::unimplemented on Windows.
 dnnl_status_t DNNL_API dnnl_set_jit_profiling_jitdumpdir(const char *dir);
 
+/// Configures sampling of hardware performance counters around every
+/// primitive execution. The increments of the counters of all the threads
+/// that execute the primitive are appended to the verbose output, so the
+/// setting has effect only when verbose output is enabled. The counters are
+/// collected with perf_event_open(2) and are supported for the CPU engine on
+/// Linux only.
+///
+/// @note
+///     This setting overrides the DNNL_PERF_COUNTERS environment variable.
+///
+/// @param enable Flag value. Set to 0 to disable and set to 1 to enable.
+/// @returns #dnnl_unimplemented/#dnnl::status::unimplemented on platforms
+///     other than Linux, and #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_set_perf_counters(int enable);
+
+/// Configures tuning of the implementations at primitive descriptor creation.
+///
+/// By default, a primitive descriptor is created for the first
+/// implementation that supports the operation. In the tuning mode, the first
+/// creation for a problem times all the implementations that support it and
+/// the fastest one is recorded in the tuning file. The subsequent creations,
+/// including the ones in the later runs, use the recorded implementation.
+/// Only the CPU engine is supported. The problem is identified by the
+/// operation descriptor, the attributes and the number of threads.
+///
+/// @note
+///     Tuning executes every implementation several times, which makes the
+///     first creation for a problem significantly slower.
+///     This setting overrides the DNNL_TUNING environment variable.
+///
+/// @param mode Tuning mode:
+///  - 0: no tuning (default),
+///  - 1: tune the problems which are not in the tuning file yet,
+///  - 2: only use the implementations recorded in the tuning file.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p mode value is invalid, and #dnnl_success/#dnnl::status::success on
+///     success.
+dnnl_status_t DNNL_API dnnl_set_primitive_tuning(int mode);
+
+/// Sets the path of the file that keeps the tuning decisions.
+///
+/// @note
+///     This setting overrides the DNNL_TUNING_FILE environment variable. If
+///     the variable is not set and this function is never called, the path
+///     defaults to `dnnl_tuning.csv` in the current directory.
+///
+/// @param path Tuning file path.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p path is NULL, and #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_set_primitive_tuning_file(const char *path);
+
+/// Returns the memory the library currently holds for the primitives: the
+/// library-managed scratchpads, the JIT code and the buffers allocated at
+/// primitive creation, and the maximal total amount held at the same time.
+///
+/// @note
+///     With verbose level 2, the memory footprint of every created primitive
+///     is printed with the scratchpad broken down by the purpose.
+///
+/// @param footprint Output memory footprint.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if
+///     @p footprint is NULL, and #dnnl_success/#dnnl::status::success on
+///     success.
+dnnl_status_t DNNL_API dnnl_get_memory_footprint(
+        dnnl_memory_footprint_t *footprint);
+
 /// Sets the maximal ISA the library can dispatch to on the CPU. See
 /// #dnnl_cpu_isa_t and #dnnl::cpu_isa for the list of the values accepted by
 /// the C and C++ API functions respectively.
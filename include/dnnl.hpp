@@ -272,6 +272,9 @@ struct primitive_desc;
 /// Common operations to create, destroy and inspect primitives
 /// @{
 
+/// @copydoc dnnl_memory_footprint_t
+using memory_footprint_t = dnnl_memory_footprint_t;
+
 /// Base class for all computational primitives.
 struct primitive : public handle<dnnl_primitive_t> {
     /// Kinds of primitives supported by the library.
@@ -314,6 +317,8 @@ struct primitive : public handle<dnnl_primitive_t> {
         matmul = dnnl_matmul,
         /// A resampling primitive.
         resampling = dnnl_resampling,
+        /// A group normalization primitive.
+        group_normalization = dnnl_group_normalization,
     };
 
     using handle::handle;
@@ -342,6 +347,11 @@ struct primitive : public handle<dnnl_primitive_t> {
     /// @returns The primitive kind.
     inline kind get_kind() const;
 
+    /// Returns the memory footprint of the primitive.
+    ///
+    /// @returns The memory footprint.
+    inline memory_footprint_t get_memory_footprint() const;
+
     /// Executes computations specified by the primitive in a specified stream.
     ///
     /// Arguments are passed via an arguments map containing <index,
@@ -373,6 +383,13 @@ const_dnnl_primitive_desc_t primitive::get_primitive_desc() const {
     return pd;
 }
 
+memory_footprint_t primitive::get_memory_footprint() const {
+    memory_footprint_t footprint;
+    error::wrap_c_api(dnnl_primitive_get_memory_footprint(get(), &footprint),
+            "could not get a memory footprint of a primitive");
+    return footprint;
+}
+
 dnnl::primitive::kind primitive::get_kind() const {
     const_dnnl_primitive_desc_t pd = get_primitive_desc();
     // TODO (Roma): the code below is only needed because get_primitive_desc
@@ -784,6 +801,8 @@ enum class query {
     matmul_d = dnnl_query_matmul_d,
     /// resampling descriptor
     resampling_d = dnnl_query_resampling_d,
+    /// group normalization descriptor
+    group_normalization_d = dnnl_query_group_normalization_d,
 
     /// source memory desc
     src_md = dnnl_query_src_md,
@@ -801,6 +820,8 @@ enum class query {
     workspace_md = dnnl_query_workspace_md,
     /// scratchpad memory desc
     scratchpad_md = dnnl_query_scratchpad_md,
+    /// image of a source in the destination memory desc (concat)
+    src_image_md = dnnl_query_src_image_md,
     /// memory desc of an execute argument
     exec_arg_md = dnnl_query_exec_arg_md,
 };
@@ -2914,7 +2935,7 @@ struct primitive_desc_base : public handle<dnnl_primitive_desc_t> {
         std::vector<query> valid_q {query::src_md, query::diff_src_md,
                 query::weights_md, query::diff_weights_md, query::dst_md,
                 query::diff_dst_md, query::workspace_md, query::scratchpad_md,
-                query::exec_arg_md};
+                query::src_image_md, query::exec_arg_md};
         if (!std::any_of(valid_q.cbegin(), valid_q.cend(),
                     [=](query q) { return what == q; }))
             DNNL_THROW_ERROR(dnnl_invalid_arguments,
@@ -3405,6 +3426,21 @@ struct concat : public primitive {
 
         /// @copydoc dnnl::primitive_desc_base::dst_desc()const
         memory::desc dst_desc() const { return base::dst_desc(0); }
+
+        /// Returns a memory descriptor of the image of a source in the
+        /// destination memory.
+        ///
+        /// A producer of the source may write its output directly into the
+        /// destination buffer using this descriptor. When such a memory is
+        /// passed as the source, the concatenation does not copy it.
+        ///
+        /// @param idx Source index.
+        /// @returns Memory descriptor of the image of the source.
+        /// @returns A zero memory descriptor if the implementation cannot
+        ///     place the sources in the destination memory.
+        memory::desc src_image_desc(int idx = 0) const {
+            return query_md(query::src_image_md, idx);
+        }
     };
 
     /// Default constructor. Produces an empty object.
@@ -5718,6 +5754,35 @@ struct softmax_forward : public primitive {
                     "could not create a descriptor for a softmax forward "
                     "propagation primitive");
         }
+
+        /// Constructs a descriptor for a softmax forward propagation
+        /// primitive with a destination of its own and an optional additive
+        /// mask.
+        ///
+        /// The source is multiplied by the scale set for #DNNL_ARG_SRC with
+        /// dnnl::primitive_attr::set_scales() and the mask is added to it
+        /// before the softmax. The result is multiplied by the scale set for
+        /// #DNNL_ARG_DST and converted to the data type of the destination.
+        ///
+        /// @param aprop_kind Propagation kind. Possible values are
+        ///     #dnnl::prop_kind::forward_training, and
+        ///     #dnnl::prop_kind::forward_inference.
+        /// @param src_desc Source memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param softmax_axis Axis over which softmax is computed.
+        /// @param mask_desc Mask memory descriptor. The mask is broadcast
+        ///     along the dimensions of size 1. A zero memory descriptor
+        ///     (default) means no mask.
+        desc(prop_kind aprop_kind, const memory::desc &src_desc,
+                const memory::desc &dst_desc, int softmax_axis,
+                const memory::desc &mask_desc = memory::desc()) {
+            error::wrap_c_api(
+                    dnnl_softmax_forward_desc_init_v2(&data,
+                            dnnl::convert_to_c(aprop_kind), &src_desc.data,
+                            &dst_desc.data, &mask_desc.data, softmax_axis),
+                    "could not create a descriptor for a softmax forward "
+                    "propagation primitive");
+        }
     };
 
     /// Primitive descriptor for a softmax forward propagation primitive.
@@ -5772,6 +5837,12 @@ struct softmax_forward : public primitive {
 
         /// @copydoc dnnl::primitive_desc_base::dst_desc()const
         memory::desc dst_desc() const { return base::dst_desc(0); }
+
+        /// Returns a mask memory descriptor.
+        /// @returns Mask memory descriptor.
+        /// @returns A zero memory descriptor if the primitive does not have
+        ///     a mask.
+        memory::desc mask_desc() const { return base::src_desc(1); }
     };
 
     /// Default constructor. Produces an empty object.
@@ -6442,6 +6513,47 @@ struct layer_normalization_forward : public primitive {
                     "could not create a descriptor for a layer normalization "
                     "forward propagation primitive");
         }
+
+        /// Constructs a descriptor for layer normalization forward
+        /// propagation primitive with a destination of its own, an optional
+        /// residual and an optional output of the sum of the source and the
+        /// residual.
+        ///
+        /// The residual is added to the source before the normalization. The
+        /// result is multiplied by the output scale set with
+        /// dnnl::primitive_attr::set_output_scales() and converted to the
+        /// data type of the destination.
+        ///
+        /// @param aprop_kind Propagation kind. Possible values are
+        ///     #dnnl::prop_kind::forward_training, and
+        ///     #dnnl::prop_kind::forward_inference.
+        /// @param src_desc Source memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param residual_desc Residual memory descriptor. A zero memory
+        ///     descriptor means no residual.
+        /// @param sum_desc Memory descriptor of the sum of the source and the
+        ///     residual. A zero memory descriptor means the sum is not
+        ///     written.
+        /// @param stat_desc Statistics memory descriptors. A zero memory
+        ///     descriptor means the statistics descriptor is derived from
+        ///     @p src_desc.
+        /// @param epsilon Layer normalization epsilon parameter.
+        /// @param flags Layer normalization flags (@ref
+        ///     dnnl::normalization_flags).
+        desc(prop_kind aprop_kind, const memory::desc &src_desc,
+                const memory::desc &dst_desc,
+                const memory::desc &residual_desc,
+                const memory::desc &sum_desc, const memory::desc &stat_desc,
+                float epsilon, normalization_flags flags) {
+            error::wrap_c_api(
+                    dnnl_layer_normalization_forward_desc_init_v2(&data,
+                            dnnl::convert_to_c(aprop_kind), &src_desc.data,
+                            &dst_desc.data, &residual_desc.data,
+                            &sum_desc.data, &stat_desc.data, epsilon,
+                            convert_to_c(flags)),
+                    "could not create a descriptor for a layer normalization "
+                    "forward propagation primitive");
+        }
     };
 
     /// Primitive descriptor for a layer normalization forward propagation
@@ -6511,6 +6623,23 @@ struct layer_normalization_forward : public primitive {
         /// @copydoc dnnl::batch_normalization_forward::primitive_desc::variance_desc()const
         memory::desc variance_desc() const { return stat_desc(var); }
 
+        /// Returns a residual memory descriptor.
+        /// @returns Residual memory descriptor.
+        /// @returns A zero memory descriptor if the primitive does not have
+        ///     a residual.
+        memory::desc residual_desc() const {
+            return query_md(query::exec_arg_md, DNNL_ARG_SRC_1);
+        }
+
+        /// Returns a memory descriptor of the sum of the source and the
+        /// residual.
+        /// @returns Sum memory descriptor.
+        /// @returns A zero memory descriptor if the primitive does not write
+        ///     the sum.
+        memory::desc sum_desc() const {
+            return query_md(query::exec_arg_md, DNNL_ARG_DST_1);
+        }
+
     private:
         enum {
             mean = 1,
@@ -6696,6 +6825,280 @@ struct layer_normalization_backward : public primitive {
 
 /// @} dnnl_api_layer_normalization
 
+/// @addtogroup dnnl_api_group_normalization Group Normalization
+///
+/// A primitive to perform group normalization. The channels are split into
+/// groups of consecutive channels and normalization is performed within
+/// every group of every element of the mini-batch. Instance normalization is
+/// the group normalization with the number of groups equal to the number of
+/// channels.
+///
+/// Both forward and backward propagation primitives support in-place
+/// operation; that is, src and dst can refer to the same memory for forward
+/// propagation, and diff_dst and diff_src can refer to the same memory for
+/// backward propagation.
+///
+/// The group normalization primitives computations can be controlled by
+/// specifying different dnnl::normalization_flags values. For example,
+/// group normalization forward propagation can be configured to either
+/// compute the mean and variance or take them as arguments. It can either
+/// perform scaling and shifting using gamma and beta parameters or not.
+///
+/// @sa @ref dev_guide_group_normalization in developer guide
+///
+/// @{
+
+/// Group normalization forward propagation primitive.
+struct group_normalization_forward : public primitive {
+    /// Descriptor for a group normalization forward propagation primitive.
+    struct desc {
+        dnnl_group_normalization_desc_t data;
+
+        /// Constructs a descriptor for group normalization forward
+        /// propagation primitive.
+        ///
+        /// @param aprop_kind Propagation kind. Possible values are
+        ///     #dnnl::prop_kind::forward_training, and
+        ///     #dnnl::prop_kind::forward_inference.
+        /// @param data_desc Source and destination memory descriptor.
+        /// @param groups The number of groups the channels are split into.
+        /// @param epsilon Group normalization epsilon parameter.
+        /// @param flags Group normalization flags (@ref
+        ///     dnnl::normalization_flags).
+        desc(prop_kind aprop_kind, const memory::desc &data_desc,
+                memory::dim groups, float epsilon, normalization_flags flags) {
+            error::wrap_c_api(
+                    dnnl_group_normalization_forward_desc_init(&data,
+                            dnnl::convert_to_c(aprop_kind), &data_desc.data,
+                            groups, epsilon, convert_to_c(flags)),
+                    "could not create a descriptor for a group normalization "
+                    "forward propagation primitive");
+        }
+    };
+
+    /// Primitive descriptor for a group normalization forward propagation
+    /// primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for a group normalization forward
+        /// propagation primitive.
+        ///
+        /// @param adesc Descriptor for a group normalization forward
+        ///     propagation primitive.
+        /// @param aengine Engine to use.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const desc &adesc, const engine &aengine,
+                bool allow_empty = false)
+            : dnnl::primitive_desc(
+                    &adesc.data, nullptr, aengine, nullptr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for a group normalization forward
+        /// propagation primitive.
+        ///
+        /// @param adesc Descriptor for a group normalization forward
+        ///     propagation primitive.
+        /// @param attr Primitive attributes to use.
+        /// @param aengine Engine to use.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const desc &adesc, const primitive_attr &attr,
+                const engine &aengine, bool allow_empty = false)
+            : dnnl::primitive_desc(
+                    &adesc.data, &attr, aengine, nullptr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for a group normalization
+        /// forward propagation primitive from a C API primitive descriptor
+        /// that must have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for a group normalization
+        ///     forward propagation primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd,
+                    dnnl::primitive::kind::group_normalization,
+                    dnnl::prop_kind::forward_training,
+                    dnnl::prop_kind::forward_inference) {}
+
+        /// @copydoc dnnl::primitive_desc_base::src_desc()const
+        memory::desc src_desc() const { return base::src_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return base::dst_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::weights_desc()const
+        memory::desc weights_desc() const { return base::weights_desc(0); }
+
+        /// @copydoc dnnl::batch_normalization_forward::primitive_desc::mean_desc()const
+        memory::desc mean_desc() const { return stat_desc(mean); }
+
+        /// @copydoc dnnl::batch_normalization_forward::primitive_desc::variance_desc()const
+        memory::desc variance_desc() const { return stat_desc(var); }
+
+    private:
+        enum {
+            mean = 1,
+            var = 2,
+        };
+        memory::desc stat_desc(int kind) const {
+            dnnl_group_normalization_desc_t *p;
+            error::wrap_c_api(
+                    dnnl_primitive_desc_query(get(),
+                            dnnl::convert_to_c(query::group_normalization_d), 0,
+                            &p),
+                    "could not retrieve a descriptor from a primitive "
+                    "descriptor for group normalization forward propagation "
+                    "primitive");
+            return query_md(p->flags & dnnl_use_global_stats ? query::src_md
+                                                             : query::dst_md,
+                    kind);
+        }
+    };
+
+    /// Default constructor. Produces an empty object.
+    group_normalization_forward() = default;
+
+    /// Constructs a group normalization forward propagation primitive.
+    /// @param pd Primitive descriptor for a group normalization forward
+    ///     propagation primitive.
+    group_normalization_forward(const primitive_desc &pd) : primitive(pd) {}
+};
+
+/// Group normalization backward propagation primitive.
+struct group_normalization_backward : public primitive {
+    /// Descriptor for a group normalization backward propagation primitive.
+    struct desc {
+        dnnl_group_normalization_desc_t data;
+
+        /// Constructs a descriptor for group normalization backward
+        /// propagation primitive.
+        ///
+        /// @param aprop_kind Propagation kind. Possible values are
+        ///     #dnnl::prop_kind::backward_data and #dnnl::prop_kind::backward
+        ///     (diffs for all parameters are computed in this case).
+        /// @param diff_data_desc Diff source and diff destination memory
+        ///     descriptor.
+        /// @param data_desc Source memory descriptor.
+        /// @param groups The number of groups the channels are split into.
+        /// @param epsilon Group normalization epsilon parameter.
+        /// @param flags Group normalization flags (@ref
+        ///     dnnl::normalization_flags).
+        desc(prop_kind aprop_kind, const memory::desc &diff_data_desc,
+                const memory::desc &data_desc, memory::dim groups,
+                float epsilon, normalization_flags flags) {
+            error::wrap_c_api(
+                    dnnl_group_normalization_backward_desc_init(&data,
+                            dnnl::convert_to_c(aprop_kind),
+                            &diff_data_desc.data, &data_desc.data, groups,
+                            epsilon, convert_to_c(flags)),
+                    "could not create a descriptor for a group normalization "
+                    "backward propagation primitive");
+        }
+    };
+
+    /// Primitive descriptor for a group normalization backward propagation
+    /// primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for a group normalization backward
+        /// propagation primitive.
+        ///
+        /// @param adesc Descriptor for a group normalization backward
+        ///     propagation primitive.
+        /// @param aengine Engine to use.
+        /// @param hint_fwd_pd Primitive descriptor for a group normalization
+        ///     forward propagation primitive. It is used as a hint for
+        ///     deciding which memory format to use.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const desc &adesc, const engine &aengine,
+                const group_normalization_forward::primitive_desc &hint_fwd_pd,
+                bool allow_empty = false)
+            : dnnl::primitive_desc(&adesc.data, nullptr, aengine,
+                    hint_fwd_pd.get(), allow_empty) {}
+
+        /// Constructs a primitive descriptor for a group normalization backward
+        /// propagation primitive.
+        ///
+        /// @param adesc Descriptor for a group normalization backward
+        ///     propagation primitive.
+        /// @param attr Primitive attributes to use.
+        /// @param aengine Engine to use.
+        /// @param hint_fwd_pd Primitive descriptor for a group normalization
+        ///     forward propagation primitive. It is used as a hint for
+        ///     deciding which memory format to use.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const desc &adesc, const primitive_attr &attr,
+                const engine &aengine,
+                const group_normalization_forward::primitive_desc &hint_fwd_pd,
+                bool allow_empty = false)
+            : dnnl::primitive_desc(&adesc.data, &attr, aengine,
+                    hint_fwd_pd.get(), allow_empty) {}
+
+        /// Constructs a primitive descriptor for a group normalization
+        /// backward propagation primitive from a C API primitive descriptor
+        /// that must have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for a group normalization
+        ///     backward propagation primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd,
+                    dnnl::primitive::kind::group_normalization,
+                    dnnl::prop_kind::backward, dnnl::prop_kind::backward_data) {
+        }
+
+        /// @copydoc dnnl::primitive_desc_base::src_desc()const
+        memory::desc src_desc() const { return base::src_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::weights_desc()const
+        memory::desc weights_desc() const { return base::weights_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return base::dst_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::diff_src_desc()const
+        memory::desc diff_src_desc() const { return base::diff_src_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::diff_dst_desc()const
+        memory::desc diff_dst_desc() const { return base::diff_dst_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::diff_weights_desc()const
+        memory::desc diff_weights_desc() const {
+            return base::diff_weights_desc(0);
+        }
+
+        /// @copydoc dnnl::batch_normalization_forward::primitive_desc::mean_desc()const
+        memory::desc mean_desc() const { return query_md(query::src_md, 1); }
+
+        /// @copydoc dnnl::batch_normalization_forward::primitive_desc::variance_desc()const
+        memory::desc variance_desc() const {
+            return query_md(query::src_md, 2);
+        }
+    };
+
+    /// Default constructor. Produces an empty object.
+    group_normalization_backward() = default;
+
+    /// Constructs a group normalization backward propagation primitive.
+    /// @param pd Primitive descriptor for a group normalization backward
+    ///     propagation primitive.
+    group_normalization_backward(const primitive_desc &pd) : primitive(pd) {}
+};
+
+/// @} dnnl_api_group_normalization
+
 /// @addtogroup dnnl_api_inner_product Inner Product
 ///
 /// A primitive to compute an inner product.
@@ -9917,6 +10320,29 @@ inline status set_jit_profiling_jitdumpdir(const std::string &dir) {
     return static_cast<status>(dnnl_set_jit_profiling_jitdumpdir(dir.c_str()));
 }
 
+/// @copydoc dnnl_set_perf_counters()
+inline status set_perf_counters(int enable) {
+    return static_cast<status>(dnnl_set_perf_counters(enable));
+}
+
+/// @copydoc dnnl_set_primitive_tuning()
+inline status set_primitive_tuning(int mode) {
+    return static_cast<status>(dnnl_set_primitive_tuning(mode));
+}
+
+/// @copydoc dnnl_set_primitive_tuning_file()
+inline status set_primitive_tuning_file(const std::string &path) {
+    return static_cast<status>(dnnl_set_primitive_tuning_file(path.c_str()));
+}
+
+/// @copydoc dnnl_get_memory_footprint()
+inline memory_footprint_t get_memory_footprint() {
+    memory_footprint_t footprint;
+    error::wrap_c_api(dnnl_get_memory_footprint(&footprint),
+            "could not get a memory footprint of the library");
+    return footprint;
+}
+
 /// @copydoc dnnl_cpu_isa_t
 enum class cpu_isa {
     /// @copydoc dnnl_cpu_isa_all
@@ -830,6 +830,8 @@ typedef enum {
     dnnl_matmul,
     /// A resampling primitive.
     dnnl_resampling,
+    /// A group normalization primitive.
+    dnnl_group_normalization,
 
     /// Parameter to allow internal only primitives without undefined behavior.
     /// This parameter is chosen to be valid for so long as sizeof(int) >= 2.
@@ -1122,6 +1124,18 @@ typedef enum {
     dnnl_memory_extra_flag_compensation_conv_s8s8 = 0x1U,
     dnnl_memory_extra_flag_scale_adjust = 0x2U,
     dnnl_memory_extra_flag_gpu_rnn_u8s8_compensation = 0x4U,
+    /// Indicates the weights have an additional buffer, that depends on the
+    /// @p asymm_compensation_mask. The buffer follows the
+    /// #dnnl_memory_extra_flag_compensation_conv_s8s8 one if both are set.
+    ///
+    /// For instance, in 4D case with the compensation mask equals (1 << 0)
+    /// the additional buffer would consist of OC values:
+    /// O[oc : 0,OC] =
+    ///  -SUM(ic : 0,IC; kh : 0,KH; kw : 0,KW){ weights(oc, ic, kh, kw) }
+    ///
+    /// A convolution with a common source zero point zp adds zp * O[oc] to
+    /// the accumulated value of every output channel.
+    dnnl_memory_extra_flag_compensation_conv_asymmetric_src = 0x8U,
 } dnnl_memory_extra_flags_t;
 
 /// Description of extra information stored in memory
@@ -1133,8 +1147,10 @@ typedef struct {
     int compensation_mask;
     /// Scale applied to the data
     float scale_adjust;
+    /// Compensation mask for the asymmetric source zero point
+    int asymm_compensation_mask;
     /// For future backwards compatibility
-    char reserved[64];
+    char reserved[60];
 } dnnl_memory_extra_desc_t;
 
 /// Memory descriptor. The description is based on a number of dimensions,
@@ -1366,6 +1382,12 @@ typedef struct {
     dnnl_memory_desc_t diff_desc;
     /// The axis along which to perform the softmax.
     int softmax_axis;
+    /// Destination memory descriptor of forward propagation. A zero memory
+    /// descriptor means the destination is described by @p data_desc.
+    dnnl_memory_desc_t dst_desc;
+    /// Memory descriptor of the mask added to the source before the softmax
+    /// in forward propagation. A zero memory descriptor means no mask.
+    dnnl_memory_desc_t mask_desc;
 } dnnl_softmax_desc_t;
 
 /// @} dnnl_api_softmax
@@ -1514,10 +1536,58 @@ typedef struct {
     /// Layer normalization epsilon parameter.
     float layer_norm_epsilon;
     unsigned flags;
+    /// Destination memory descriptor of forward propagation. A zero memory
+    /// descriptor means the destination is described by @p data_desc.
+    dnnl_memory_desc_t dst_desc;
+    /// Memory descriptor of the residual added to the source before the
+    /// normalization in forward propagation. A zero memory descriptor means
+    /// no residual.
+    dnnl_memory_desc_t residual_desc;
+    /// Memory descriptor of the sum of the source and the residual written by
+    /// forward propagation. A zero memory descriptor means the sum is not
+    /// written.
+    dnnl_memory_desc_t sum_desc;
 } dnnl_layer_normalization_desc_t;
 
 /// @} dnnl_api_layer_normalization
 
+/// @addtogroup dnnl_api_group_normalization
+/// @{
+
+/// A descriptor of a Group Normalization operation.
+typedef struct {
+    /// The kind of primitive. Used for self-identifying the primitive
+    /// descriptor. Must be #dnnl_group_normalization.
+    dnnl_primitive_kind_t primitive_kind;
+    /// The kind of propagation. Possible values: #dnnl_forward_training,
+    /// #dnnl_forward_inference, #dnnl_backward, and #dnnl_backward_data.
+    dnnl_prop_kind_t prop_kind;
+    /// Source and destination memory descriptor.
+    dnnl_memory_desc_t data_desc;
+    /// Source and destination gradient memory descriptor.
+    dnnl_memory_desc_t diff_data_desc;
+    /// Scale and shift data and gradient memory descriptors.
+    ///
+    /// Scaleshift memory descriptor uses 2D #dnnl_nc format[2,Channels]. 1-st
+    /// dimension contains gamma parameter, 2-nd dimension contains beta
+    /// parameter.
+    dnnl_memory_desc_t data_scaleshift_desc;
+    dnnl_memory_desc_t diff_data_scaleshift_desc;
+    /// Statistics memory descriptor.
+    ///
+    /// Statistics (mean or variance) descriptor uses 2D #dnnl_ab
+    /// format[Batch, Groups].
+    dnnl_memory_desc_t stat_desc;
+    /// The number of groups the channels are split into. The channels of a
+    /// group are consecutive.
+    dnnl_dim_t groups;
+    /// Group normalization epsilon parameter.
+    float group_norm_epsilon;
+    unsigned flags;
+} dnnl_group_normalization_desc_t;
+
+/// @} dnnl_api_group_normalization
+
 /// @addtogroup dnnl_api_inner_product
 /// @{
 
@@ -2138,6 +2208,7 @@ typedef enum {
     dnnl_query_logsoftmax_d, ///< logsoftmax descriptor
     dnnl_query_matmul_d, ///< matrix multiplication (matmul) descriptor
     dnnl_query_resampling_d, ///< resampling descriptor
+    dnnl_query_group_normalization_d, ///< group normalization descriptor
 
     // memory descriptor section
     dnnl_query_some_md = 128, ///< stub
@@ -2149,6 +2220,7 @@ typedef enum {
     dnnl_query_diff_dst_md, ///< destination grad. memory desc
     dnnl_query_workspace_md, ///< workspace memory desc
     dnnl_query_scratchpad_md, ///< scratchpad memory desc
+    dnnl_query_src_image_md, ///< image of a source in the destination (concat)
     dnnl_query_exec_arg_md = 255, ///< memory desc of an execute argument
 
     // Max value to prevent UB for internal use only dnnl_query_t
@@ -2224,6 +2296,23 @@ typedef struct {
     unsigned gpu_runtime; ///< GPU runtime
 } dnnl_version_t;
 
+/// Structure containing the memory footprint of a primitive or of the
+/// library. The sizes are in bytes.
+typedef struct {
+    /// Scratchpad. For the library, the amount of currently allocated
+    /// library-managed scratchpads.
+    size_t scratchpad_size;
+    /// Generated code of JIT kernels
+    size_t jit_code_size;
+    /// Buffers allocated at primitive creation, such as packed weights and
+    /// precomputed tables
+    size_t constant_size;
+    /// For a primitive, the total amount of memory it uses during execution.
+    /// For the library, the maximal total amount of memory allocated at the
+    /// same time.
+    size_t peak_size;
+} dnnl_memory_footprint_t;
+
 /// Disable profiling completely
 #define DNNL_JIT_PROFILE_NONE 0u
 
@@ -597,6 +597,8 @@ const memory_extra_flags_t none = dnnl_memory_extra_flag_none;
 const memory_extra_flags_t compensation_conv_s8s8
         = dnnl_memory_extra_flag_compensation_conv_s8s8;
 const memory_extra_flags_t scale_adjust = dnnl_memory_extra_flag_scale_adjust;
+const memory_extra_flags_t compensation_conv_asymmetric_src
+        = dnnl_memory_extra_flag_compensation_conv_asymmetric_src;
 const memory_extra_flags_t gpu_rnn_u8s8_compensation
         = dnnl_memory_extra_flag_gpu_rnn_u8s8_compensation;
 } // namespace memory_extra_flags
@@ -648,6 +650,7 @@ const primitive_kind_t binary = dnnl_binary;
 const primitive_kind_t logsoftmax = dnnl_logsoftmax;
 const primitive_kind_t matmul = dnnl_matmul;
 const primitive_kind_t resampling = dnnl_resampling;
+const primitive_kind_t group_normalization = dnnl_group_normalization;
 
 // Internal only primitive kinds.
 const primitive_kind_t internal_only_start = (primitive_kind_t)(1 << 12);
@@ -694,6 +697,7 @@ const query_t binary_d = dnnl_query_binary_d;
 const query_t logsoftmax_d = dnnl_query_logsoftmax_d;
 const query_t matmul_d = dnnl_query_matmul_d;
 const query_t resampling_d = dnnl_query_resampling_d;
+const query_t group_normalization_d = dnnl_query_group_normalization_d;
 
 const query_t some_md = dnnl_query_some_md;
 const query_t src_md = dnnl_query_src_md;
@@ -706,6 +710,7 @@ const query_t exec_arg_md = dnnl_query_exec_arg_md;
 
 const query_t workspace_md = dnnl_query_workspace_md;
 const query_t scratchpad_md = dnnl_query_scratchpad_md;
+const query_t src_image_md = dnnl_query_src_image_md;
 
 // Internal only query kinds.
 const query_t internal_only_start = (query_t)(1 << 12);
@@ -731,6 +736,7 @@ using binary_desc_t = dnnl_binary_desc_t;
 using logsoftmax_desc_t = dnnl_logsoftmax_desc_t;
 using matmul_desc_t = dnnl_matmul_desc_t;
 using resampling_desc_t = dnnl_resampling_desc_t;
+using group_normalization_desc_t = dnnl_group_normalization_desc_t;
 
 using rnn_direction_t = dnnl_rnn_direction_t;
 using rnn_desc_t = dnnl_rnn_desc_t;
@@ -769,6 +775,7 @@ struct op_desc_t {
         binary_desc_t binary;
         matmul_desc_t matmul;
         resampling_desc_t resampling;
+        group_normalization_desc_t group_normalization;
         zero_pad_desc_t zero_pad;
     };
 
@@ -798,6 +805,7 @@ struct op_desc_t {
     DECL_CTOR_AND_CONVERTERS(binary_desc_t);
     DECL_CTOR_AND_CONVERTERS(matmul_desc_t);
     DECL_CTOR_AND_CONVERTERS(resampling_desc_t);
+    DECL_CTOR_AND_CONVERTERS(group_normalization_desc_t);
     DECL_CTOR_AND_CONVERTERS(zero_pad_desc_t);
 
     // concat_desc_t and sum_desc_t have data members which have non-trivial
@@ -843,6 +851,9 @@ struct eltwise_bwd_pd_t;
 struct eltwise_fwd_pd_t;
 struct eltwise_pd_t;
 struct gemm_pd_t;
+struct group_normalization_bwd_pd_t;
+struct group_normalization_fwd_pd_t;
+struct group_normalization_pd_t;
 struct inner_product_bwd_data_pd_t;
 struct inner_product_bwd_weights_pd_t;
 struct inner_product_fwd_pd_t;
@@ -86,6 +86,45 @@ struct concat_pd_t : public primitive_desc_t {
         return index < n_inputs() ? &src_image_mds_[index] : &glob_zero_md;
     }
 
+    status_t query(query_t what, int idx, void *result) const override {
+        if (what == query::src_image_md) {
+            // The images in an intermediate memory are of no use for a user
+            if (idx < 0 || idx >= n_inputs() || !src_images_in_dst_)
+                return status::not_required;
+            *(const memory_desc_t **)result = src_image_md(idx);
+            return status::success;
+        }
+        return primitive_desc_t::query(what, idx, result);
+    }
+
+    /* Checks if the source memory is its image in the destination memory,
+     * i.e. the producer of the source wrote it directly into the destination
+     * and there is nothing to copy. The check uses the descriptor of the
+     * memory passed at execution. Fails if the source is placed at its
+     * image, but in a different layout. */
+    status_t src_is_in_place(int index, const memory_desc_t *src_md,
+            const void *src, const void *dst, bool &in_place) const {
+        in_place = false;
+        if (!src_images_in_dst_ || utils::any_null(src_md, src, dst))
+            return status::success;
+
+        const memory_desc_wrapper i_d(src_md);
+        const memory_desc_wrapper o_d(src_image_md(index));
+        const char *i_ptr = (const char *)src
+                + i_d.blk_off(0) * i_d.data_type_size();
+        const char *o_ptr = (const char *)dst
+                + o_d.blk_off(0) * o_d.data_type_size();
+        if (i_ptr != o_ptr) return status::success;
+
+        const bool layout_ok = i_d.data_type() == o_d.data_type()
+                && i_d.is_blocking_desc() && o_d.is_blocking_desc()
+                && types::blocking_desc_is_equal(*i_d.md_, *o_d.md_);
+        if (!layout_ok) return status::invalid_arguments;
+
+        in_place = true;
+        return status::success;
+    }
+
 protected:
     int n_, concat_dim_;
     memory_desc_t dst_md_;
@@ -95,6 +134,9 @@ protected:
      * Lives here to simplify some implementations. An implementation might
      * use this auxiliary array iff init() returned success */
     std::vector<memory_desc_t> src_image_mds_;
+    /* true if src_image_mds_ describe the images in dst_md_ rather than in
+     * an intermediate memory */
+    bool src_images_in_dst_ = false;
 
 protected:
     concat_desc_t desc_;
@@ -114,6 +156,7 @@ protected:
 
         /* work with force_dst_md */
         if (force_dst_md == nullptr) force_dst_md = &dst_md_;
+        src_images_in_dst_ = force_dst_md == &dst_md_;
 
         for (int i = 0; i < n_; ++i) {
             const memory_desc_wrapper i_d(&src_mds_[i]);
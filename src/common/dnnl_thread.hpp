@@ -19,6 +19,7 @@
 
 #include <algorithm>
 
+#include "trace.hpp"
 #include "utils.hpp"
 #include "z_magic.hpp"
 
@@ -42,6 +43,10 @@ inline int dnnl_in_parallel() {
     return omp_in_parallel();
 }
 inline void dnnl_thr_barrier() {
+#if DNNL_TRACE_HOOKS
+    dnnl::impl::trace::scope_t scope(
+            dnnl::impl::trace::barrier, dnnl::impl::trace::current_name());
+#endif
 #pragma omp barrier
 }
 
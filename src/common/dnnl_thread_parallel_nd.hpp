@@ -58,7 +58,7 @@ inline int adjust_num_threads(int nthr, size_t work_amount) {
 
 /* general parallelization */
 template <typename F>
-void parallel(int nthr, F f) {
+void parallel_untraced(int nthr, F f) {
     nthr = adjust_num_threads(nthr, SIZE_MAX);
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_SEQ
     assert(nthr == 1);
@@ -105,6 +105,22 @@ void parallel(int nthr, F f) {
 #endif
 }
 
+template <typename F>
+void parallel(int nthr, F f) {
+#if DNNL_TRACE_HOOKS
+    if (get_trace()) {
+        // The workers do not know which primitive the master executes
+        const char *name = trace::current_name();
+        parallel_untraced(nthr, [&](int ithr, int nthr) {
+            trace::scope_t scope(trace::parallel, name);
+            f(ithr, nthr);
+        });
+        return;
+    }
+#endif
+    parallel_untraced(nthr, f);
+}
+
 /* for_nd section */
 
 template <typename T0, typename F>
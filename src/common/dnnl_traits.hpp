@@ -126,6 +126,7 @@ PKIND_TRAITS_INST(binary);
 PKIND_TRAITS_INST(logsoftmax);
 PKIND_TRAITS_INST(matmul);
 PKIND_TRAITS_INST(resampling);
+PKIND_TRAITS_INST(group_normalization);
 #undef PKIND_TRAITS_INST
 
 } // namespace impl
@@ -0,0 +1,110 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <assert.h>
+#include "dnnl.h"
+
+#include "c_types_map.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::utils;
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::prop_kind;
+using namespace dnnl::impl::types;
+
+namespace {
+status_t gnorm_desc_init(group_normalization_desc_t *gnorm_desc,
+        prop_kind_t prop_kind, const memory_desc_t *data_desc,
+        const memory_desc_t *diff_data_desc, dim_t groups, float epsilon,
+        unsigned flags) {
+    bool args_ok = true && !any_null(gnorm_desc, data_desc)
+            && one_of(prop_kind, forward_training, forward_inference,
+                    backward_data, backward)
+            && 2 <= data_desc->ndims && data_desc->ndims <= 5
+            && IMPLICATION(prop_kind & backward, diff_data_desc != nullptr)
+            && (flags & ~(dnnl_use_global_stats | dnnl_use_scaleshift)) == 0;
+    if (!args_ok) return invalid_arguments;
+
+    const dim_t C = data_desc->dims[1];
+    if (groups <= 0 || C % groups != 0) return invalid_arguments;
+
+    auto gd = group_normalization_desc_t();
+    gd.primitive_kind = primitive_kind::group_normalization;
+    gd.prop_kind = prop_kind;
+
+    bool runtime_dims_or_strides
+            = memory_desc_wrapper(data_desc).has_runtime_dims_or_strides();
+    if (one_of(prop_kind, backward_data, backward))
+        runtime_dims_or_strides = runtime_dims_or_strides
+                || memory_desc_wrapper(diff_data_desc)
+                           .has_runtime_dims_or_strides();
+    if (runtime_dims_or_strides) return unimplemented;
+
+    gd.data_desc = *data_desc;
+    gd.diff_data_desc = zero_md();
+    if (one_of(gd.prop_kind, backward_data, backward))
+        gd.diff_data_desc = *diff_data_desc;
+
+    dims_t scaleshift_dims = {2, C};
+    dnnl_memory_desc_init_by_tag(&gd.data_scaleshift_desc, 2, scaleshift_dims,
+            data_type::f32, dnnl_nc);
+    gd.diff_data_scaleshift_desc = zero_md();
+    if (gd.prop_kind == backward) {
+        gd.diff_data_scaleshift_desc = gd.data_scaleshift_desc;
+    }
+
+    dims_t stats_dims = {data_desc->dims[0], groups};
+    dnnl_memory_desc_init_by_tag(
+            &gd.stat_desc, 2, stats_dims, data_type::f32, dnnl_ab);
+
+    gd.groups = groups;
+    gd.group_norm_epsilon = epsilon;
+    gd.flags = flags;
+
+    if (gd.prop_kind == backward_data) {
+        bool consistency = gd.diff_data_desc.ndims == gd.data_desc.ndims
+                && array_cmp(gd.diff_data_desc.dims, gd.data_desc.dims,
+                        gd.diff_data_desc.ndims);
+        if (!consistency) return invalid_arguments;
+    }
+
+    *gnorm_desc = gd;
+    return success;
+}
+} // namespace
+
+status_t dnnl_group_normalization_forward_desc_init(
+        group_normalization_desc_t *gnorm_desc, prop_kind_t prop_kind,
+        const memory_desc_t *data_desc, dim_t groups, float epsilon,
+        unsigned flags) {
+    if (!one_of(prop_kind, forward_training, forward_inference))
+        return invalid_arguments;
+    return gnorm_desc_init(gnorm_desc, prop_kind, data_desc, nullptr, groups,
+            epsilon, flags);
+}
+
+status_t dnnl_group_normalization_backward_desc_init(
+        group_normalization_desc_t *gnorm_desc, prop_kind_t prop_kind,
+        const memory_desc_t *diff_data_desc, const memory_desc_t *data_desc,
+        dim_t groups, float epsilon, unsigned flags) {
+    if (!one_of(prop_kind, backward, backward_data)) return invalid_arguments;
+    return gnorm_desc_init(gnorm_desc, prop_kind, data_desc, diff_data_desc,
+            groups, epsilon, flags);
+}
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -31,7 +31,9 @@ namespace {
 status_t lnorm_desc_init(layer_normalization_desc_t *lnorm_desc,
         prop_kind_t prop_kind, const memory_desc_t *data_desc,
         const memory_desc_t *stat_desc, const memory_desc_t *diff_data_desc,
-        float epsilon, unsigned flags) {
+        float epsilon, unsigned flags, const memory_desc_t *dst_desc = nullptr,
+        const memory_desc_t *residual_desc = nullptr,
+        const memory_desc_t *sum_desc = nullptr) {
     bool args_ok = true && !any_null(lnorm_desc, data_desc)
             && one_of(prop_kind, forward_training, forward_inference,
                     backward_data, backward)
@@ -40,6 +42,22 @@ status_t lnorm_desc_init(layer_normalization_desc_t *lnorm_desc,
             && (flags & ~(dnnl_use_global_stats | dnnl_use_scaleshift)) == 0;
     if (!args_ok) return invalid_arguments;
 
+    const bool with_dst = dst_desc && !is_zero_md(dst_desc);
+    const bool with_residual = residual_desc && !is_zero_md(residual_desc);
+    const bool with_sum = sum_desc && !is_zero_md(sum_desc);
+    // The sum is the one of the source and the residual
+    if (with_sum && !with_residual) return invalid_arguments;
+    for (auto md : {with_dst ? dst_desc : nullptr,
+                 with_residual ? residual_desc : nullptr,
+                 with_sum ? sum_desc : nullptr}) {
+        if (md == nullptr) continue;
+        if (md->ndims != data_desc->ndims
+                || !array_cmp(md->dims, data_desc->dims, data_desc->ndims))
+            return invalid_arguments;
+        if (memory_desc_wrapper(md).has_runtime_dims_or_strides())
+            return unimplemented;
+    }
+
     auto ld = layer_normalization_desc_t();
     ld.primitive_kind = primitive_kind::layer_normalization;
     ld.prop_kind = prop_kind;
@@ -80,6 +98,10 @@ status_t lnorm_desc_init(layer_normalization_desc_t *lnorm_desc,
     ld.layer_norm_epsilon = epsilon;
     ld.flags = flags;
 
+    if (with_dst) ld.dst_desc = *dst_desc;
+    if (with_residual) ld.residual_desc = *residual_desc;
+    if (with_sum) ld.sum_desc = *sum_desc;
+
     if (ld.prop_kind == backward_data) {
         bool consistency = ld.diff_data_desc.ndims == ld.data_desc.ndims
                 && array_cmp(ld.diff_data_desc.dims, ld.data_desc.dims,
@@ -105,6 +127,19 @@ status_t dnnl_layer_normalization_forward_desc_init(
             epsilon, flags);
 }
 
+status_t dnnl_layer_normalization_forward_desc_init_v2(
+        layer_normalization_desc_t *lnorm_desc, prop_kind_t prop_kind,
+        const memory_desc_t *src_desc, const memory_desc_t *dst_desc,
+        const memory_desc_t *residual_desc, const memory_desc_t *sum_desc,
+        const memory_desc_t *stat_desc, float epsilon, unsigned flags) {
+    if (!one_of(prop_kind, forward_training, forward_inference)
+            || dst_desc == nullptr)
+        return invalid_arguments;
+    if (stat_desc && is_zero_md(stat_desc)) stat_desc = nullptr;
+    return lnorm_desc_init(lnorm_desc, prop_kind, src_desc, stat_desc, nullptr,
+            epsilon, flags, dst_desc, residual_desc, sum_desc);
+}
+
 status_t dnnl_layer_normalization_backward_desc_init(
         layer_normalization_desc_t *lnorm_desc, prop_kind_t prop_kind,
         const memory_desc_t *diff_data_desc, const memory_desc_t *data_desc,
@@ -131,12 +131,20 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
     layer_normalization_fwd_pd_t(const layer_normalization_desc_t *adesc,
             const primitive_attr_t *attr,
             const layer_normalization_fwd_pd_t *hint_fwd_pd)
-        : layer_normalization_pd_t(adesc, attr, hint_fwd_pd) {}
+        : layer_normalization_pd_t(adesc, attr, hint_fwd_pd)
+        , dst_md_(types::is_zero_md(&desc_.dst_desc) ? desc_.data_desc
+                                                     : desc_.dst_desc)
+        , residual_md_(desc_.residual_desc)
+        , sum_md_(desc_.sum_desc) {}
 
     arg_usage_t arg_usage(int arg) const override {
         if (arg == DNNL_ARG_SRC) return arg_usage_t::input;
         if (arg == DNNL_ARG_DST) return arg_usage_t::output;
 
+        if (arg == DNNL_ARG_SRC_1 && with_residual())
+            return arg_usage_t::input;
+        if (arg == DNNL_ARG_DST_1 && with_sum()) return arg_usage_t::output;
+
         if (utils::one_of(arg, DNNL_ARG_MEAN, DNNL_ARG_VARIANCE)) {
             if (stats_are_src()) return arg_usage_t::input;
             if (!stats_are_src() && is_training()) return arg_usage_t::output;
@@ -157,6 +165,8 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
             case DNNL_ARG_VARIANCE:
                 return stats_are_src() ? src_md(2) : dst_md(2);
             case DNNL_ARG_SCALE_SHIFT: return weights_md(0);
+            case DNNL_ARG_SRC_1: return residual_md();
+            case DNNL_ARG_DST_1: return sum_md();
             default: return layer_normalization_pd_t::arg_md(arg);
         }
     }
@@ -168,7 +178,7 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
     }
 
     const memory_desc_t *dst_md(int index = 0) const override {
-        if (index == 0) return &data_md_;
+        if (index == 0) return &dst_md_;
         if (!stats_are_src() && is_training() && (index == 1 || index == 2))
             return &stat_md_;
         return &glob_zero_md;
@@ -178,15 +188,39 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
         return index == 0 ? &scaleshift_md_ : &glob_zero_md;
     }
 
+    const memory_desc_t *residual_md() const {
+        return with_residual() ? &residual_md_ : &glob_zero_md;
+    }
+    const memory_desc_t *sum_md() const {
+        return with_sum() ? &sum_md_ : &glob_zero_md;
+    }
+
     int n_inputs() const override {
-        return 1 + 2 * stats_are_src() + use_scaleshift();
+        return 1 + 2 * stats_are_src() + use_scaleshift() + with_residual();
     }
     int n_outputs() const override {
-        return 1 + 2 * (!stats_are_src()) * is_training();
+        return 1 + 2 * (!stats_are_src()) * is_training() + with_sum();
     }
 
+    bool with_residual() const { return !types::is_zero_md(&residual_md_); }
+    bool with_sum() const { return !types::is_zero_md(&sum_md_); }
+
 protected:
+    memory_desc_t dst_md_;
+    memory_desc_t residual_md_;
+    memory_desc_t sum_md_;
+
+    /* The destination, the residual and the sum take the layout of the
+     * source if their formats are not specified */
     bool set_default_formats_common() {
+        for (auto md : {&dst_md_, &residual_md_, &sum_md_}) {
+            if (md->format_kind != format_kind::any) continue;
+            if (data_md_.format_kind != format_kind::blocked) return false;
+            if (memory_desc_init_by_blocking_desc(
+                        *md, data_md_.format_desc.blocking)
+                    != status::success)
+                return false;
+        }
         return set_default_stat_md_format(data_md_);
     }
 
@@ -194,6 +228,14 @@ protected:
         return IMPLICATION(
                 use_scaleshift(), weights_md()->data_type == data_type::f32);
     }
+
+    /* Only a common output scale known at creation is supported. It is
+     * applied to the normalized result before the conversion to the data
+     * type of the destination */
+    bool attr_oscale_ok() const {
+        const auto &oscale = attr()->output_scales_;
+        return oscale.mask_ == 0 && oscale.defined();
+    }
 };
 
 struct layer_normalization_bwd_pd_t : public layer_normalization_pd_t {
@@ -99,7 +99,9 @@ struct memory_desc_wrapper : public c_compatible {
 
     /** return the size of data type of additional buffer */
     size_t additional_buffer_data_size() const {
-        if (extra().flags & memory_extra_flags::compensation_conv_s8s8)
+        if (extra().flags
+                & (memory_extra_flags::compensation_conv_s8s8
+                        | memory_extra_flags::compensation_conv_asymmetric_src))
             return sizeof(int32_t);
         if (extra().flags & memory_extra_flags::gpu_rnn_u8s8_compensation)
             return sizeof(float);
@@ -110,20 +112,36 @@ struct memory_desc_wrapper : public c_compatible {
     bool is_additional_buffer() const {
         return (extra().flags
                 & (memory_extra_flags::compensation_conv_s8s8
-                        | memory_extra_flags::gpu_rnn_u8s8_compensation));
+                        | memory_extra_flags::gpu_rnn_u8s8_compensation
+                        | memory_extra_flags::compensation_conv_asymmetric_src));
     }
 
     /** returns the size of additional buffer */
     size_t additional_buffer_size() const {
+        return compensation_buffer_size() + asymm_compensation_buffer_size();
+    }
+
+    /** returns the size of the s8s8 (or rnn u8s8) compensation buffer */
+    size_t compensation_buffer_size() const {
         if (extra().flags
                 & (memory_extra_flags::compensation_conv_s8s8
                         | memory_extra_flags::gpu_rnn_u8s8_compensation)) {
             int cmask = extra().compensation_mask;
             assert(cmask == 1 || cmask == 3 || cmask == 27);
-            dim_t prod = 1;
-            for (int d = 0; d < ndims(); ++d)
-                if (cmask & (1 << d)) prod *= padded_dims()[d];
-            return prod * additional_buffer_data_size();
+            return masked_padded_nelems(cmask) * additional_buffer_data_size();
+        }
+
+        return 0;
+    }
+
+    /** returns the size of the asymmetric source compensation buffer that
+     * follows the s8s8 compensation buffer */
+    size_t asymm_compensation_buffer_size() const {
+        if (extra().flags
+                & memory_extra_flags::compensation_conv_asymmetric_src) {
+            int cmask = extra().asymm_compensation_mask;
+            assert(cmask == 1 || cmask == 3);
+            return masked_padded_nelems(cmask) * additional_buffer_data_size();
         }
 
         return 0;
@@ -373,6 +391,14 @@ struct memory_desc_wrapper : public c_compatible {
                           : blk_off<T, Args...>(xn, args...);
     }
 
+    /** returns the number of elements of padded dims selected by mask */
+    dim_t masked_padded_nelems(int mask) const {
+        dim_t prod = 1;
+        for (int d = 0; d < ndims(); ++d)
+            if (mask & (1 << d)) prod *= padded_dims()[d];
+        return prod;
+    }
+
     /* static functions section */
     /* TODO: replace with non-static, once md_ becomes non-const ref */
 
@@ -0,0 +1,301 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <iterator>
+#include <sstream>
+#include <unordered_map>
+
+#include "dnnl.h"
+
+#include "c_types_map.hpp"
+#include "memory_footprint.hpp"
+#include "primitive.hpp"
+#include "utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace memory_footprint {
+
+namespace {
+
+std::atomic<size_t> sizes[n_kinds];
+std::atomic<size_t> total_size(0);
+std::atomic<size_t> peak_size(0);
+
+// Per-thread amounts allocated during primitive creation. The claimed
+// amounts are the ones attributed to the already created nested primitives.
+thread_local size_t thread_allocated[n_kinds] = {0};
+thread_local size_t thread_claimed[n_kinds] = {0};
+thread_local int creation_depth = 0;
+
+// Allocations of the calling thread which are not freed yet, made at the
+// given creation depth. The ones left when the creation is finished are
+// owned by the primitive.
+struct live_alloc_t {
+    size_t size;
+    int depth;
+};
+thread_local std::unordered_map<const void *, live_alloc_t> live_allocs;
+
+const char *prefix2str(memory_tracking::key_t prefix) {
+    using namespace memory_tracking::names;
+    switch (prefix) {
+        case prefix_fusion: return "fusion";
+        case prefix_reducer_bia: return "reducer_bia";
+        case prefix_reducer_wei: return "reducer_wei";
+    }
+    return "unknown";
+}
+
+const char *local_key2str(memory_tracking::key_t key) {
+    using namespace memory_tracking::names;
+#define CASE(k) \
+    case key_##k: return #k;
+    switch (key) {
+        CASE(barrier)
+        CASE(bnorm_bf16cvt)
+        CASE(bnorm_tmp_mean)
+        CASE(bnorm_tmp_var)
+        CASE(bnorm_tmp_diff_ss)
+        CASE(bnorm_tmp_stats)
+        CASE(bnorm_reduction)
+        CASE(concat_iptrs)
+        CASE(concat_istrides)
+        CASE(concat_nelems)
+        CASE(concat_optrs)
+        CASE(concat_tent_dst)
+        CASE(conv_adjusted_scales)
+        CASE(conv_amx_inp_buffer)
+        CASE(conv_amx_tilecfg)
+        CASE(conv_amx_tile_buffer)
+        CASE(conv_amx_wei_buffer)
+        CASE(conv_amx_wsp_buffer)
+        CASE(conv_bia_reduction)
+        CASE(conv_bias_bf16_convert_wsp)
+        CASE(conv_gemm_acc)
+        CASE(conv_gemm_col)
+        CASE(conv_gemm_imtr)
+        CASE(conv_int_dat_in_acc_dt)
+        CASE(conv_padded_bias)
+        CASE(conv_rtus_space)
+        CASE(conv_store_wsp)
+        CASE(conv_tails)
+        CASE(conv_tr_diff_dst)
+        CASE(conv_tr_diff_dst_bctx)
+        CASE(conv_tr_src)
+        CASE(conv_tr_src_bctx)
+        CASE(conv_wei_reduction)
+        CASE(conv_wei_bia_reduction)
+        CASE(conv_wei_bia_reduction_bctx)
+        CASE(conv_zp_src_comp)
+        CASE(eltwise_diff_dst)
+        CASE(eltwise_src)
+        CASE(fusion_forward_scratchpad)
+        CASE(fusion_inout_buffer)
+        CASE(gemm_int_c_in_acc_dt)
+        CASE(gemm_tmp_buffer)
+        CASE(gemm_flag)
+        CASE(gnorm_reduction)
+        CASE(gnorm_tmp_coeff)
+        CASE(gnorm_tmp_mean)
+        CASE(gnorm_tmp_var)
+        CASE(iprod_bias_bf16_convert_wsp)
+        CASE(iprod_dst_bf16_convert_wsp)
+        CASE(iprod_dst_reorder)
+        CASE(iprod_int_dat_in_acc_dt)
+        CASE(lnorm_tmp_mean)
+        CASE(lnorm_tmp_var)
+        CASE(lnorm_tmp_sum)
+        CASE(lnorm_tmp_diff_ss)
+        CASE(lnorm_reduction)
+        CASE(matmul_dst_in_acc_dt)
+        CASE(pool_dst_bf16cvt)
+        CASE(pool_dst_plain2blocked_cvt)
+        CASE(pool_ind_plain2blocked_cvt)
+        CASE(pool_src_bf16cvt)
+        CASE(pool_src_plain2blocked_cvt)
+        CASE(reducer_space)
+        CASE(reducer_space_bctx)
+        CASE(reorder_cross_space)
+        CASE(reorder_space)
+        CASE(reorder_scales)
+        CASE(reorder_wino_plain)
+        CASE(reorder_wino_transform_space)
+        CASE(reorder_rnn_space)
+        CASE(reorder_rnn_weights_bf16_cvt)
+        CASE(reorder_rnn_weights_quantization)
+        CASE(reorder_rnn_weights_reduction)
+        CASE(reorder_rnn_weights_transposition)
+        CASE(resampling_src_ptrs)
+        CASE(resampling_wei)
+        CASE(rnn_space)
+        CASE(rnn_cell)
+        CASE(rnn_gates)
+        CASE(rnn_ht)
+        CASE(rnn_diff_ht)
+        CASE(rnn_ptrs_bia)
+        CASE(rnn_ptrs_wei_layer)
+        CASE(rnn_ptrs_wei_iter)
+        CASE(rnn_ptrs_wei_projection)
+        CASE(softmax_reduction)
+        CASE(sum_reduction)
+        CASE(sum_srcs_cvt)
+        CASE(wino_U)
+        CASE(wino_V)
+        CASE(wino_M)
+    }
+#undef CASE
+    if (key == key_nested) return "nested";
+    if (key >= key_nested_multiple) return "nested_multiple";
+    return "unknown";
+}
+
+} // namespace
+
+void add(kind_t kind, ptrdiff_t size) {
+    if (size == 0) return;
+    if (kind == jit_code && size > 0) thread_allocated[kind] += size;
+    sizes[kind] += size;
+    const size_t total = total_size += size;
+    size_t peak = peak_size.load();
+    while (total > peak && !peak_size.compare_exchange_weak(peak, total))
+        ;
+}
+
+void on_malloc(const void *ptr, size_t size) {
+    if (creation_depth == 0 || ptr == nullptr) return;
+    live_allocs[ptr] = {size, creation_depth};
+    thread_allocated[constant] += size;
+    add(constant, size);
+}
+
+void on_free(const void *ptr) {
+    if (creation_depth == 0 || ptr == nullptr) return;
+    auto it = live_allocs.find(ptr);
+    // The buffers of an enclosing primitive freed by a nested one stay
+    // accounted until the enclosing one is created
+    if (it == live_allocs.end() || it->second.depth != creation_depth) return;
+    thread_allocated[constant] -= it->second.size;
+    add(constant, -(ptrdiff_t)it->second.size);
+    live_allocs.erase(it);
+}
+
+size_t get_size(kind_t kind) {
+    return sizes[kind];
+}
+
+size_t get_peak_size() {
+    return peak_size;
+}
+
+creation_scope_t::creation_scope_t() : stopped_(false) {
+    for (int k = 0; k < n_kinds; ++k) {
+        start_[k] = thread_allocated[k];
+        claimed_start_[k] = thread_claimed[k];
+    }
+    ++creation_depth;
+}
+
+creation_scope_t::~creation_scope_t() {
+    size_t jit_code_size, constant_size, own_constant_size;
+    if (!stopped_) stop(jit_code_size, constant_size, own_constant_size);
+}
+
+void creation_scope_t::stop(size_t &jit_code_size, size_t &constant_size,
+        size_t &own_constant_size) {
+    size_t inclusive[n_kinds], own[n_kinds];
+    for (int k = 0; k < n_kinds; ++k) {
+        inclusive[k] = thread_allocated[k] - start_[k];
+        own[k] = inclusive[k] - (thread_claimed[k] - claimed_start_[k]);
+        // The enclosing primitive does not own anything of this one,
+        // including the primitives nested into this one
+        thread_claimed[k] = claimed_start_[k] + inclusive[k];
+    }
+    // The allocations left are owned by the primitive and released by it
+    for (auto it = live_allocs.begin(); it != live_allocs.end();)
+        it = it->second.depth == creation_depth ? live_allocs.erase(it)
+                                                : std::next(it);
+    --creation_depth;
+    stopped_ = true;
+
+    jit_code_size = inclusive[jit_code];
+    constant_size = inclusive[constant];
+    own_constant_size = own[constant];
+}
+
+std::string key2str(memory_tracking::key_t key) {
+    using namespace memory_tracking;
+    std::string s = local_key2str(key % MAX_KEY);
+    // The prefix of every level occupies its own digit in base MAX_PREFIX,
+    // with the innermost one being the least significant
+    for (auto prefixes = key / MAX_KEY; prefixes; prefixes /= MAX_PREFIX)
+        s = std::string(prefix2str(prefixes % MAX_PREFIX)) + "/" + s;
+    return s;
+}
+
+void print_verbose(const primitive_t *primitive, engine_t *engine) {
+    const auto &pd = primitive->pd();
+    const auto &registry = pd->scratchpad_registry();
+    const size_t scratchpad_size = registry.size();
+    const size_t total = scratchpad_size + primitive->jit_code_size()
+            + primitive->constant_size();
+
+    std::stringstream ss;
+    ss << "scratchpad:" << scratchpad_size
+       << ",jit:" << primitive->jit_code_size()
+       << ",constant:" << primitive->constant_size() << ",total:" << total
+       << ",global_peak:" << get_peak_size() << ",";
+    const char *delim = "";
+    for (const auto &e : registry.entries()) {
+        ss << delim << key2str(e.first) << ":" << e.second.size;
+        delim = " ";
+    }
+
+    printf("dnnl_verbose,memory,%s,%s\n", pd->info(engine), ss.str().c_str());
+    fflush(0);
+}
+
+} // namespace memory_footprint
+} // namespace impl
+} // namespace dnnl
+
+dnnl_status_t dnnl_primitive_get_memory_footprint(
+        const_dnnl_primitive_t primitive,
+        dnnl_memory_footprint_t *footprint) {
+    using namespace dnnl::impl;
+    if (utils::any_null(primitive, footprint)) return status::invalid_arguments;
+
+    const auto &p = primitive->get_primitive();
+    footprint->scratchpad_size = p->pd()->scratchpad_registry().size();
+    footprint->jit_code_size = p->jit_code_size();
+    footprint->constant_size = p->constant_size();
+    footprint->peak_size = footprint->scratchpad_size
+            + footprint->jit_code_size + footprint->constant_size;
+    return status::success;
+}
+
+dnnl_status_t dnnl_get_memory_footprint(dnnl_memory_footprint_t *footprint) {
+    using namespace dnnl::impl;
+    using namespace dnnl::impl::memory_footprint;
+    if (footprint == nullptr) return status::invalid_arguments;
+
+    footprint->scratchpad_size = get_size(scratchpad);
+    footprint->jit_code_size = get_size(jit_code);
+    footprint->constant_size = get_size(constant);
+    footprint->peak_size = get_peak_size();
+    return status::success;
+}
@@ -0,0 +1,101 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_MEMORY_FOOTPRINT_HPP
+#define COMMON_MEMORY_FOOTPRINT_HPP
+
+#include <stddef.h>
+#include <string>
+
+#include "c_types_map.hpp"
+#include "memory_tracking.hpp"
+
+namespace dnnl {
+namespace impl {
+
+struct primitive_t;
+
+namespace memory_footprint {
+
+// Accounting of the memory the library holds on behalf of the primitives. The
+// global amounts are the ones currently allocated; the amounts of a primitive
+// are the ones it needs to execute.
+enum kind_t {
+    // Library-managed scratchpads
+    scratchpad = 0,
+    // Generated code of JIT kernels
+    jit_code,
+    // Buffers allocated at primitive creation, e.g. packed weights and
+    // precomputed tables
+    constant,
+    n_kinds,
+};
+
+// Accounts allocation (positive size) or release (negative size) of memory
+// of the given kind. The JIT code is also attributed to the primitive being
+// created by the calling thread, if any.
+void add(kind_t kind, ptrdiff_t size);
+
+// Accounts an allocation with impl::malloc(). Only the allocations made
+// while a primitive is being created are counted, as the constant memory of
+// the primitive.
+void on_malloc(const void *ptr, size_t size);
+// Accounts a release with impl::free(). The temporaries freed before the
+// creation of the primitive is finished are not counted as its constant
+// memory. The rest is released by the primitive itself.
+void on_free(const void *ptr);
+
+// Returns the currently allocated amount of memory of the given kind
+size_t get_size(kind_t kind);
+// Returns the maximal total amount of memory allocated at the same time
+size_t get_peak_size();
+
+// Attributes the JIT code and the buffers allocated by the calling thread
+// during the lifetime of the object to the primitive being created. The
+// memory of the nested primitives is included.
+struct creation_scope_t {
+    creation_scope_t();
+    ~creation_scope_t();
+
+    // Stops the accounting. Returns the sizes of the JIT code and constant
+    // memory including the nested primitives (inclusive) and the constant
+    // memory excluding them (own_constant), which the primitive releases.
+    void stop(size_t &jit_code_size, size_t &constant_size,
+            size_t &own_constant_size);
+
+private:
+    size_t start_[n_kinds];
+    size_t claimed_start_[n_kinds];
+    bool stopped_;
+
+    creation_scope_t(const creation_scope_t &) = delete;
+    creation_scope_t &operator=(const creation_scope_t &) = delete;
+};
+
+// Returns the name of a scratchpad key, e.g. `reducer_wei/reducer_space`
+std::string key2str(memory_tracking::key_t key);
+
+// Prints the memory footprint of a primitive with the scratchpad broken down
+// by the memory_tracking keys, e.g.
+// `dnnl_verbose,memory,<info>,scratchpad:1024,jit:4096,constant:0,
+// total:5120,global_peak:10240,conv_gemm_col:1024`
+void print_verbose(const primitive_t *primitive, engine_t *engine);
+
+} // namespace memory_footprint
+} // namespace impl
+} // namespace dnnl
+
+#endif
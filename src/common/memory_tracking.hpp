@@ -184,6 +184,7 @@ enum {
     key_conv_wei_reduction,
     key_conv_wei_bia_reduction,
     key_conv_wei_bia_reduction_bctx,
+    key_conv_zp_src_comp,
     key_eltwise_diff_dst,
     key_eltwise_src,
     key_fusion_forward_scratchpad,
@@ -191,6 +192,10 @@ enum {
     key_gemm_int_c_in_acc_dt,
     key_gemm_tmp_buffer,
     key_gemm_flag,
+    key_gnorm_reduction,
+    key_gnorm_tmp_coeff,
+    key_gnorm_tmp_mean,
+    key_gnorm_tmp_var,
     key_iprod_bias_bf16_convert_wsp,
     key_iprod_dst_bf16_convert_wsp,
     key_iprod_dst_reorder,
@@ -199,6 +204,7 @@ enum {
     key_lnorm_tmp_var,
     key_lnorm_tmp_diff_ss,
     key_lnorm_reduction,
+    key_lnorm_tmp_sum,
     key_matmul_dst_in_acc_dt,
     key_pool_dst_bf16cvt,
     key_pool_dst_plain2blocked_cvt,
@@ -217,6 +223,8 @@ enum {
     key_reorder_rnn_weights_quantization,
     key_reorder_rnn_weights_reduction,
     key_reorder_rnn_weights_transposition,
+    key_resampling_src_ptrs,
+    key_resampling_wei,
     key_rnn_space,
     key_rnn_cell,
     key_rnn_gates,
@@ -345,6 +353,10 @@ struct registry_t {
         size_t offset, size, capacity, alignment;
     };
 
+    const std::unordered_map<key_t, entry_t> &entries() const {
+        return offset_map_;
+    }
+
     template <typename return_type>
     class common_iterator_t {
     private:
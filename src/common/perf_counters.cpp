@@ -0,0 +1,191 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <memory>
+#include <sstream>
+#include <vector>
+
+#include "dnnl.h"
+
+#include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "perf_counters.hpp"
+#include "utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+static setting_t<bool> perf_counters {false};
+bool get_perf_counters() {
+    if (!perf_counters.initialized())
+        perf_counters.set(!!getenv_int("DNNL_PERF_COUNTERS", 0));
+    return perf_counters.get();
+}
+
+#ifdef __linux__
+namespace {
+
+const char *event_names[perf_counters_t::n_events]
+        = {"cycles", "instructions", "llc_misses", "backend_stalls"};
+
+// Opens the event for the calling thread and returns the file descriptor or
+// -1 if the event is not supported
+int open_event(int event) {
+    perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    // The events may be multiplexed if the PMU has not enough counters
+    attr.read_format
+            = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    switch (event) {
+        case perf_counters_t::cycles:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_CPU_CYCLES;
+            break;
+        case perf_counters_t::instructions:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+            break;
+        case perf_counters_t::llc_misses:
+            attr.type = PERF_TYPE_HW_CACHE;
+            attr.config = PERF_COUNT_HW_CACHE_LL
+                    | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                    | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+            break;
+        case perf_counters_t::backend_stalls:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_STALLED_CYCLES_BACKEND;
+            break;
+        default: return -1;
+    }
+
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+// Returns the value of the event scaled for the time it was not counted
+uint64_t read_event(int fd) {
+    uint64_t values[3] = {0, 0, 0}; // value, time enabled, time running
+    if (fd < 0 || read(fd, values, sizeof(values)) != sizeof(values))
+        return 0;
+    if (values[2] == 0) return 0;
+    if (values[2] == values[1]) return values[0];
+    return (uint64_t)((double)values[0] * values[1] / values[2]);
+}
+
+} // namespace
+
+perf_counters_t::~perf_counters_t() {
+    for (auto &t : threads_)
+        for (int fd : t.fds)
+            if (fd >= 0) close(fd);
+}
+
+bool perf_counters_t::init() {
+    const int nthr = dnnl_get_max_threads();
+    threads_.resize(nthr);
+    for (auto &t : threads_)
+        for (int &fd : t.fds)
+            fd = -1;
+    parallel(nthr, [&](int ithr, int) {
+        for (int e = 0; e < n_events; ++e)
+            threads_[ithr].fds[e] = open_event(e);
+    });
+    // Nothing to report if even the cycles are not available, e.g. when
+    // perf_event_paranoid does not allow user-space counting
+    return is_available(cycles);
+}
+
+void perf_counters_t::read_all(uint64_t *values) const {
+    for (int e = 0; e < n_events; ++e)
+        values[e] = 0;
+    for (const auto &t : threads_)
+        for (int e = 0; e < n_events; ++e)
+            values[e] += read_event(t.fds[e]);
+}
+
+bool perf_counters_t::is_available(int event) const {
+    for (const auto &t : threads_)
+        if (t.fds[event] >= 0) return true;
+    return false;
+}
+
+void perf_counters_t::start() {
+    read_all(start_);
+}
+
+std::string perf_counters_t::stop() {
+    uint64_t values[n_events];
+    read_all(values);
+
+    std::stringstream ss;
+    for (int e = 0; e < n_events; ++e) {
+        values[e] -= start_[e];
+        if (is_available(e)) ss << "," << event_names[e] << ":" << values[e];
+    }
+    if (is_available(instructions) && values[cycles])
+        ss << ",ipc:" << (double)values[instructions] / values[cycles];
+    return ss.str();
+}
+
+perf_counters_t *perf_counters_t::get() {
+    // Every application thread has its own team of threads to count
+    thread_local std::unique_ptr<perf_counters_t> counters;
+    thread_local bool initialized = false;
+    const bool nthr_changed = counters
+            && (int)counters->threads_.size() != dnnl_get_max_threads();
+    if (!initialized || nthr_changed) {
+        counters.reset(new perf_counters_t());
+        if (!counters->init()) counters.reset();
+        initialized = true;
+    }
+    return counters.get();
+}
+#else
+perf_counters_t::~perf_counters_t() = default;
+void perf_counters_t::start() {}
+std::string perf_counters_t::stop() {
+    return std::string();
+}
+perf_counters_t *perf_counters_t::get() {
+    return nullptr;
+}
+#endif
+
+} // namespace impl
+} // namespace dnnl
+
+dnnl_status_t dnnl_set_perf_counters(int enable) {
+    using namespace dnnl::impl;
+#ifdef __linux__
+    perf_counters.set(enable);
+    return status::success;
+#else
+    UNUSED(enable);
+    return status::unimplemented;
+#endif
+}
@@ -0,0 +1,71 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_PERF_COUNTERS_HPP
+#define COMMON_PERF_COUNTERS_HPP
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace dnnl {
+namespace impl {
+
+bool get_perf_counters();
+
+// Hardware counters of the threads that execute primitives on behalf of the
+// calling thread, sampled with perf_event_open(2) around an execution. The
+// counters are opened in every thread of the parallel region on the first
+// use, so they are exact when the threading runtime keeps its threads, like
+// OpenMP does. Events the CPU or the kernel do not support are omitted.
+struct perf_counters_t {
+    enum event_t {
+        cycles = 0,
+        instructions,
+        llc_misses,
+        backend_stalls,
+        n_events,
+    };
+
+    // Remembers the current values of the counters
+    void start();
+    // Computes the increments since start() and returns them formatted as a
+    // verbose suffix, e.g. `,cycles:1000,instructions:2000,ipc:2`
+    std::string stop();
+
+    // Returns the perf counters of the calling thread or nullptr if the
+    // counters are not supported
+    static perf_counters_t *get();
+
+    ~perf_counters_t();
+
+private:
+    struct thread_events_t {
+        int fds[n_events];
+    };
+    std::vector<thread_events_t> threads_;
+    uint64_t start_[n_events];
+
+    perf_counters_t() = default;
+    bool init();
+    void read_all(uint64_t *values) const;
+    bool is_available(int event) const;
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
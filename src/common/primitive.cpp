@@ -16,13 +16,17 @@
 
 #include <assert.h>
 
+#include "dnnl_debug.h"
+
 #include "c_types_map.hpp"
 #include "engine.hpp"
+#include "perf_counters.hpp"
 #include "primitive.hpp"
 #include "primitive_desc.hpp"
 #include "reorder_pd.hpp"
 #include "scratchpad_debug.hpp"
 #include "stream.hpp"
+#include "trace.hpp"
 #include "utils.hpp"
 
 using namespace dnnl::impl;
@@ -106,12 +110,28 @@ status_t dnnl_primitive_execute(const primitive_iface_t *primitive_iface,
 
     exec_ctx_t ctx(stream, std::move(args));
 
+    std::string trace_name;
+    if (get_trace()) {
+        const auto *pd = primitive_iface->pd()->impl().get();
+        trace_name = std::string(dnnl_prim_kind2str(pd->kind())) + ","
+                + pd->name();
+    }
+    trace::scope_t trace_scope(trace::primitive, trace_name.c_str());
+
     if (get_verbose()) {
+        perf_counters_t *counters = nullptr;
+        if (get_perf_counters()
+                && primitive_iface->engine()->kind() == engine_kind::cpu)
+            counters = perf_counters_t::get();
+        if (counters) counters->start();
         double ms = get_msec();
         status = primitive_iface->execute(ctx);
         stream->wait();
         ms = get_msec() - ms;
-        printf("dnnl_verbose,exec,%s,%g\n", primitive_iface->pd()->info(), ms);
+        const std::string counters_str
+                = counters ? counters->stop() : std::string();
+        printf("dnnl_verbose,exec,%s,%g%s\n", primitive_iface->pd()->info(),
+                ms, counters_str.c_str());
         fflush(0);
     } else {
         status = primitive_iface->execute(ctx);
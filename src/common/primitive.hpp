@@ -22,6 +22,7 @@
 #include "dnnl.h"
 
 #include "c_types_map.hpp"
+#include "memory_footprint.hpp"
 #include "memory_storage.hpp"
 #include "memory_tracking.hpp"
 #include "primitive_desc.hpp"
@@ -41,7 +42,10 @@ struct primitive_t : public c_compatible {
     using primitive_list_t = std::vector<const primitive_t *>;
 
     primitive_t(const primitive_desc_t *pd) : pd_(pd->clone()) {}
-    virtual ~primitive_t() = default;
+    virtual ~primitive_t() {
+        memory_footprint::add(
+                memory_footprint::constant, -(ptrdiff_t)own_constant_size_);
+    }
 
     virtual status_t init(engine_t *engine) { return status::success; }
 
@@ -62,6 +66,10 @@ struct primitive_t : public c_compatible {
 
     bool use_global_scratchpad() const { return use_global_scratchpad_; }
 
+    // The sizes include the nested primitives
+    size_t jit_code_size() const { return jit_code_size_; }
+    size_t constant_size() const { return constant_size_; }
+
 protected:
     template <typename impl_type, typename pd_t>
     static status_t create_primitive_common(
@@ -103,8 +111,13 @@ protected:
             // The requested primitive is NOT present in the cache therefore
             // we have to create it and notify the waiting threads
             // once the creation is done.
+            // Many implementations generate their kernels in the
+            // constructor, so the scope includes it
+            memory_footprint::creation_scope_t footprint_scope;
             p = std::make_shared<impl_type>(pd);
             status = p->init(engine, use_global_scratchpad);
+            footprint_scope.stop(p->jit_code_size_, p->constant_size_,
+                    p->own_constant_size_);
             if (status != status::success) {
                 // Communicate an error.
                 p_promise.set_value({nullptr, status});
@@ -122,11 +135,16 @@ protected:
         primitive = p;
         ms = get_msec() - ms;
         print_verbose(cache_hit, ms);
+        if (!cache_hit && get_verbose() >= 2)
+            memory_footprint::print_verbose(primitive.get(), engine);
         return status;
     }
 
     std::shared_ptr<primitive_desc_t> pd_;
     bool use_global_scratchpad_;
+    size_t jit_code_size_ = 0;
+    size_t constant_size_ = 0;
+    size_t own_constant_size_ = 0;
 
 private:
     primitive_t() = delete;
@@ -250,6 +268,9 @@ struct dnnl_primitive : public dnnl::impl::c_compatible {
     dnnl::impl::engine_t *engine() const;
     const primitive_desc_iface_t *pd() const;
     dnnl::impl::status_t execute(dnnl::impl::exec_ctx_t &ctx) const;
+    const std::shared_ptr<dnnl::impl::primitive_t> &get_primitive() const {
+        return primitive_;
+    }
 
 private:
     std::shared_ptr<dnnl::impl::primitive_t> primitive_;
@@ -236,7 +236,7 @@ struct arg_scales_t : public c_compatible {
 
 private:
     bool check_arg(int arg) const {
-        for (const auto &sa : {DNNL_ARG_SRC_0, DNNL_ARG_SRC_1}) {
+        for (const auto &sa : {DNNL_ARG_SRC_0, DNNL_ARG_SRC_1, DNNL_ARG_DST}) {
             if (arg == sa) return true;
         }
         return false;
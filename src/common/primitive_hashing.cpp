@@ -74,6 +74,9 @@ void key_t::init_mds(const primitive_desc_t *pd) {
         case primitive_kind::gemm: {
             break;
         }
+        case primitive_kind::group_normalization: {
+            break;
+        }
         case primitive_kind::inner_product: {
             break;
         }
@@ -222,6 +225,11 @@ size_t get_md_hash(const memory_desc_t &md) {
         if (md.extra.flags & dnnl_memory_extra_flag_scale_adjust) {
             seed = hash_combine(seed, md.extra.scale_adjust);
         }
+
+        if (md.extra.flags
+                & dnnl_memory_extra_flag_compensation_conv_asymmetric_src) {
+            seed = hash_combine(seed, md.extra.asymm_compensation_mask);
+        }
     }
     // Combined hash for a memory descriptor
     return seed;
@@ -438,6 +446,28 @@ size_t get_desc_hash(const gemm_desc_t &desc) {
     return seed;
 }
 
+// Group normalization
+size_t get_desc_hash(const group_normalization_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc.prop_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.data_desc));
+    seed = hash_combine(seed, get_md_hash(desc.diff_data_desc));
+    seed = hash_combine(seed, get_md_hash(desc.data_scaleshift_desc));
+    seed = hash_combine(seed, get_md_hash(desc.diff_data_scaleshift_desc));
+    seed = hash_combine(seed, get_md_hash(desc.stat_desc));
+    // Groups
+    seed = hash_combine(seed, desc.groups);
+    // Epsilon
+    seed = hash_combine(seed, desc.group_norm_epsilon);
+    // Flags
+    seed = hash_combine(seed, desc.flags);
+    // Combined hash for group_normalization desc
+    return seed;
+}
+
 size_t get_desc_hash(const inner_product_desc_t &desc) {
     size_t seed = 0;
     // Kinds
@@ -474,6 +504,10 @@ size_t get_desc_hash(const layer_normalization_desc_t &desc) {
     seed = hash_combine(seed, desc.layer_norm_epsilon);
     // Flags
     seed = hash_combine(seed, desc.flags);
+    // Memory descriptors of the forward extensions
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    seed = hash_combine(seed, get_md_hash(desc.residual_desc));
+    seed = hash_combine(seed, get_md_hash(desc.sum_desc));
     // Combined hash for layer_normalization desc
     return seed;
 }
@@ -632,6 +666,9 @@ size_t get_desc_hash(const softmax_desc_t &desc) {
     seed = hash_combine(seed, get_md_hash(desc.diff_desc));
     // Axis
     seed = hash_combine(seed, desc.softmax_axis);
+    // Memory descriptors of the forward extensions
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    seed = hash_combine(seed, get_md_hash(desc.mask_desc));
     // Combined hash for softmax desc
     return seed;
 }
@@ -49,6 +49,7 @@ struct cached_op_desc_t {
             CASE(convolution)
             CASE(eltwise)
             CASE(gemm)
+            CASE(group_normalization)
             CASE(inner_product)
             CASE(layer_normalization)
             CASE(lrn)
@@ -78,6 +79,7 @@ struct cached_op_desc_t {
             CASE(convolution)
             CASE(eltwise)
             CASE(gemm)
+            CASE(group_normalization)
             CASE(inner_product)
             CASE(layer_normalization)
             CASE(lrn)
@@ -110,6 +112,7 @@ struct cached_op_desc_t {
             CASE(convolution)
             CASE(eltwise)
             CASE(gemm)
+            CASE(group_normalization)
             CASE(inner_product)
             CASE(layer_normalization)
             CASE(lrn)
@@ -139,6 +142,7 @@ struct cached_op_desc_t {
     DECLARE_CONVERSION_OPERATOR(convolution)
     DECLARE_CONVERSION_OPERATOR(eltwise)
     DECLARE_CONVERSION_OPERATOR(gemm)
+    DECLARE_CONVERSION_OPERATOR(group_normalization)
     DECLARE_CONVERSION_OPERATOR(inner_product)
     DECLARE_CONVERSION_OPERATOR(layer_normalization)
     DECLARE_CONVERSION_OPERATOR(lrn)
@@ -160,6 +164,7 @@ struct cached_op_desc_t {
             case primitive_kind::convolution:
             case primitive_kind::eltwise:
             case primitive_kind::gemm:
+            case primitive_kind::group_normalization:
             case primitive_kind::inner_product:
             case primitive_kind::layer_normalization:
             case primitive_kind::logsoftmax:
@@ -205,6 +210,7 @@ private:
         convolution_desc_t convolution;
         eltwise_desc_t eltwise;
         gemm_desc_t gemm;
+        group_normalization_desc_t group_normalization;
         inner_product_desc_t inner_product;
         layer_normalization_desc_t layer_normalization;
         lrn_desc_t lrn;
@@ -257,6 +263,7 @@ size_t get_desc_hash(const binary_desc_t &desc);
 size_t get_desc_hash(const convolution_desc_t &desc);
 size_t get_desc_hash(const eltwise_desc_t &desc);
 size_t get_desc_hash(const gemm_desc_t &desc);
+size_t get_desc_hash(const group_normalization_desc_t &desc);
 size_t get_desc_hash(const inner_product_desc_t &desc);
 size_t get_desc_hash(const layer_normalization_desc_t &desc);
 size_t get_desc_hash(const lrn_desc_t &desc);
@@ -329,6 +336,7 @@ struct hash<dnnl::impl::primitive_hashing::key_t> {
             CASE(deconvolution)
             CASE(eltwise)
             CASE(gemm)
+            CASE(group_normalization)
             CASE(inner_product)
             CASE(layer_normalization)
             CASE(lrn)
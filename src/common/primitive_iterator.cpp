@@ -22,6 +22,7 @@
 #include "engine.hpp"
 #include "primitive_desc.hpp"
 #include "primitive_iterator.hpp"
+#include "primitive_tuning.hpp"
 #include "type_helpers.hpp"
 
 using namespace dnnl::impl;
@@ -37,8 +38,8 @@ status_t dnnl_primitive_desc_iterator_create(
     using namespace primitive_kind;
     bool known_primitive_kind = utils::one_of(op_desc->kind,
             batch_normalization, binary, convolution, deconvolution, eltwise,
-            gemm, inner_product, layer_normalization, lrn, logsoftmax, matmul,
-            pooling, resampling, rnn, shuffle, softmax);
+            gemm, group_normalization, inner_product, layer_normalization, lrn,
+            logsoftmax, matmul, pooling, resampling, rnn, shuffle, softmax);
     if (!known_primitive_kind) return invalid_arguments;
 
     auto it = new primitive_desc_iterator_t(engine, op_desc, attr,
@@ -55,6 +56,8 @@ status_t dnnl_primitive_desc_iterator_create(
         return unimplemented;
     }
 
+    apply_primitive_tuning(it);
+
     *iterator = it;
     return success;
 }
@@ -87,6 +87,10 @@ struct dnnl_primitive_desc_iterator : public dnnl::impl::c_compatible {
         return return_pd;
     }
 
+    const dnnl::impl::op_desc_t *op_desc() const { return op_desc_; }
+    const dnnl::impl::primitive_desc_t *hint_fwd_pd() const {
+        return hint_fwd_pd_;
+    }
     const dnnl::impl::primitive_attr_t &attr() const { return attr_; }
 
     bool is_initialized() const { return is_initialized_; }
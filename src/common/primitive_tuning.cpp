@@ -0,0 +1,311 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+#include "dnnl.h"
+
+#include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "engine.hpp"
+#include "memory.hpp"
+#include "memory_desc_wrapper.hpp"
+#include "primitive.hpp"
+#include "primitive_desc.hpp"
+#include "primitive_exec_types.hpp"
+#include "primitive_hashing.hpp"
+#include "primitive_iterator.hpp"
+#include "primitive_tuning.hpp"
+#include "stream.hpp"
+#include "utils.hpp"
+#include "verbose.hpp"
+
+namespace dnnl {
+namespace impl {
+
+static setting_t<int> primitive_tuning {(int)tuning_mode_t::none};
+tuning_mode_t get_primitive_tuning() {
+    if (!primitive_tuning.initialized()) {
+        const int mode = getenv_int("DNNL_TUNING", primitive_tuning.get());
+        primitive_tuning.set(utils::one_of(mode, 0, 1, 2) ? mode : 0);
+    }
+    return (tuning_mode_t)primitive_tuning.get();
+}
+
+static setting_t<std::string> primitive_tuning_file;
+static std::mutex primitive_tuning_file_mutex;
+std::string get_primitive_tuning_file() {
+    std::lock_guard<std::mutex> g(primitive_tuning_file_mutex);
+    if (!primitive_tuning_file.initialized()) {
+        char buf[1024];
+        if (getenv("DNNL_TUNING_FILE", buf, sizeof(buf)) > 0)
+            primitive_tuning_file.set(buf);
+        else
+            primitive_tuning_file.set("dnnl_tuning.csv");
+    }
+    return primitive_tuning_file.get();
+}
+
+namespace {
+
+// The decisions are keyed by the problem only: the operation descriptor, the
+// attributes, the engine kind and the number of threads, as the fastest
+// implementation differs between the thread counts.
+std::string get_problem_key(const op_desc_t *op_desc,
+        const primitive_attr_t &attr, const engine_t *engine) {
+    using namespace primitive_hashing;
+    size_t seed = 0;
+    seed = hash_combine(seed, static_cast<size_t>(op_desc->kind));
+    seed = hash_combine(seed, get_attr_hash(attr));
+    seed = hash_combine(seed, static_cast<size_t>(engine->kind()));
+    seed = hash_combine(seed, dnnl_get_max_threads());
+
+#define CASE(pkind, desc_kind) \
+    case primitive_kind::pkind: \
+        seed = hash_combine(seed, get_desc_hash(op_desc->desc_kind)); \
+        break;
+
+    switch ((int)op_desc->kind) {
+        CASE(batch_normalization, batch_normalization)
+        CASE(binary, binary)
+        CASE(convolution, convolution)
+        CASE(deconvolution, deconvolution)
+        CASE(eltwise, eltwise)
+        CASE(gemm, gemm)
+        CASE(group_normalization, group_normalization)
+        CASE(inner_product, inner_product)
+        CASE(layer_normalization, layer_normalization)
+        CASE(logsoftmax, softmax)
+        CASE(lrn, lrn)
+        CASE(matmul, matmul)
+        CASE(pooling, pooling)
+        CASE(resampling, resampling)
+        CASE(rnn, rnn)
+        CASE(shuffle, shuffle)
+        CASE(softmax, softmax)
+        default: assert(!"unknown primitive_kind");
+    }
+#undef CASE
+
+    std::stringstream ss;
+    ss << std::hex << seed;
+    return ss.str();
+}
+
+struct decision_table_t {
+    std::mutex mutex;
+    bool loaded = false;
+    std::unordered_map<std::string, std::string> impls;
+
+    // Every line of the file is `key,impl_name,info`, where the info is the
+    // verbose description of the winner, kept for the reader only. The later
+    // lines take precedence.
+    void load(const std::string &fname) {
+        std::ifstream ifs(fname);
+        std::string line;
+        while (std::getline(ifs, line)) {
+            if (line.empty() || line[0] == '#') continue;
+            const size_t key_end = line.find(',');
+            if (key_end == std::string::npos) continue;
+            const size_t impl_end = line.find(',', key_end + 1);
+            impls[line.substr(0, key_end)]
+                    = line.substr(key_end + 1, impl_end - key_end - 1);
+        }
+        loaded = true;
+    }
+
+    void store(const std::string &fname, const std::string &key,
+            const std::string &impl, const char *info) {
+        impls[key] = impl;
+        FILE *fp = fopen(fname.c_str(), "a");
+        // Failure to persist the decision is not fatal
+        if (!fp) return;
+        fprintf(fp, "%s,%s,%s\n", key.c_str(), impl.c_str(), info);
+        fclose(fp);
+    }
+};
+
+decision_table_t &decision_table() {
+    static decision_table_t table;
+    return table;
+}
+
+// Runs the implementation on zero-filled memory and returns the minimal time
+// of several executions. Fails if the implementation cannot be run without
+// user-provided data, e.g. run-time output scales.
+status_t time_primitive_desc(
+        const primitive_desc_t *pd, engine_t *engine, double &ms) {
+    const int n_warmup = 1, n_times = 5;
+
+    primitive_desc_iface_t pd_iface(pd->clone(), engine);
+    primitive_iface_t *prim_iface_ptr = nullptr;
+    CHECK(pd_iface.create_primitive_iface(&prim_iface_ptr));
+    std::unique_ptr<primitive_iface_t> prim_iface(prim_iface_ptr);
+
+    std::vector<int> arg_ids;
+    for (int arg = DNNL_ARG_SRC_0; arg <= DNNL_ARG_DIFF_BIAS; ++arg)
+        arg_ids.push_back(arg);
+    arg_ids.push_back(DNNL_ARG_ATTR_OUTPUT_SCALES);
+    for (int arg : {DNNL_ARG_SRC, DNNL_ARG_WEIGHTS, DNNL_ARG_DST})
+        arg_ids.push_back(DNNL_ARG_ATTR_ZERO_POINTS | arg);
+    for (int arg : {DNNL_ARG_WEIGHTS, DNNL_ARG_BIAS})
+        arg_ids.push_back(DNNL_ARG_ATTR_POST_OP_DW | arg);
+
+    std::vector<std::unique_ptr<memory_t>> mems;
+    exec_args_t args;
+    for (int arg : arg_ids) {
+        const auto usage = pd->arg_usage(arg);
+        if (usage == primitive_desc_t::arg_usage_t::unused) continue;
+
+        const memory_desc_t *md = pd->arg_md(arg);
+        if (md->ndims == 0) return status::unimplemented;
+
+        memory_t *mem_ptr = nullptr;
+        CHECK(dnnl_memory_create(&mem_ptr, md, engine, DNNL_MEMORY_ALLOCATE));
+        mems.emplace_back(mem_ptr);
+
+        void *handle = nullptr;
+        CHECK(mem_ptr->get_data_handle(&handle));
+        if (handle) memset(handle, 0, memory_desc_wrapper(md).size());
+
+        args[arg] = {mem_ptr, usage == primitive_desc_t::arg_usage_t::input};
+    }
+
+    stream_t *stream_ptr = nullptr;
+    CHECK(dnnl_stream_create(&stream_ptr, engine, stream_flags::default_flags));
+    std::unique_ptr<stream_t> stream(stream_ptr);
+
+    ms = 0;
+    for (int i = 0; i < n_warmup + n_times; ++i) {
+        exec_ctx_t ctx(stream.get(), exec_args_t(args));
+        double t = get_msec();
+        CHECK(prim_iface->execute(ctx));
+        CHECK(stream->wait());
+        t = get_msec() - t;
+        if (i == n_warmup || (i > n_warmup && t < ms)) ms = t;
+    }
+    return status::success;
+}
+
+} // namespace
+
+void apply_primitive_tuning(primitive_desc_iterator_t *it) {
+    const tuning_mode_t mode = get_primitive_tuning();
+    engine_t *engine = it->engine();
+    if (mode == tuning_mode_t::none || engine->kind() != engine_kind::cpu)
+        return;
+
+    const std::string fname = get_primitive_tuning_file();
+    const std::string key = get_problem_key(it->op_desc(), it->attr(), engine);
+
+    std::string impl;
+    {
+        auto &table = decision_table();
+        std::lock_guard<std::mutex> g(table.mutex);
+        if (!table.loaded) table.load(fname);
+        const auto e = table.impls.find(key);
+        if (e != table.impls.end()) impl = e->second;
+    }
+    if (impl.empty() && mode == tuning_mode_t::replay) return;
+
+    // The candidates are collected with a separate iterator, as the original
+    // one cannot move backwards
+    std::vector<std::unique_ptr<primitive_desc_t>> pds;
+    {
+        primitive_desc_iterator_t probe(
+                engine, it->op_desc(), &it->attr(), it->hint_fwd_pd());
+        for (++probe; probe != probe.end(); ++probe)
+            pds.emplace_back(probe.fetch_once());
+    }
+
+    int best = -1;
+    if (!impl.empty()) {
+        for (int i = 0; i < (int)pds.size() && best < 0; ++i)
+            if (impl == pds[i]->name()) best = i;
+    } else {
+        // Implementations that share the name with a preceding one cannot be
+        // told apart in the table, so they are not timed
+        double best_ms = 0;
+        for (int i = 0; i < (int)pds.size(); ++i) {
+            bool is_dup = false;
+            for (int j = 0; j < i; ++j)
+                is_dup = is_dup || !strcmp(pds[i]->name(), pds[j]->name());
+            if (is_dup) continue;
+
+            double ms = 0;
+            const status_t status
+                    = time_primitive_desc(pds[i].get(), engine, ms);
+            if (get_verbose() >= 2) {
+                if (status == status::success)
+                    printf("dnnl_verbose,tune,%s,%g\n", pds[i]->info(engine),
+                            ms);
+                else
+                    printf("dnnl_verbose,tune,%s,skipped\n",
+                            pds[i]->info(engine));
+                fflush(0);
+            }
+            if (status != status::success) continue;
+            if (best < 0 || ms < best_ms) {
+                best = i;
+                best_ms = ms;
+            }
+        }
+
+        // Nothing was timed, so the decision is left to the next run
+        if (best < 0) return;
+
+        auto &table = decision_table();
+        std::lock_guard<std::mutex> g(table.mutex);
+        table.store(fname, key, pds[best]->name(), pds[best]->info(engine));
+    }
+
+    // Both iterators walk the same implementations
+    for (int i = 0; i < best; ++i)
+        ++(*it);
+}
+
+} // namespace impl
+} // namespace dnnl
+
+dnnl_status_t dnnl_set_primitive_tuning(int mode) {
+    using namespace dnnl::impl;
+    if (!utils::one_of(mode, 0, 1, 2)) return status::invalid_arguments;
+    primitive_tuning.set(mode);
+    return status::success;
+}
+
+dnnl_status_t dnnl_set_primitive_tuning_file(const char *path) {
+    using namespace dnnl::impl;
+    if (path == nullptr) return status::invalid_arguments;
+    {
+        std::lock_guard<std::mutex> g(primitive_tuning_file_mutex);
+        primitive_tuning_file.set(path);
+    }
+    // The decisions of the previous file are not applicable any more
+    auto &table = decision_table();
+    std::lock_guard<std::mutex> g(table.mutex);
+    table.impls.clear();
+    table.loaded = false;
+    return status::success;
+}
@@ -0,0 +1,48 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_PRIMITIVE_TUNING_HPP
+#define COMMON_PRIMITIVE_TUNING_HPP
+
+#include <string>
+
+#include "c_types_map.hpp"
+#include "primitive_desc.hpp"
+#include "primitive_iterator.hpp"
+
+namespace dnnl {
+namespace impl {
+
+enum class tuning_mode_t {
+    none = 0, // the first implementation that accepts the problem wins
+    tune = 1, // time all the implementations if the problem is unknown
+    replay = 2, // only apply the decisions recorded in the tuning file
+};
+
+tuning_mode_t get_primitive_tuning();
+std::string get_primitive_tuning_file();
+
+// Moves the iterator, which points to the first implementation, to the
+// implementation recorded in the decision table for the problem. In the
+// tuning mode, if the problem is not in the table yet, all the implementations
+// are timed and the fastest one is recorded. The iterator is left intact if
+// tuning is disabled or no decision can be made.
+void apply_primitive_tuning(primitive_desc_iterator_t *it);
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
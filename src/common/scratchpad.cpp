@@ -17,6 +17,7 @@
 #include <memory>
 
 #include "engine.hpp"
+#include "memory_footprint.hpp"
 #include "utils.hpp"
 
 #include "scratchpad.hpp"
@@ -47,6 +48,11 @@ struct concurrent_scratchpad_t : public scratchpad_t {
         if (mem_storage == nullptr) size_ = 0;
 
         mem_storage_.reset(mem_storage);
+        memory_footprint::add(memory_footprint::scratchpad, size_);
+    }
+
+    ~concurrent_scratchpad_t() {
+        memory_footprint::add(memory_footprint::scratchpad, -(ptrdiff_t)size_);
     }
 
     const memory_storage_t *get_memory_storage() const override {
@@ -71,6 +77,7 @@ struct global_scratchpad_t : public scratchpad_t {
     global_scratchpad_t(engine_t *engine, size_t size) {
         UNUSED(engine);
         if (size > size_) {
+            const size_t old_size = size_;
             delete mem_storage_;
             // Try to expand the global scratchpad to the necessary size
             mem_storage_ = create_scratchpad_memory_storage(engine, size);
@@ -80,6 +87,8 @@ struct global_scratchpad_t : public scratchpad_t {
                 if (mem_storage_ == nullptr) size_ = 0;
             } else
                 size_ = size;
+            memory_footprint::add(memory_footprint::scratchpad,
+                    (ptrdiff_t)size_ - (ptrdiff_t)old_size);
         }
         reference_count_++;
     }
@@ -89,6 +98,8 @@ struct global_scratchpad_t : public scratchpad_t {
         if (reference_count_ == 0) {
             delete mem_storage_;
             mem_storage_ = nullptr;
+            memory_footprint::add(
+                    memory_footprint::scratchpad, -(ptrdiff_t)size_);
             size_ = 0;
         }
     }
@@ -32,17 +32,39 @@ namespace {
 status_t softmax_desc_init(softmax_desc_t *softmax_desc,
         primitive_kind_t prim_kind, prop_kind_t prop_kind,
         const memory_desc_t *data_desc, const memory_desc_t *diff_desc,
-        int softmax_axis) {
+        int softmax_axis, const memory_desc_t *dst_desc = nullptr,
+        const memory_desc_t *mask_desc = nullptr) {
     bool args_ok = true && !any_null(softmax_desc, data_desc)
             && IMPLICATION(prop_kind == backward_data, diff_desc != nullptr)
             && 0 <= softmax_axis && softmax_axis < data_desc->ndims;
     if (!args_ok) return invalid_arguments;
 
+    const bool with_dst = dst_desc && !is_zero_md(dst_desc);
+    const bool with_mask = mask_desc && !is_zero_md(mask_desc);
+    const int ndims = data_desc->ndims;
+    if (with_dst
+            && (dst_desc->ndims != ndims
+                    || !array_cmp(dst_desc->dims, data_desc->dims, ndims)))
+        return invalid_arguments;
+    if (with_mask) {
+        // The mask is broadcast along the dimensions of size 1
+        if (mask_desc->ndims != ndims) return invalid_arguments;
+        for (int d = 0; d < ndims; ++d)
+            if (!one_of(mask_desc->dims[d], 1, data_desc->dims[d]))
+                return invalid_arguments;
+    }
+
     bool runtime_dims_or_strides
             = memory_desc_wrapper(data_desc).has_runtime_dims_or_strides();
     if (prop_kind == backward_data)
         runtime_dims_or_strides = runtime_dims_or_strides
                 || memory_desc_wrapper(diff_desc).has_runtime_dims_or_strides();
+    if (with_dst)
+        runtime_dims_or_strides = runtime_dims_or_strides
+                || memory_desc_wrapper(dst_desc).has_runtime_dims_or_strides();
+    if (with_mask)
+        runtime_dims_or_strides = runtime_dims_or_strides
+                || memory_desc_wrapper(mask_desc).has_runtime_dims_or_strides();
     if (runtime_dims_or_strides) return unimplemented;
 
     auto sd = softmax_desc_t();
@@ -52,6 +74,8 @@ status_t softmax_desc_init(softmax_desc_t *softmax_desc,
     sd.data_desc = *data_desc;
     if (sd.prop_kind == backward_data) sd.diff_desc = *diff_desc;
     sd.softmax_axis = softmax_axis;
+    if (with_dst) sd.dst_desc = *dst_desc;
+    if (with_mask) sd.mask_desc = *mask_desc;
 
     *softmax_desc = sd;
     return success;
@@ -67,6 +91,17 @@ status_t dnnl_softmax_forward_desc_init(softmax_desc_t *softmax_desc,
             data_desc, nullptr, softmax_axis);
 }
 
+status_t dnnl_softmax_forward_desc_init_v2(softmax_desc_t *softmax_desc,
+        prop_kind_t prop_kind, const memory_desc_t *src_desc,
+        const memory_desc_t *dst_desc, const memory_desc_t *mask_desc,
+        int softmax_axis) {
+    if (!one_of(prop_kind, forward_inference, forward_training)
+            || dst_desc == nullptr)
+        return invalid_arguments;
+    return softmax_desc_init(softmax_desc, primitive_kind::softmax, prop_kind,
+            src_desc, nullptr, softmax_axis, dst_desc, mask_desc);
+}
+
 status_t dnnl_softmax_backward_desc_init(softmax_desc_t *softmax_desc,
         const memory_desc_t *diff_desc, const memory_desc_t *data_desc,
         int softmax_axis) {
@@ -115,11 +115,16 @@ struct softmax_fwd_pd_t : public softmax_pd_t {
 
     softmax_fwd_pd_t(const softmax_desc_t *adesc, const primitive_attr_t *attr,
             const softmax_fwd_pd_t *hint_fwd_pd)
-        : softmax_pd_t(adesc, attr, hint_fwd_pd) {}
+        : softmax_pd_t(adesc, attr, hint_fwd_pd)
+        , dst_md_(types::is_zero_md(&desc_.dst_desc) ? desc_.data_desc
+                                                     : desc_.dst_desc)
+        , mask_md_(desc_.mask_desc) {}
 
     arg_usage_t arg_usage(int arg) const override {
         if (arg == DNNL_ARG_SRC) return arg_usage_t::input;
 
+        if (arg == DNNL_ARG_SRC_1 && with_mask()) return arg_usage_t::input;
+
         if (arg == DNNL_ARG_DST) return arg_usage_t::output;
 
         if (arg == DNNL_ARG_WORKSPACE && (!types::is_zero_md(workspace_md())))
@@ -131,22 +136,61 @@ struct softmax_fwd_pd_t : public softmax_pd_t {
     const memory_desc_t *arg_md(int arg) const override {
         switch (arg) {
             case DNNL_ARG_SRC: return src_md(0);
+            case DNNL_ARG_SRC_1: return src_md(1);
             case DNNL_ARG_DST: return dst_md(0);
             default: return softmax_pd_t::arg_md(arg);
         }
     }
 
     const memory_desc_t *src_md(int index = 0) const override {
-        return index == 0 ? &data_md_ : &glob_zero_md;
+        if (index == 0) return &data_md_;
+        if (index == 1 && with_mask()) return &mask_md_;
+        return &glob_zero_md;
     }
     const memory_desc_t *dst_md(int index = 0) const override {
-        return index == 0 ? &data_md_ : &glob_zero_md;
+        return index == 0 ? &dst_md_ : &glob_zero_md;
     }
 
-    int n_inputs() const override { return 1; }
+    int n_inputs() const override { return 1 + with_mask(); }
     int n_outputs() const override {
         return 1 + (!types::is_zero_md(workspace_md()));
     }
+
+    bool with_mask() const { return !types::is_zero_md(&mask_md_); }
+
+protected:
+    memory_desc_t dst_md_;
+    memory_desc_t mask_md_;
+
+    /* The destination takes the layout of the source and the mask is plain
+     * if their formats are not specified */
+    bool set_default_formats() {
+        if (dst_md_.format_kind == format_kind::any) {
+            if (data_md_.format_kind != format_kind::blocked) return false;
+            if (memory_desc_init_by_blocking_desc(
+                        dst_md_, data_md_.format_desc.blocking)
+                    != status::success)
+                return false;
+        }
+        if (mask_md_.format_kind == format_kind::any
+                && memory_desc_init_by_strides(mask_md_, nullptr)
+                        != status::success)
+            return false;
+        return true;
+    }
+
+    /* Only common scales known at creation are supported: the scale of the
+     * source is applied before the mask is added and the scale of the
+     * destination is applied to the result */
+    bool attr_scales_ok() const {
+        // The fused scales are a part of the softmax forward only
+        if (is_logsoftmax()) return attr()->has_default_values();
+        const auto &src_scales = attr()->scales_.get(DNNL_ARG_SRC);
+        const auto &dst_scales = attr()->scales_.get(DNNL_ARG_DST);
+        return src_scales.mask_ == 0 && src_scales.defined()
+                && dst_scales.mask_ == 0 && dst_scales.defined()
+                && attr()->scales_.get(DNNL_ARG_SRC_1).has_default_values();
+    }
 };
 
 struct softmax_bwd_pd_t : public softmax_pd_t {
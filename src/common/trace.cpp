@@ -0,0 +1,194 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "dnnl.h"
+
+#include "c_types_map.hpp"
+#include "trace.hpp"
+#include "utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+namespace {
+
+struct event_t {
+    char name[64];
+    trace::kind_t kind;
+    double start_us;
+    double dur_us;
+};
+
+struct thread_buffer_t {
+    static constexpr size_t capacity = 1 << 16;
+
+    thread_buffer_t(int tid) : tid(tid), events(capacity), n_events(0) {}
+
+    // Only the owning thread writes to the buffer
+    void record(trace::kind_t kind, const char *name, double start_us,
+            double dur_us) {
+        event_t &e = events[n_events++ % capacity];
+        strncpy(e.name, name ? name : "", sizeof(e.name) - 1);
+        e.name[sizeof(e.name) - 1] = '\0';
+        e.kind = kind;
+        e.start_us = start_us;
+        e.dur_us = dur_us;
+    }
+
+    int tid;
+    std::vector<event_t> events;
+    size_t n_events;
+};
+constexpr size_t thread_buffer_t::capacity;
+
+const char *kind2str(trace::kind_t kind) {
+    switch (kind) {
+        case trace::primitive: return "primitive";
+        case trace::parallel: return "parallel";
+        case trace::barrier: return "barrier";
+    }
+    return "unknown";
+}
+
+// Owns the buffers of all the threads, so that the events of the threads that
+// have exited are dumped too
+struct trace_registry_t {
+    trace_registry_t() : start(std::chrono::steady_clock::now()) {
+        char buf[1024];
+        if (getenv("DNNL_TRACE", buf, sizeof(buf)) > 0) fname = buf;
+    }
+
+    ~trace_registry_t() { dump(); }
+
+    thread_buffer_t *register_thread() {
+        std::lock_guard<std::mutex> g(mutex);
+        buffers.emplace_back(new thread_buffer_t((int)buffers.size()));
+        return buffers.back().get();
+    }
+
+    double now_us() const {
+        using namespace std::chrono;
+        return duration<double, std::micro>(steady_clock::now() - start)
+                .count();
+    }
+
+    void dump() {
+        if (fname.empty()) return;
+        FILE *fp = fopen(fname.c_str(), "w");
+        if (!fp) return;
+
+#ifdef _WIN32
+        const int pid = _getpid();
+#else
+        const int pid = getpid();
+#endif
+        fprintf(fp, "{\"traceEvents\":[\n");
+        bool first = true;
+        for (const auto &b : buffers) {
+            fprintf(fp,
+                    "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,"
+                    "\"tid\":%d,\"args\":{\"name\":\"thread %d\"}}",
+                    first ? "" : ",\n", pid, b->tid, b->tid);
+            first = false;
+
+            const size_t n = std::min(b->n_events, thread_buffer_t::capacity);
+            for (size_t i = b->n_events - n; i < b->n_events; ++i) {
+                const event_t &e = b->events[i % thread_buffer_t::capacity];
+                fprintf(fp,
+                        ",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\","
+                        "\"ts\":%.3f,\"dur\":%.3f,\"pid\":%d,\"tid\":%d}",
+                        e.name, kind2str(e.kind), e.start_us, e.dur_us, pid,
+                        b->tid);
+            }
+        }
+        fprintf(fp, "\n]}\n");
+        fclose(fp);
+    }
+
+    std::chrono::steady_clock::time_point start;
+    std::string fname;
+    std::mutex mutex;
+    std::vector<std::unique_ptr<thread_buffer_t>> buffers;
+};
+
+trace_registry_t &trace_registry() {
+    static trace_registry_t registry;
+    return registry;
+}
+
+thread_buffer_t *thread_buffer() {
+    thread_local thread_buffer_t *buffer = nullptr;
+    if (!buffer) buffer = trace_registry().register_thread();
+    return buffer;
+}
+
+thread_local const char *current_trace_name = nullptr;
+
+} // namespace
+
+static setting_t<bool> trace_enabled {false};
+bool get_trace() {
+    if (!trace_enabled.initialized()) {
+        static std::mutex m;
+        std::lock_guard<std::mutex> g(m);
+        if (!trace_enabled.initialized())
+            trace_enabled.set(!trace_registry().fname.empty());
+    }
+    return trace_enabled.get();
+}
+
+namespace trace {
+
+const char *current_name() {
+    return current_trace_name;
+}
+
+scope_t::scope_t(kind_t kind, const char *name)
+    : enabled_(get_trace())
+    , kind_(kind)
+    , name_(name)
+    , prev_name_(current_trace_name)
+    , start_us_(0) {
+    if (!enabled_) return;
+    if (kind_ == primitive) current_trace_name = name_;
+    start_us_ = trace_registry().now_us();
+}
+
+scope_t::~scope_t() {
+    if (!enabled_) return;
+    const double end_us = trace_registry().now_us();
+    thread_buffer()->record(kind_, name_, start_us_, end_us - start_us_);
+    if (kind_ == primitive) current_trace_name = prev_name_;
+}
+
+} // namespace trace
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,74 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_TRACE_HPP
+#define COMMON_TRACE_HPP
+
+// The inline threading helpers are also used outside of the library, e.g. by
+// the tests, which cannot reach the tracer if it is hidden in a shared library
+#if defined(DNNL_DLL) && !defined(DNNL_DLL_EXPORTS)
+#define DNNL_TRACE_HOOKS 0
+#else
+#define DNNL_TRACE_HOOKS 1
+#endif
+
+namespace dnnl {
+namespace impl {
+
+// Returns true if the timeline of primitive executions, parallel regions and
+// barriers is recorded. The timeline is written in Chrome trace format to the
+// file set by DNNL_TRACE at exit and can be opened in chrome://tracing or
+// Perfetto UI.
+bool get_trace();
+
+namespace trace {
+
+// Events are recorded into a per-thread ring buffer, so recording does not
+// synchronize threads. Only the most recent events of every thread are kept
+// if the buffer overflows.
+enum kind_t {
+    primitive = 0,
+    parallel,
+    barrier,
+};
+
+// Returns the name of the primitive executed by the calling thread, nullptr
+// outside of primitive execution
+const char *current_name();
+
+// Records an event of the given kind spanning the lifetime of the object.
+// The name is copied. A primitive event also becomes the current name of the
+// calling thread for the nested events.
+struct scope_t {
+    scope_t(kind_t kind, const char *name);
+    ~scope_t();
+
+private:
+    bool enabled_;
+    kind_t kind_;
+    const char *name_;
+    const char *prev_name_;
+    double start_us_;
+
+    scope_t(const scope_t &) = delete;
+    scope_t &operator=(const scope_t &) = delete;
+};
+
+} // namespace trace
+} // namespace impl
+} // namespace dnnl
+
+#endif
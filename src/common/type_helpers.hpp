@@ -127,7 +127,12 @@ inline bool memory_extra_desc_is_equal(
                     lhs.flags & memory_extra_flags::gpu_rnn_u8s8_compensation,
                     lhs.compensation_mask == rhs.compensation_mask)
             && IMPLICATION(lhs.flags & memory_extra_flags::scale_adjust,
-                    lhs.scale_adjust == rhs.scale_adjust);
+                    lhs.scale_adjust == rhs.scale_adjust)
+            && IMPLICATION(lhs.flags
+                            & memory_extra_flags::
+                                    compensation_conv_asymmetric_src,
+                    lhs.asymm_compensation_mask
+                            == rhs.asymm_compensation_mask);
 }
 
 inline bool blocking_desc_is_equal(const memory_desc_t &lhs_md,
@@ -353,6 +358,21 @@ inline bool operator==(const gemm_desc_t &lhs, const gemm_desc_t &rhs) {
     return ret;
 }
 
+inline bool operator==(const group_normalization_desc_t &lhs,
+        const group_normalization_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(prop_kind)
+            && COMPARE_DESC_MEMBERS(data_desc)
+            && COMPARE_DESC_MEMBERS(diff_data_desc)
+            && COMPARE_DESC_MEMBERS(data_scaleshift_desc)
+            && COMPARE_DESC_MEMBERS(diff_data_scaleshift_desc)
+            && COMPARE_DESC_MEMBERS(stat_desc)
+            && COMPARE_DESC_MEMBERS(groups)
+            && COMPARE_DESC_MEMBERS(group_norm_epsilon)
+            && COMPARE_DESC_MEMBERS(flags);
+    return ret;
+}
+
 inline bool operator==(
         const inner_product_desc_t &lhs, const inner_product_desc_t &rhs) {
     bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
@@ -379,7 +399,9 @@ inline bool operator==(const layer_normalization_desc_t &lhs,
             && COMPARE_DESC_MEMBERS(diff_data_scaleshift_desc)
             && COMPARE_DESC_MEMBERS(stat_desc)
             && COMPARE_DESC_MEMBERS(layer_norm_epsilon)
-            && COMPARE_DESC_MEMBERS(flags);
+            && COMPARE_DESC_MEMBERS(flags) && COMPARE_DESC_MEMBERS(dst_desc)
+            && COMPARE_DESC_MEMBERS(residual_desc)
+            && COMPARE_DESC_MEMBERS(sum_desc);
     return ret;
 }
 
@@ -491,7 +513,9 @@ inline bool operator==(const softmax_desc_t &lhs, const softmax_desc_t &rhs) {
             && COMPARE_DESC_MEMBERS(prop_kind)
             && COMPARE_DESC_MEMBERS(data_desc)
             && COMPARE_DESC_MEMBERS(diff_desc)
-            && COMPARE_DESC_MEMBERS(softmax_axis);
+            && COMPARE_DESC_MEMBERS(softmax_axis)
+            && COMPARE_DESC_MEMBERS(dst_desc)
+            && COMPARE_DESC_MEMBERS(mask_desc);
     return ret;
 }
 
@@ -37,6 +37,7 @@
 
 #include "dnnl.h"
 #include "memory_debug.hpp"
+#include "memory_footprint.hpp"
 #include "utils.hpp"
 
 #include "cpu/platform.hpp"
@@ -108,8 +109,11 @@ int getpagesize() {
 
 void *malloc(size_t size, int alignment) {
     void *ptr;
-    if (memory_debug::is_mem_debug())
-        return memory_debug::malloc(size, alignment);
+    if (memory_debug::is_mem_debug()) {
+        ptr = memory_debug::malloc(size, alignment);
+        memory_footprint::on_malloc(ptr, size);
+        return ptr;
+    }
 
 #ifdef _WIN32
     ptr = _aligned_malloc(size, alignment);
@@ -118,10 +122,13 @@ void *malloc(size_t size, int alignment) {
     int rc = ::posix_memalign(&ptr, alignment, size);
 #endif
 
-    return (rc == 0) ? ptr : 0;
+    if (rc != 0) return 0;
+    memory_footprint::on_malloc(ptr, size);
+    return ptr;
 }
 
 void free(void *p) {
+    memory_footprint::on_free(p);
 
     if (memory_debug::is_mem_debug()) return memory_debug::free(p);
 
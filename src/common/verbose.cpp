@@ -35,6 +35,7 @@
 #include "deconvolution_pd.hpp"
 #include "eltwise_pd.hpp"
 #include "gemm_pd.hpp"
+#include "group_normalization_pd.hpp"
 #include "inner_product_pd.hpp"
 #include "layer_normalization_pd.hpp"
 #include "lrn_pd.hpp"
@@ -534,6 +535,36 @@ static void init_info_gemm(const engine_t *e, pd_t *s, char *buffer) {
             attr_str, aux_str, prb_str);
 }
 
+template <typename pd_t>
+static void init_info_group_normalization(engine_t *e, pd_t *s, char *buffer) {
+    DECL_DAT_AUX_PRB_STRS();
+
+    { // data
+        auto md = s->src_md();
+        DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, "data_");
+        MD2STR(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, md);
+    }
+    { // diff data
+        auto md = s->diff_src_md();
+        if (md) {
+            DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, " diff_");
+            MD2STR(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, md);
+        }
+    }
+
+    attr2str(attr_str, DNNL_VERBOSE_ATTR_LEN, attr_written, s->attr());
+
+    flags2str(aux_str, DNNL_VERBOSE_AUX_LEN, aux_written, s->desc()->flags);
+
+    DPRINT(prb_str, DNNL_VERBOSE_PRB_LEN, prb_written, "g" DFMT,
+            s->desc()->groups);
+    format_prb_desc_str(
+            prb_str, DNNL_VERBOSE_PRB_LEN, prb_written, s->src_md());
+
+    verbose_templ(buffer, e, s->kind(), s->name(), s->desc()->prop_kind,
+            dat_str, attr_str, aux_str, prb_str);
+}
+
 template <typename pd_t>
 static void init_info_inner_product(engine_t *e, pd_t *s, char *buffer) {
     DECL_DAT_AUX_PRB_STRS();
@@ -599,6 +630,27 @@ static void init_info_layer_normalization(engine_t *e, pd_t *s, char *buffer) {
         DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, "data_");
         MD2STR(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, md);
     }
+    if (s->is_fwd()) { // dst, if it differs from src
+        auto md = s->dst_md();
+        if (memory_desc_wrapper(md) != memory_desc_wrapper(s->src_md())) {
+            DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, " dst_");
+            MD2STR(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, md);
+        }
+    }
+    { // residual
+        auto md = s->arg_md(DNNL_ARG_SRC_1);
+        if (!types::is_zero_md(md)) {
+            DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, " residual_");
+            MD2STR(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, md);
+        }
+    }
+    { // sum
+        auto md = s->arg_md(DNNL_ARG_DST_1);
+        if (!types::is_zero_md(md)) {
+            DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, " sum_");
+            MD2STR(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, md);
+        }
+    }
     { // stats
         auto md = s->is_fwd() && !s->stats_are_src() ? s->dst_md(1)
                                                      : s->src_md(1);
@@ -783,10 +835,24 @@ static void init_info_softmax(const engine_t *e, pd_t *s, char *buffer) {
     DECL_DAT_AUX_PRB_STRS();
 
     { // data
-        auto md = s->dst_md();
+        auto md = s->is_fwd() ? s->src_md() : s->dst_md();
         DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, "data_");
         MD2STR(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, md);
     }
+    if (s->is_fwd()) { // dst, if it differs from src
+        auto md = s->dst_md();
+        if (memory_desc_wrapper(md) != memory_desc_wrapper(s->src_md())) {
+            DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, " dst_");
+            MD2STR(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, md);
+        }
+    }
+    { // mask
+        auto md = s->src_md(1);
+        if (!types::is_zero_md(md)) {
+            DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, " mask_");
+            MD2STR(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, md);
+        }
+    }
     { // diff data
         auto md = s->diff_src_md();
         if (md) {
@@ -1018,6 +1084,7 @@ void pd_info_t::init(engine_t *engine, const primitive_desc_t *pd) {
             CASE(deconvolution);
             CASE(eltwise);
             CASE(gemm);
+            CASE(group_normalization);
             CASE(inner_product);
             CASE(layer_normalization);
             CASE(lrn);
@@ -16,6 +16,8 @@
 
 #include <assert.h>
 
+#include "common/trace.hpp"
+
 #include "cpu/aarch64/cpu_barrier.hpp"
 
 namespace dnnl {
@@ -94,6 +96,7 @@ void generate(
 
 void barrier(ctx_t *ctx, int nthr) {
     static jit_t j; /* XXX: constructed on load ... */
+    trace::scope_t scope(trace::barrier, trace::current_name());
     j.barrier(ctx, nthr); // barrier
 }
 
@@ -22,10 +22,12 @@
 #include <limits.h>
 
 #include "common/bit_cast.hpp"
+#include "common/memory_footprint.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
 #include "cpu/aarch64/cpu_isa_traits.hpp"
+#include "cpu/aarch64/jit_utils/jit_utils.hpp"
 
 #if defined(_WIN32) && !defined(__GNUC__)
 #define STRUCT_ALIGN(al, ...) __declspec(align(al)) __VA_ARGS__
@@ -1101,52 +1103,23 @@ public:
             minps(vmm, vmm_ubound);
     }
 
-    void dump_code32(const Xbyak::XBYAK_CODE_PTR *code) const {
-        if (code) {
-            static int counter = 0;
-#define MAX_FNAME_LEN 256
-            char fname[MAX_FNAME_LEN + 1];
-            snprintf(fname, MAX_FNAME_LEN, "dnnl_dump_%s.%d.bin", name(),
-                    counter);
-            counter++;
-
-            FILE *fp = fopen(fname, "w+");
-            // Failure to dump code is not fatal
-            if (fp) {
-#ifdef DNNL_INDIRECT_JIT_AARCH64
-                size_t unused = fwrite(code, getSize() * 4, 1, fp);
-#else
-                size_t unused = fwrite(code, getSize(), 1, fp);
-#endif
-                UNUSED(unused);
-                fclose(fp);
-            }
-        }
-#undef MAX_FNAME_LEN
+    // Registers the generated code with the JIT dump and the Linux perf
+    // profiling hooks. The size is in bytes.
+    void register_jit_code(const void *code, size_t code_size) const {
+        jit_utils::register_jit_code(code, code_size, name(), source_file());
     }
 
-    void dump_code(const Xbyak::uint8 *code) const {
-        if (code) {
-            static int counter = 0;
-#define MAX_FNAME_LEN 256
-            char fname[MAX_FNAME_LEN + 1];
-            snprintf(fname, MAX_FNAME_LEN, "dnnl_dump_%s.%d.bin", name(),
-                    counter);
-            counter++;
-
-            FILE *fp = fopen(fname, "w+");
+    DNNL_DISALLOW_COPY_AND_ASSIGN(jit_generator);
 
-            // Failure to dump code is not fatal
-            if (fp) {
-                size_t unused = fwrite(code, getSize() * 4, 1, fp);
-                UNUSED(unused);
-                fclose(fp);
-            }
-        }
-#undef MAX_FNAME_LEN
+private:
+    // The code is accounted once, even if it is requested several times
+    void account_jit_code(size_t code_size) {
+        if (jit_code_size_ != 0) return;
+        jit_code_size_ = code_size;
+        memory_footprint::add(memory_footprint::jit_code, code_size);
     }
 
-    DNNL_DISALLOW_COPY_AND_ASSIGN(jit_generator);
+    size_t jit_code_size_ = 0;
 
 public:
     jit_generator(void *code_ptr = nullptr, size_t code_size = MAX_CODE_SIZE,
@@ -1156,7 +1129,10 @@ public:
                 (code_ptr == nullptr && use_autogrow) ? Xbyak::Xbyak_aarch64::AutoGrow
                                                       : code_ptr) {}
 #endif
-    virtual ~jit_generator() {}
+    virtual ~jit_generator() {
+        memory_footprint::add(
+                memory_footprint::jit_code, -(ptrdiff_t)jit_code_size_);
+    }
 
     virtual const char *name() const = 0;
     virtual const char *source_file() const = 0;
@@ -1165,7 +1141,14 @@ public:
         this->ready();
         const uint32_t *code = CGA64::getCode32();
 
-        if (get_jit_dump()) dump_code32(code);
+#ifdef DNNL_INDIRECT_JIT_AARCH64
+        // translated code: the size is counted in instructions
+        register_jit_code(code, getSize() * 4);
+        account_jit_code(getSize() * 4);
+#else
+        register_jit_code(code, getSize());
+        account_jit_code(getSize());
+#endif
 
         return code;
     }
@@ -1174,7 +1157,8 @@ public:
     const Xbyak::uint8 *getCode() {
         const Xbyak::uint8 *code = CodeGenerator::getCode();
 
-        if (get_jit_dump()) dump_code(code);
+        register_jit_code(code, getSize() * 4);
+        account_jit_code(getSize() * 4);
 
         return code;
     }
@@ -68,7 +68,8 @@ struct jit_uni_i8i8_binary_t : public primitive_t {
             for (const auto &s : attr()->scales_.scales_) {
                 if (s.second.mask_ != 0) return false;
             }
-            return true;
+            // only the sources are scaled
+            return attr()->scales_.get(DNNL_ARG_DST).has_default_values();
         }
 
         bool is_applicable() {
@@ -47,9 +47,13 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
                 JIT_IMPL_NAME_HELPER("jit:", isa, ""), jit_uni_softmax_fwd_t);
 
         status_t init(engine_t *engine) {
+            if (!set_default_formats()) return status::unimplemented;
+
             const memory_desc_wrapper src_d(src_md());
             const memory_desc_wrapper dst_d(dst_md());
-            auto data_type = src_d.data_type();
+            const memory_desc_wrapper mask_d(src_md(1));
+            const auto src_dt = src_d.data_type();
+            const auto dst_dt = dst_d.data_type();
             auto is_dense = [&]() {
                 const auto &bd = src_d.blocking_desc();
 
@@ -59,11 +63,15 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
                 // It is fine to use float here as the kernel uses halfs of
                 // vector registers.
                 const auto blk_size = cpu_isa_traits<isa>::vlen / sizeof(float);
-                if (src_d.is_plain())
-                    return bd.strides[axis()] == 1;
-                else {
-                    // 31 is a general limit, 2 is for unroll_regs_ = 4;
-                    const size_t max_stride = (1LL << (31 - 2)) - 1;
+                // 31 is a general limit, 2 is for unroll_regs_ = 4;
+                const size_t max_stride = (1LL << (31 - 2)) - 1;
+                if (src_d.is_plain()) {
+                    // A strided axis is vectorized over the inner elements
+                    return bd.strides[axis()] == 1
+                            || (isa == avx512_common
+                                    && sizeof(float) * bd.strides[axis()]
+                                            < max_stride);
+                } else {
                     const int last_blk = bd.inner_nblks - 1;
                     return true && bd.inner_blks[last_blk] == blk_size
                             && bd.inner_idxs[last_blk] == axis()
@@ -71,18 +79,43 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
                 }
             };
 
+            // The scales, the mask and the conversion to another data type
+            // are fused for plain layouts with the softmax axis innermost
+            const bool is_fused = src_dt != dst_dt || with_mask()
+                    || !attr()->has_default_values();
+            auto is_fused_ok = [&]() {
+                if (!src_d.is_plain()
+                        || src_d.blocking_desc().strides[axis()] != 1
+                        || !src_d.similar_to(dst_d, true, false))
+                    return false;
+                if (!with_mask()) return true;
+                const auto &mask_bd = mask_d.blocking_desc();
+                return mask_d.data_type() == data_type::f32
+                        && mask_d.is_plain()
+                        && mask_d.dims()[axis()] == axis_size()
+                        && mask_bd.strides[axis()] == 1;
+            };
+
             using namespace data_type;
-            bool ok = src_d == dst_d && mayiuse(isa) && is_fwd()
-                    && !has_zero_dim_memory()
-                    && utils::one_of(data_type, f32, bf16)
-                    && IMPLICATION(data_type == bf16,
+            using skip_mask_t = primitive_attr_t::skip_mask_t;
+            bool ok = mayiuse(isa) && is_fwd() && !has_zero_dim_memory()
+                    && utils::one_of(src_dt, f32, bf16)
+                    && utils::one_of(dst_dt, f32, bf16, s8, u8)
+                    && IMPLICATION(utils::one_of(bf16, src_dt, dst_dt),
                             // extra check for isa is required because
                             // the avx512_common version may reject a
                             // problem because it is blocked by 8
                             // instead of 16.
                             isa >= avx512_common && mayiuse(avx512_core))
+                    // the int8 tail is stored with a byte mask
+                    && IMPLICATION(utils::one_of(dst_dt, s8, u8),
+                            mayiuse(avx512_core))
+                    && IMPLICATION(!is_fused, src_d == dst_d)
+                    && IMPLICATION(is_fused,
+                            isa == avx512_common && is_fused_ok())
                     && is_dense() // not dense impl can be easily done
-                    && attr()->has_default_values();
+                    && attr()->has_default_values(skip_mask_t::scales)
+                    && attr_scales_ok();
             if (!ok) return status::unimplemented;
 
             return status::success;
@@ -121,11 +154,15 @@ struct jit_uni_softmax_bwd_t : public primitive_t {
                 // It is fine to use float here as the kernel uses halfs of
                 // vector registers.
                 const auto blk_size = cpu_isa_traits<isa>::vlen / sizeof(float);
-                if (dst_d.is_plain())
-                    return bd.strides[axis()] == 1;
-                else {
-                    // 31 is a general limit, 2 is for unroll_regs_ = 4;
-                    const size_t max_stride = (1LL << (31 - 2)) - 1;
+                // 31 is a general limit, 2 is for unroll_regs_ = 4;
+                const size_t max_stride = (1LL << (31 - 2)) - 1;
+                if (dst_d.is_plain()) {
+                    // A strided axis is vectorized over the inner elements
+                    return bd.strides[axis()] == 1
+                            || (isa == avx512_common
+                                    && sizeof(float) * bd.strides[axis()]
+                                            < max_stride);
+                } else {
                     const int last_blk = bd.inner_nblks - 1;
                     return true && bd.inner_blks[last_blk] == blk_size
                             && bd.inner_idxs[last_blk] == axis()
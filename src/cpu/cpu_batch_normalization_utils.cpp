@@ -187,6 +187,19 @@ bool is_spatial_thr(const batch_normalization_pd_t *bdesc, bool is_nspc,
     return S_nthr > 1;
 }
 
+void accumulate_shifted_sums(
+        double &s1, double &s2, float shift, const float *x, dim_t len) {
+    double s1_l = 0, s2_l = 0;
+    PRAGMA_OMP_SIMD(reduction(+ : s1_l, s2_l))
+    for (dim_t i = 0; i < len; ++i) {
+        const double d = (double)x[i] - shift;
+        s1_l += d;
+        s2_l += d * d;
+    }
+    s1 += s1_l;
+    s2 += s2_l;
+}
+
 } // namespace bnorm_utils
 } // namespace cpu
 } // namespace impl
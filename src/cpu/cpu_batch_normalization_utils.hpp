@@ -36,6 +36,23 @@ bool thread_balance(bool do_blocking, bool spatial_thr_allowed, bool is_nhwc,
 bool is_spatial_thr(const batch_normalization_pd_t *bdesc, bool is_nhwc,
         int simd_w, int data_size);
 
+// Single-pass statistics with shifted data: the sums of the deviations of
+// the values from a shift and of their squares. With a shift close to the
+// mean, e.g. one of the values, the variance does not suffer from the
+// cancellation of the plain sum of squares. The sums are kept in double
+// precision, so the statistics are as accurate as with the two-pass
+// algorithm, and the sums of the parts of a set are merged by addition.
+void accumulate_shifted_sums(
+        double &s1, double &s2, float shift, const float *x, dim_t len);
+
+// Returns the mean and the variance of n values from their shifted sums
+inline void finalize_shifted_sums(double n, float shift, double s1, double s2,
+        float &mean, float &variance) {
+    const double d_mean = s1 / n;
+    mean = (float)(shift + d_mean);
+    variance = (float)nstl::max(0., (s2 - s1 * d_mean) / n);
+}
+
 } // namespace bnorm_utils
 } // namespace cpu
 } // namespace impl
@@ -39,6 +39,13 @@ using pd_create_f = engine_t::primitive_desc_create_f;
 namespace {
 using namespace dnnl::impl::data_type;
 
+// The configurations which still use the reference implementation:
+// - blocked bf16 without avx512_core, and blocked f32 on AArch64 without
+//   avx512_common, as the simple implementations handle plain layouts only
+// - blocked s8 and u8 without avx2 or for forward training, for the same
+//   reason
+// - bf16 and int8 on AArch64, which has no jit instances for them yet
+// - int8 backward
 // clang-format off
 static const pd_create_f impl_list[] = {
         /* fp */
@@ -68,6 +75,8 @@ static const pd_create_f impl_list[] = {
         CPU_INSTANCE_X64(jit_uni_i8i8_pooling_fwd_t<avx512_core>)
         CPU_INSTANCE_X64(jit_uni_i8i8_pooling_fwd_t<avx2>)
         //CPU_INSTANCE_AARCH64(jit_uni_i8i8_pooling_fwd_t<avx512_core>)
+        CPU_INSTANCE(nhwc_pooling_fwd_t<s8>)
+        CPU_INSTANCE(nhwc_pooling_fwd_t<u8>)
         CPU_INSTANCE(ref_pooling_fwd_t<s32>)
         CPU_INSTANCE(ref_pooling_fwd_t<s8, s32>)
         CPU_INSTANCE(ref_pooling_fwd_t<u8, s32>)
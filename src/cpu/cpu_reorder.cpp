@@ -570,7 +570,10 @@ static const impl_list_map_t comp_s8s8_impl_list_map {
 const rpd_create_f *cpu_engine_t::get_reorder_implementation_list(
         const memory_desc_t *src_md, const memory_desc_t *dst_md) const {
     const impl_list_map_t &impl_list
-            = (dst_md->extra.flags & memory_extra_flags::compensation_conv_s8s8)
+            = (dst_md->extra.flags
+                      & (memory_extra_flags::compensation_conv_s8s8
+                              | memory_extra_flags::
+                                      compensation_conv_asymmetric_src))
             ? comp_s8s8_impl_list_map
             : regular_impl_list_map;
 
@@ -21,6 +21,7 @@
 
 #if DNNL_X64
 #include "cpu/x64/jit_avx512_common_resampling.hpp"
+#include "cpu/x64/jit_uni_resampling.hpp"
 using namespace dnnl::impl::cpu::x64;
 #elif DNNL_AARCH64
 #include "cpu/aarch64/jit_avx512_common_resampling.hpp"
@@ -42,6 +43,10 @@ static const pd_create_f impl_list[] = {
         CPU_INSTANCE_X64(jit_avx512_common_resampling_fwd_t<bf16>)
         CPU_INSTANCE_X64(jit_avx512_common_resampling_bwd_t<f32>)
         CPU_INSTANCE_X64(jit_avx512_common_resampling_bwd_t<bf16>)
+        CPU_INSTANCE_X64(jit_uni_resampling_fwd_t<avx512_common>)
+        CPU_INSTANCE_X64(jit_uni_resampling_fwd_t<avx2>)
+        CPU_INSTANCE_X64(jit_uni_resampling_bwd_t<avx512_common>)
+        CPU_INSTANCE_X64(jit_uni_resampling_bwd_t<avx2>)
         CPU_INSTANCE_AARCH64(jit_avx512_common_resampling_fwd_t<f32>)
         CPU_INSTANCE_AARCH64(jit_avx512_common_resampling_fwd_t<bf16>)
         CPU_INSTANCE_AARCH64(jit_avx512_common_resampling_bwd_t<f32>)
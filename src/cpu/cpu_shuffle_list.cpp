@@ -18,6 +18,14 @@
 
 #include "cpu/ref_shuffle.hpp"
 
+#if DNNL_X64
+#include "cpu/x64/jit_uni_shuffle.hpp"
+using namespace dnnl::impl::cpu::x64;
+#elif DNNL_AARCH64
+#include "cpu/aarch64/jit_uni_shuffle.hpp"
+using namespace dnnl::impl::cpu::aarch64;
+#endif
+
 namespace dnnl {
 namespace impl {
 namespace cpu {
@@ -29,6 +37,8 @@ using namespace dnnl::impl::data_type;
 
 // clang-format off
 static const pd_create_f impl_list[] = {
+        CPU_INSTANCE_X64(jit_uni_shuffle_t<avx512_common>)
+        CPU_INSTANCE_AARCH64(jit_uni_shuffle_t<avx512_common>)
         CPU_INSTANCE(ref_shuffle_t<4>) /* f32 or s32 */
         CPU_INSTANCE(ref_shuffle_t<2>) /* bf16 */
         CPU_INSTANCE(ref_shuffle_t<1>) /* s8 or u8 */
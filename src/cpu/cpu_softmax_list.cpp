@@ -47,6 +47,10 @@ static const pd_create_f impl_list[] = {
         CPU_INSTANCE(ref_softmax_bwd_t<f32>)
         CPU_INSTANCE(ref_softmax_fwd_t<bf16>)
         CPU_INSTANCE(ref_softmax_bwd_t<bf16>)
+        CPU_INSTANCE(ref_softmax_fwd_t<f32, s8>)
+        CPU_INSTANCE(ref_softmax_fwd_t<f32, u8>)
+        CPU_INSTANCE(ref_softmax_fwd_t<bf16, s8>)
+        CPU_INSTANCE(ref_softmax_fwd_t<bf16, u8>)
         /* eol */
         nullptr,
 };
@@ -0,0 +1,91 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/dnnl_thread.hpp"
+#include "common/nstl.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/gemm/f32/gemm_small_f32.hpp"
+
+#if DNNL_X64
+#include "cpu/x64/gemm/f32/jit_avx512_core_gemm_small_f32_kern.hpp"
+#endif
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+// The largest N the small gemm is used for
+constexpr dim_t small_gemm_max_n = 16;
+// The amount of multiply-adds a thread should get at least
+constexpr dim_t small_gemm_min_work_per_thr = 32 * 1024;
+} // namespace
+
+bool gemm_small_f32_kernel_t::is_applicable(const gemm_small_f32_conf_t &conf) {
+    const bool ok = conf.m > 0 && conf.n > 0 && conf.k > 0
+            && conf.n <= small_gemm_max_n;
+    if (!ok) return false;
+
+#if DNNL_X64
+    return x64::jit_avx512_core_gemm_small_f32_applicable(conf);
+#endif
+    return false;
+}
+
+gemm_small_f32_kernel_t *gemm_small_f32_kernel_t::create(
+        const gemm_small_f32_conf_t &conf) {
+    if (!is_applicable(conf)) return nullptr;
+
+#if DNNL_X64
+    return x64::jit_avx512_core_gemm_small_f32_kern_create(conf);
+#endif
+    return nullptr;
+}
+
+void gemm_small_f32_kernel_t::execute(const float *alpha, const float *a,
+        const float *b, const float *beta, float *c) const {
+    const dim_t nblk_full = conf_.m / m_blk_;
+    const bool has_tail = conf_.m % m_blk_ != 0;
+    const dim_t nblk = nblk_full + has_tail;
+
+    const dim_t work = conf_.m * conf_.n * conf_.k;
+    const int nthr_max = dnnl_in_parallel() ? 1 : dnnl_get_max_threads();
+    const int nthr = (int)nstl::min<dim_t>(nstl::min<dim_t>(nthr_max, nblk),
+            utils::div_up(work, small_gemm_min_work_per_thr));
+
+    parallel(nthr, [&](int ithr, int nthr) {
+        dim_t start {0}, end {0};
+        balance211(nblk, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        call_params_t p;
+        p.a = a + start * a_blk_off_;
+        p.b = b;
+        p.c = c + start * m_blk_;
+        p.alpha = alpha;
+        p.beta = beta;
+        p.do_tail = has_tail && end == nblk;
+        p.nblk = end - start - p.do_tail;
+        (*this)(&p);
+    });
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,82 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_GEMM_F32_GEMM_SMALL_F32_HPP
+#define CPU_GEMM_F32_GEMM_SMALL_F32_HPP
+
+#include "dnnl_types.h"
+
+#include "common/c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Shape of a small sgemm problem (column-major, as extended_sgemm()). All the
+// fields are known at primitive creation time and are baked into the kernel.
+struct gemm_small_f32_conf_t {
+    bool transa, transb;
+    dim_t m, n, k;
+    dim_t lda, ldb, ldc;
+    bool beta_is_zero;
+};
+
+// A no-copy sgemm kernel specialized for a single problem shape. It is meant
+// for problems with a small N (e.g. inference with a small mini-batch) where
+// the thread partitioning, packing and scratch allocation of the generic gemm
+// driver dominate the run time.
+struct gemm_small_f32_kernel_t {
+    // Returns nullptr if the shape is not supported on the current platform.
+    static gemm_small_f32_kernel_t *create(const gemm_small_f32_conf_t &conf);
+
+    // Returns true if a small gemm kernel should be used for the shape.
+    static bool is_applicable(const gemm_small_f32_conf_t &conf);
+
+    virtual ~gemm_small_f32_kernel_t() = default;
+
+    // C = alpha * op(A) * op(B) + beta * C
+    void execute(const float *alpha, const float *a, const float *b,
+            const float *beta, float *c) const;
+
+    struct call_params_t {
+        const float *a, *b;
+        float *c;
+        const float *alpha, *beta;
+        // number of complete row blocks of C to process
+        dim_t nblk;
+        // process the incomplete last row block after the complete ones
+        dim_t do_tail;
+    };
+
+protected:
+    gemm_small_f32_kernel_t(const gemm_small_f32_conf_t &conf, dim_t m_blk,
+            dim_t a_blk_off)
+        : conf_(conf), m_blk_(m_blk), a_blk_off_(a_blk_off) {}
+
+    virtual void operator()(const call_params_t *p) const = 0;
+
+    gemm_small_f32_conf_t conf_;
+    // rows of C processed in one block
+    dim_t m_blk_;
+    // offset of A (in elements) between consecutive row blocks
+    dim_t a_blk_off_;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif // CPU_GEMM_F32_GEMM_SMALL_F32_HPP
@@ -17,6 +17,8 @@
 #ifndef CPU_GEMM_GEMM_HPP
 #define CPU_GEMM_GEMM_HPP
 
+#include <functional>
+
 #include "dnnl_types.h"
 
 #include "common/bfloat16.hpp"
@@ -33,12 +35,36 @@ namespace dnnl {
 namespace impl {
 namespace cpu {
 
+dnnl_status_t check_gemm_input(const char *transa, const char *transb,
+        const dim_t *M, const dim_t *N, const dim_t *K, const void *A,
+        const dim_t *lda, const void *B, const dim_t *ldb, const void *C,
+        const dim_t *ldc, const float *alpha, const float *beta,
+        const bool with_bias);
+
 dnnl_status_t extended_sgemm(const char *transa, const char *transb,
         const dim_t *M, const dim_t *N, const dim_t *K, const float *alpha,
         const float *A, const dim_t *lda, const float *B, const dim_t *ldb,
         const float *beta, float *C, const dim_t *ldc,
         const float *bias = nullptr, bool force_jit_gemm = false);
 
+// Batched sgemm: C_i = alpha * op(A_i) * op(B_i) + beta * C_i, for
+// i = 0 .. batch - 1, with A_i = A + i * stride_a (same for B and C).
+// The whole (batch, M, N) space is partitioned in a single parallel region.
+// A zero stride_a (stride_b) means the matrix is shared by all batch entries.
+dnnl_status_t extended_sgemm_batch(const char *transa, const char *transb,
+        const dim_t *M, const dim_t *N, const dim_t *K, const float *alpha,
+        const float *A, const dim_t *lda, const dim_t *stride_a,
+        const float *B, const dim_t *ldb, const dim_t *stride_b,
+        const float *beta, float *C, const dim_t *ldc, const dim_t *stride_c,
+        const dim_t *batch, const float *bias = nullptr);
+
+// Pointer-array variant of the batched sgemm above.
+dnnl_status_t extended_sgemm_batch(const char *transa, const char *transb,
+        const dim_t *M, const dim_t *N, const dim_t *K, const float *alpha,
+        const float *const *A, const dim_t *lda, const float *const *B,
+        const dim_t *ldb, const float *beta, float *const *C, const dim_t *ldc,
+        const dim_t *batch, const float *bias = nullptr);
+
 template <typename b_dt>
 dnnl_status_t gemm_s8x8s32(const char *transa, const char *transb,
         const char *offsetc, const dim_t *M, const dim_t *N, const dim_t *K,
@@ -46,6 +72,28 @@ dnnl_status_t gemm_s8x8s32(const char *transa, const char *transb,
         const b_dt *B, const dim_t *ldb, const b_dt *bo, const float *beta,
         int32_t *c, const dim_t *ldc, const int32_t *co);
 
+// Post-processing (bias, scales, post-ops) of the *_epilogue gemm variants
+// below. It is called with a range [start, end) of elements of a dense C
+// (ldc == M) as soon as the range holds final values, while it is still
+// resident in cache. This saves a separate pass over the whole C.
+using gemm_epilogue_t = std::function<void(dim_t start, dim_t end)>;
+
+// Same as extended_sgemm() followed by the epilogue applied to all of C.
+dnnl_status_t extended_sgemm_epilogue(const char *transa, const char *transb,
+        const dim_t *M, const dim_t *N, const dim_t *K, const float *alpha,
+        const float *A, const dim_t *lda, const float *B, const dim_t *ldb,
+        const float *beta, float *C, const dim_t *ldc,
+        const gemm_epilogue_t &epilogue);
+
+// Same as gemm_s8x8s32() followed by the epilogue applied to all of C.
+template <typename b_dt>
+dnnl_status_t gemm_s8x8s32_epilogue(const char *transa, const char *transb,
+        const char *offsetc, const dim_t *M, const dim_t *N, const dim_t *K,
+        const float *alpha, const int8_t *A, const dim_t *lda, const int8_t *ao,
+        const b_dt *B, const dim_t *ldb, const b_dt *bo, const float *beta,
+        int32_t *C, const dim_t *ldc, const int32_t *co,
+        const gemm_epilogue_t &epilogue);
+
 dnnl_status_t gemm_bf16bf16f32(const char *transa, const char *transb,
         const dim_t *M, const dim_t *N, const dim_t *K, const float *alpha,
         const bfloat16_t *A, const dim_t *lda, const bfloat16_t *B,
@@ -0,0 +1,192 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/nstl.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/gemm/gemm.hpp"
+#include "cpu/gemm/gemm_tile_partition.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+
+// Computes all (batch, M-block, N-block) tiles in one parallel region. The
+// iteration order keeps the block of a shared (batch-invariant) matrix in the
+// outermost position, so consecutive tiles of a thread reuse it from cache.
+template <typename get_a_t, typename get_b_t, typename get_c_t>
+dnnl_status_t gemm_batch_driver(const char *transa, const char *transb,
+        dim_t M, dim_t N, dim_t K, const float *alpha, get_a_t get_a,
+        const dim_t *lda, get_b_t get_b, const dim_t *ldb, const float *beta,
+        get_c_t get_c, const dim_t *ldc, dim_t batch, const float *bias,
+        bool shared_a, bool shared_b) {
+    const bool is_trans_a = utils::one_of(*transa, 'T', 't');
+    const bool is_trans_b = utils::one_of(*transb, 'T', 't');
+
+    const int nthr = dnnl_in_parallel() ? 1 : dnnl_get_max_threads();
+    const gemm_tile_partition_t p(batch, M, N, nthr);
+    const dim_t nitems = p.nitems();
+
+    std::atomic<dnnl_status_t> st(dnnl_success);
+
+    parallel((int)nstl::min<dim_t>(nthr, nitems), [&](int ithr, int nthr) {
+        dim_t start {0}, end {0};
+        balance211(nitems, nthr, ithr, start, end);
+
+        for (dim_t iwork = start; iwork < end; ++iwork) {
+            dim_t ib, im, in;
+            if (shared_a) {
+                // (m, batch, n)
+                in = iwork % p.nblk_n;
+                ib = (iwork / p.nblk_n) % batch;
+                im = iwork / (p.nblk_n * batch);
+            } else if (shared_b) {
+                // (n, batch, m)
+                im = iwork % p.nblk_m;
+                ib = (iwork / p.nblk_m) % batch;
+                in = iwork / (p.nblk_m * batch);
+            } else {
+                // (batch, n, m)
+                im = iwork % p.nblk_m;
+                in = (iwork / p.nblk_m) % p.nblk_n;
+                ib = iwork / (p.nblk_m * p.nblk_n);
+            }
+
+            const dim_t m0 = im * p.blk_m;
+            const dim_t n0 = in * p.blk_n;
+            const dim_t m_tile = nstl::min(p.blk_m, M - m0);
+            const dim_t n_tile = nstl::min(p.blk_n, N - n0);
+
+            const float *a = get_a(ib) + (is_trans_a ? m0 * *lda : m0);
+            const float *b = get_b(ib) + (is_trans_b ? n0 : n0 * *ldb);
+            float *c = get_c(ib) + m0 + n0 * *ldc;
+
+            dnnl_status_t st_thr = extended_sgemm(transa, transb, &m_tile,
+                    &n_tile, &K, alpha, a, lda, b, ldb, beta, c, ldc,
+                    bias ? bias + m0 : nullptr, false);
+            if (st_thr != dnnl_success) {
+                st = st_thr;
+                return;
+            }
+        }
+    });
+
+    return st;
+}
+
+dnnl_status_t check_gemm_batch_input(const char *transa, const char *transb,
+        const dim_t *M, const dim_t *N, const dim_t *K, const void *A,
+        const dim_t *lda, const void *B, const dim_t *ldb, const void *C,
+        const dim_t *ldc, const float *alpha, const float *beta,
+        const dim_t *batch, const bool with_bias) {
+    if (batch == nullptr || *batch < 0) return dnnl_invalid_arguments;
+    // Packed matrices are not supported by the batched interface
+    if (transa == nullptr || transb == nullptr
+            || !utils::one_of(*transa, 'T', 't', 'N', 'n')
+            || !utils::one_of(*transb, 'T', 't', 'N', 'n'))
+        return dnnl_invalid_arguments;
+    return check_gemm_input(transa, transb, M, N, K, A, lda, B, ldb, C, ldc,
+            alpha, beta, with_bias);
+}
+
+} // namespace
+
+dnnl_status_t extended_sgemm_batch(const char *transa, const char *transb,
+        const dim_t *M, const dim_t *N, const dim_t *K, const float *alpha,
+        const float *A, const dim_t *lda, const dim_t *stride_a,
+        const float *B, const dim_t *ldb, const dim_t *stride_b,
+        const float *beta, float *C, const dim_t *ldc, const dim_t *stride_c,
+        const dim_t *batch, const float *bias) {
+    dnnl_status_t status = check_gemm_batch_input(transa, transb, M, N, K, A,
+            lda, B, ldb, C, ldc, alpha, beta, batch, bias != nullptr);
+    if (status != dnnl_success) return status;
+    if (utils::any_null(stride_a, stride_b, stride_c))
+        return dnnl_invalid_arguments;
+
+    if (*batch == 0 || *M == 0 || *N == 0) return dnnl_success;
+    if (*batch == 1)
+        return extended_sgemm(transa, transb, M, N, K, alpha, A, lda, B, ldb,
+                beta, C, ldc, bias, false);
+
+    // When A is shared and the batch entries of B and C follow each other
+    // along N, the whole batch is a single gemm with N' = batch * N. The
+    // underlying driver then packs A once for all batch entries.
+    const bool is_trans_b = utils::one_of(*transb, 'T', 't');
+    if (*stride_a == 0 && !is_trans_b && *stride_b == *N * *ldb
+            && *stride_c == *N * *ldc) {
+        const dim_t N_batch = *batch * *N;
+        return extended_sgemm(transa, transb, M, &N_batch, K, alpha, A, lda, B,
+                ldb, beta, C, ldc, bias, false);
+    }
+
+    const dim_t sa = *stride_a, sb = *stride_b, sc = *stride_c;
+    return gemm_batch_driver(
+            transa, transb, *M, *N, *K, alpha,
+            [&](dim_t i) { return A + i * sa; }, lda,
+            [&](dim_t i) { return B + i * sb; }, ldb, beta,
+            [&](dim_t i) { return C + i * sc; }, ldc, *batch, bias, sa == 0,
+            sb == 0);
+}
+
+dnnl_status_t extended_sgemm_batch(const char *transa, const char *transb,
+        const dim_t *M, const dim_t *N, const dim_t *K, const float *alpha,
+        const float *const *A, const dim_t *lda, const float *const *B,
+        const dim_t *ldb, const float *beta, float *const *C, const dim_t *ldc,
+        const dim_t *batch, const float *bias) {
+    if (utils::any_null(A, B, C)) return dnnl_invalid_arguments;
+    dnnl_status_t status = check_gemm_batch_input(transa, transb, M, N, K,
+            A[0], lda, B[0], ldb, C[0], ldc, alpha, beta, batch,
+            bias != nullptr);
+    if (status != dnnl_success) return status;
+
+    if (*batch == 0 || *M == 0 || *N == 0) return dnnl_success;
+
+    // Pointer arrays with constant strides (including zero strides for
+    // shared matrices) are dispatched to the strided variant.
+    bool fixed_strides = true;
+    const dim_t sa = *batch > 1 ? A[1] - A[0] : 0;
+    const dim_t sb = *batch > 1 ? B[1] - B[0] : 0;
+    const dim_t sc = *batch > 1 ? C[1] - C[0] : 0;
+    for (dim_t i = 1; i < *batch && fixed_strides; ++i)
+        fixed_strides = A[i] - A[i - 1] == sa && B[i] - B[i - 1] == sb
+                && C[i] - C[i - 1] == sc;
+    if (fixed_strides)
+        return extended_sgemm_batch(transa, transb, M, N, K, alpha, A[0], lda,
+                &sa, B[0], ldb, &sb, beta, C[0], ldc, &sc, batch, bias);
+
+    bool shared_a = true, shared_b = true;
+    for (dim_t i = 1; i < *batch; ++i) {
+        shared_a = shared_a && A[i] == A[0];
+        shared_b = shared_b && B[i] == B[0];
+    }
+
+    return gemm_batch_driver(
+            transa, transb, *M, *N, *K, alpha,
+            [&](dim_t i) { return A[i]; }, lda,
+            [&](dim_t i) { return B[i]; }, ldb, beta,
+            [&](dim_t i) { return C[i]; }, ldc, *batch, bias, shared_a,
+            shared_b);
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
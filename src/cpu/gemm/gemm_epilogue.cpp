@@ -0,0 +1,165 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/nstl.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/gemm/gemm.hpp"
+#include "cpu/gemm/gemm_tile_partition.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+
+// Computes C tile by tile in one parallel region and applies the epilogue to
+// every tile right after it is computed. A tile is limited to half of the
+// per-core L2, so the epilogue reads it from cache. gemm_tile is called with
+// (m0, n0, m, n) and computes C(m0:m0+m, n0:n0+n).
+template <typename c_type, typename gemm_tile_t>
+dnnl_status_t gemm_epilogue_driver(dim_t M, dim_t N, dim_t ldc,
+        gemm_tile_t gemm_tile, const gemm_epilogue_t &epilogue) {
+    // ranges passed to the epilogue are linear only for a dense C
+    if (ldc != M) return dnnl_invalid_arguments;
+    if (M == 0 || N == 0) return dnnl_success;
+
+    const int nthr = dnnl_in_parallel() ? 1 : dnnl_get_max_threads();
+    const size_t max_tile_size = platform::get_per_core_cache_size(2) / 2;
+    const gemm_tile_partition_t p(
+            1, M, N, nthr, sizeof(c_type), max_tile_size);
+    const dim_t nitems = p.nitems();
+
+    std::atomic<dnnl_status_t> st(dnnl_success);
+
+    parallel((int)nstl::min<dim_t>(nthr, nitems), [&](int ithr, int nthr) {
+        dim_t start {0}, end {0};
+        balance211(nitems, nthr, ithr, start, end);
+
+        for (dim_t iwork = start; iwork < end; ++iwork) {
+            const dim_t im = iwork % p.nblk_m;
+            const dim_t in = iwork / p.nblk_m;
+
+            const dim_t m0 = im * p.blk_m;
+            const dim_t n0 = in * p.blk_n;
+            const dim_t m_tile = nstl::min(p.blk_m, M - m0);
+            const dim_t n_tile = nstl::min(p.blk_n, N - n0);
+
+            dnnl_status_t st_thr = gemm_tile(m0, n0, m_tile, n_tile);
+            if (st_thr != dnnl_success) {
+                st = st_thr;
+                return;
+            }
+
+            // a tile that spans all the rows is a single contiguous range
+            if (m_tile == M)
+                epilogue(n0 * ldc, (n0 + n_tile) * ldc);
+            else
+                for (dim_t n = n0; n < n0 + n_tile; ++n)
+                    epilogue(n * ldc + m0, n * ldc + m0 + m_tile);
+        }
+    });
+
+    return st;
+}
+
+} // namespace
+
+dnnl_status_t extended_sgemm_epilogue(const char *transa, const char *transb,
+        const dim_t *M, const dim_t *N, const dim_t *K, const float *alpha,
+        const float *A, const dim_t *lda, const float *B, const dim_t *ldb,
+        const float *beta, float *C, const dim_t *ldc,
+        const gemm_epilogue_t &epilogue) {
+    dnnl_status_t status = check_gemm_input(transa, transb, M, N, K, A, lda, B,
+            ldb, C, ldc, alpha, beta, false);
+    if (status != dnnl_success) return status;
+    // packed matrices encode the partitioning of the whole problem
+    if (!utils::one_of(*transa, 'T', 't', 'N', 'n')
+            || !utils::one_of(*transb, 'T', 't', 'N', 'n'))
+        return dnnl_invalid_arguments;
+
+    const bool is_trans_a = utils::one_of(*transa, 'T', 't');
+    const bool is_trans_b = utils::one_of(*transb, 'T', 't');
+
+    return gemm_epilogue_driver<float>(
+            *M, *N, *ldc,
+            [&](dim_t m0, dim_t n0, dim_t m, dim_t n) {
+                const float *a = A + (is_trans_a ? m0 * *lda : m0);
+                const float *b = B + (is_trans_b ? n0 : n0 * *ldb);
+                float *c = C + m0 + n0 * *ldc;
+                return extended_sgemm(transa, transb, &m, &n, K, alpha, a, lda,
+                        b, ldb, beta, c, ldc, nullptr, false);
+            },
+            epilogue);
+}
+
+template <typename b_dt>
+dnnl_status_t gemm_s8x8s32_epilogue(const char *transa, const char *transb,
+        const char *offsetc, const dim_t *M, const dim_t *N, const dim_t *K,
+        const float *alpha, const int8_t *A, const dim_t *lda, const int8_t *ao,
+        const b_dt *B, const dim_t *ldb, const b_dt *bo, const float *beta,
+        int32_t *C, const dim_t *ldc, const int32_t *co,
+        const gemm_epilogue_t &epilogue) {
+    dnnl_status_t status = check_gemm_input(transa, transb, M, N, K, A, lda, B,
+            ldb, C, ldc, alpha, beta, false);
+    if (status != dnnl_success) return status;
+    if (!utils::one_of(*transa, 'T', 't', 'N', 'n')
+            || !utils::one_of(*transb, 'T', 't', 'N', 'n'))
+        return dnnl_invalid_arguments;
+    if (offsetc == nullptr) return dnnl_invalid_arguments;
+
+    const bool is_trans_a = utils::one_of(*transa, 'T', 't');
+    const bool is_trans_b = utils::one_of(*transb, 'T', 't');
+    const bool is_col_offset = utils::one_of(*offsetc, 'C', 'c');
+    const bool is_row_offset = utils::one_of(*offsetc, 'R', 'r');
+
+    return gemm_epilogue_driver<int32_t>(
+            *M, *N, *ldc,
+            [&](dim_t m0, dim_t n0, dim_t m, dim_t n) {
+                const int8_t *a = A + (is_trans_a ? m0 * *lda : m0);
+                const b_dt *b = B + (is_trans_b ? n0 : n0 * *ldb);
+                int32_t *c = C + m0 + n0 * *ldc;
+                const int32_t *c_off
+                        = co + (is_col_offset ? m0 : is_row_offset ? n0 : 0);
+                return gemm_s8x8s32(transa, transb, offsetc, &m, &n, K, alpha,
+                        a, lda, ao, b, ldb, bo, beta, c, ldc, c_off);
+            },
+            epilogue);
+}
+
+template dnnl_status_t gemm_s8x8s32_epilogue<int8_t>(const char *transa,
+        const char *transb, const char *offsetc, const dim_t *M, const dim_t *N,
+        const dim_t *K, const float *alpha, const int8_t *A, const dim_t *lda,
+        const int8_t *ao, const int8_t *B, const dim_t *ldb, const int8_t *bo,
+        const float *beta, int32_t *C, const dim_t *ldc, const int32_t *co,
+        const gemm_epilogue_t &epilogue);
+
+template dnnl_status_t gemm_s8x8s32_epilogue<uint8_t>(const char *transa,
+        const char *transb, const char *offsetc, const dim_t *M, const dim_t *N,
+        const dim_t *K, const float *alpha, const int8_t *A, const dim_t *lda,
+        const int8_t *ao, const uint8_t *B, const dim_t *ldb, const uint8_t *bo,
+        const float *beta, int32_t *C, const dim_t *ldc, const int32_t *co,
+        const gemm_epilogue_t &epilogue);
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,70 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_GEMM_GEMM_TILE_PARTITION_HPP
+#define CPU_GEMM_GEMM_TILE_PARTITION_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Partitioning of the (batch, M, N) space of C into tiles that are computed
+// by independent single-threaded gemm calls.
+struct gemm_tile_partition_t {
+    // Minimal sizes of a C tile: splitting below these makes the per-tile
+    // packing overhead of the underlying gemm dominate.
+    static constexpr dim_t min_blk_m = 64;
+    static constexpr dim_t min_blk_n = 32;
+
+    dim_t batch, nblk_m, nblk_n, blk_m, blk_n;
+
+    // Splits the larger C dimension in halves until every thread has at
+    // least one tile and a tile takes at most max_tile_size bytes (if
+    // non-zero), or the tiles become too small.
+    gemm_tile_partition_t(dim_t batch, dim_t M, dim_t N, int nthr,
+            size_t c_dt_size = 0, size_t max_tile_size = 0)
+        : batch(batch), nblk_m(1), nblk_n(1), blk_m(M), blk_n(N) {
+        auto tile_is_too_big = [&]() {
+            return max_tile_size > 0
+                    && (size_t)(blk_m * blk_n) * c_dt_size > max_tile_size;
+        };
+        while (nitems() < nthr || tile_is_too_big()) {
+            const bool can_split_m = blk_m >= 2 * min_blk_m;
+            const bool can_split_n = blk_n >= 2 * min_blk_n;
+            if (can_split_m && (blk_m >= blk_n || !can_split_n)) {
+                nblk_m *= 2;
+                blk_m = utils::rnd_up(utils::div_up(M, nblk_m), 16);
+                nblk_m = utils::div_up(M, blk_m);
+            } else if (can_split_n) {
+                nblk_n *= 2;
+                blk_n = utils::div_up(N, nblk_n);
+                nblk_n = utils::div_up(N, blk_n);
+            } else
+                break;
+        }
+    }
+
+    dim_t nitems() const { return batch * nblk_m * nblk_n; }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif // CPU_GEMM_GEMM_TILE_PARTITION_HPP
@@ -264,7 +264,7 @@ template void transpose_dt(const conv_gemm_conf_t &jcp,
 template <typename orig_im_dt, typename orig_col_dt>
 void im2col_dt_3d(const conv_gemm_conf_t &jcp,
         const orig_im_dt *__restrict _imtr, orig_col_dt *__restrict _col,
-        int od) {
+        int od, int32_t src_zero_point) {
     // For performance reasons, use uint16_t as a proxy for bfloat16_t
     using im_dt = typename utils::conditional<data_traits<orig_im_dt>::data_type
                     == bf16,
@@ -278,6 +278,7 @@ void im2col_dt_3d(const conv_gemm_conf_t &jcp,
     col_dt *__restrict col = reinterpret_cast<col_dt *__restrict>(_col);
 
     col_dt shift = static_cast<col_dt>(jcp.signed_input ? 128 : 0);
+    col_dt pad_value = static_cast<col_dt>(shift + src_zero_point);
     const int dd = 1 + jcp.dilate_d;
     const int dh = 1 + jcp.dilate_h;
     const int dw = 1 + jcp.dilate_w;
@@ -302,7 +303,7 @@ void im2col_dt_3d(const conv_gemm_conf_t &jcp,
                     const int id = od - fp + kd;
                     if (id < 0 || id >= jcp.id) {
                         for (ptrdiff_t i = 0; i < OHW; i++)
-                            col_loc[i] = shift;
+                            col_loc[i] = pad_value;
                         return;
                     }
                     const im_dt *__restrict imtr_loc
@@ -329,7 +330,7 @@ void im2col_dt_3d(const conv_gemm_conf_t &jcp,
                     const int id = od * 2 - fp + kd;
                     if (id < 0 || id >= jcp.id) {
                         for (ptrdiff_t i = 0; i < OHW; i++)
-                            col_loc[i] = shift;
+                            col_loc[i] = pad_value;
                         return;
                     }
                     const im_dt *__restrict imtr_loc
@@ -360,7 +361,7 @@ void im2col_dt_3d(const conv_gemm_conf_t &jcp,
                     const int id = od * sd - fp + kd * dd;
                     if (id < 0 || id >= jcp.id) {
                         for (ptrdiff_t i = 0; i < OHW; i++)
-                            col_loc[i] = shift;
+                            col_loc[i] = pad_value;
                         return;
                     }
                     const im_dt *__restrict imtr_loc
@@ -387,13 +388,17 @@ void im2col_dt_3d(const conv_gemm_conf_t &jcp,
 }
 
 template void im2col_dt_3d<int8_t, uint8_t>(const conv_gemm_conf_t &jcp,
-        const int8_t *__restrict im, uint8_t *__restrict col, int od);
+        const int8_t *__restrict im, uint8_t *__restrict col, int od,
+        int32_t src_zero_point);
 template void im2col_dt_3d<uint8_t, uint8_t>(const conv_gemm_conf_t &jcp,
-        const uint8_t *__restrict im, uint8_t *__restrict col, int od);
+        const uint8_t *__restrict im, uint8_t *__restrict col, int od,
+        int32_t src_zero_point);
 template void im2col_dt_3d<float, float>(const conv_gemm_conf_t &jcp,
-        const float *__restrict im, float *__restrict col, int od);
+        const float *__restrict im, float *__restrict col, int od,
+        int32_t src_zero_point);
 template void im2col_dt_3d<bfloat16_t, bfloat16_t>(const conv_gemm_conf_t &jcp,
-        const bfloat16_t *__restrict im, bfloat16_t *__restrict col, int od);
+        const bfloat16_t *__restrict im, bfloat16_t *__restrict col, int od,
+        int32_t src_zero_point);
 
 /* col[ic][kh][kw][oh][ow] <-- im2col(im[ic][ih][iw]) */
 template <typename data_type_t>
@@ -566,7 +571,7 @@ template void im2col(const conv_gemm_conf_t &jcp,
 template <typename orig_im_dt, typename orig_col_dt>
 void im2col_dt(const conv_gemm_conf_t &jcp, const orig_im_dt *__restrict _im,
         orig_im_dt *__restrict _imtr, orig_col_dt *__restrict _col, int hs,
-        int hb, int ws, int wb) {
+        int hb, int ws, int wb, int32_t src_zero_point) {
     // For performance reasons, use uint16_t as a proxy for bfloat16_t
     using im_dt = typename utils::conditional<data_traits<orig_im_dt>::data_type
                     == bf16,
@@ -580,6 +585,7 @@ void im2col_dt(const conv_gemm_conf_t &jcp, const orig_im_dt *__restrict _im,
     col_dt *__restrict col = reinterpret_cast<col_dt *__restrict>(_col);
 
     col_dt shift = static_cast<col_dt>(jcp.signed_input ? 128 : 0);
+    col_dt pad_value = static_cast<col_dt>(shift + src_zero_point);
     const int dh = 1 + jcp.dilate_h;
     const int dw = 1 + jcp.dilate_w;
     const int sh = jcp.stride_h;
@@ -637,23 +643,23 @@ void im2col_dt(const conv_gemm_conf_t &jcp, const orig_im_dt *__restrict _im,
                     for (int oh = 0; oh < oh_start; oh++) {
                         const ptrdiff_t col_idx_oh = col_idx_ic + oh * wb;
                         for (int ow = 0; ow < wb; ++ow)
-                            col[col_idx_oh + ow] = shift;
+                            col[col_idx_oh + ow] = pad_value;
                     }
                     for (int oh = oh_start; oh < oh_end; oh++) {
                         const ptrdiff_t col_idx_oh = col_idx_ic + oh * wb;
                         const ptrdiff_t imtr_idx_oh = imtr_idx_ic + oh * iwb;
                         for (int ow = 0; ow < ow_start; ++ow)
-                            col[col_idx_oh + ow] = shift;
+                            col[col_idx_oh + ow] = pad_value;
                         for (int ow = ow_start; ow < ow_end; ++ow)
                             col[col_idx_oh + ow]
                                     = imtr[imtr_idx_oh + ow] + shift;
                         for (int ow = ow_end; ow < wb; ++ow)
-                            col[col_idx_oh + ow] = shift;
+                            col[col_idx_oh + ow] = pad_value;
                     }
                     for (int oh = oh_end; oh < hb; oh++) {
                         const ptrdiff_t col_idx_oh = col_idx_ic + oh * wb;
                         for (int ow = 0; ow < wb; ++ow)
-                            col[col_idx_oh + ow] = shift;
+                            col[col_idx_oh + ow] = pad_value;
                     }
                 }
             }
@@ -668,7 +674,7 @@ void im2col_dt(const conv_gemm_conf_t &jcp, const orig_im_dt *__restrict _im,
                             * wb;
                     if (ih < 0 || ih >= jcp.ih)
                         for (int ow = 0; ow < wb; ow++)
-                            col[col_idx_base + ow] = shift;
+                            col[col_idx_base + ow] = pad_value;
                     else {
                         const int wp = lp - kw * dw;
                         const int ow_start
@@ -676,7 +682,7 @@ void im2col_dt(const conv_gemm_conf_t &jcp, const orig_im_dt *__restrict _im,
                         const int ow_end
                                 = saturate(0, wb, div_up(jcp.iw + wp, sw) - ws);
                         for (int ow = 0; ow < ow_start; ow++)
-                            col[col_idx_base + ow] = shift;
+                            col[col_idx_base + ow] = pad_value;
                         const int iw_base = ws * sw - wp;
                         const ptrdiff_t im_idx_base = ih * im_ih_stride + ic;
                         for (int ow = ow_start; ow < ow_end; ow++) {
@@ -686,7 +692,7 @@ void im2col_dt(const conv_gemm_conf_t &jcp, const orig_im_dt *__restrict _im,
                             col[col_idx_base + ow] = im[im_idx] + shift;
                         }
                         for (int ow = ow_end; ow < wb; ow++)
-                            col[col_idx_base + ow] = shift;
+                            col[col_idx_base + ow] = pad_value;
                     }
                 });
     }
@@ -694,17 +700,21 @@ void im2col_dt(const conv_gemm_conf_t &jcp, const orig_im_dt *__restrict _im,
 
 template void im2col_dt<int8_t, uint8_t>(const conv_gemm_conf_t &jcp,
         const int8_t *__restrict im, int8_t *__restrict imtr,
-        uint8_t *__restrict col, int hs, int hb, int ws, int wb);
+        uint8_t *__restrict col, int hs, int hb, int ws, int wb,
+        int32_t src_zero_point);
 template void im2col_dt<uint8_t, uint8_t>(const conv_gemm_conf_t &jcp,
         const uint8_t *__restrict im, uint8_t *__restrict imtr,
-        uint8_t *__restrict col, int hs, int hb, int ws, int wb);
+        uint8_t *__restrict col, int hs, int hb, int ws, int wb,
+        int32_t src_zero_point);
 template void im2col_dt<float, float>(const conv_gemm_conf_t &jcp,
         const float *__restrict im, float *__restrict imtr,
-        float *__restrict col, int hs, int hb, int ws, int wb);
+        float *__restrict col, int hs, int hb, int ws, int wb,
+        int32_t src_zero_point);
 
 template void im2col_dt<bfloat16_t, bfloat16_t>(const conv_gemm_conf_t &jcp,
         const bfloat16_t *__restrict im, bfloat16_t *__restrict imtr,
-        bfloat16_t *__restrict col, int hs, int hb, int ws, int wb);
+        bfloat16_t *__restrict col, int hs, int hb, int ws, int wb,
+        int32_t src_zero_point);
 
 /* im[id][ih][iw][ic] <-- col2im_dt_3d(col[od][oh][ow][kd][kh][kw][ic]) */
 template <typename orig_T>
@@ -1040,6 +1050,10 @@ status_t init_conf(conv_gemm_conf_t &jcp,
     jcp.ks = jcp.kh * jcp.kw * jcp.kd;
 
     jcp.signed_input = src_d.data_type() == data_type::s8;
+    jcp.with_src_zero_point
+            = !attr.zero_points_.has_default_values(DNNL_ARG_SRC);
+    jcp.with_dst_zero_point
+            = !attr.zero_points_.has_default_values(DNNL_ARG_DST);
 
     jcp.outer_threading = false;
 
@@ -1092,6 +1106,12 @@ status_t init_conf(conv_gemm_conf_t &jcp,
             want_wei_md.extra.scale_adjust
                     = platform::s8s8_weights_scale_factor();
         }
+        if (jcp.with_src_zero_point) {
+            want_wei_md.extra.flags
+                    |= memory_extra_flags::compensation_conv_asymmetric_src;
+            want_wei_md.extra.asymm_compensation_mask
+                    = (1 << 0) + (with_groups ? (1 << 1) : 0);
+        }
         if (weights_md.format_kind == format_kind::any) {
             weights_md = want_wei_md;
             return status::success;
@@ -1298,6 +1318,9 @@ status_t init_conf(conv_gemm_conf_t &jcp,
                     jcp.nthr * jcp.oh_block * jcp.ow_block * jcp.oc);
             scratchpad.book<int8_t>(
                     key_conv_gemm_imtr, jcp.nthr * jcp.id * jcp.is * jcp.ic);
+            if (jcp.with_src_zero_point)
+                scratchpad.book<int32_t>(
+                        key_conv_zp_src_comp, jcp.ngroups * jcp.oc);
         } else if (is_bwd_d) {
             jcp.im2col_sz
                     = !everyone_is(true, jcp.ow == jcp.iw, jcp.oh == jcp.ih,
@@ -49,6 +49,7 @@ struct conv_gemm_conf_t {
     ptrdiff_t im2col_sz;
     bool need_wei_reduction;
     bool signed_input;
+    bool with_src_zero_point, with_dst_zero_point;
     int oh_block;
     int ow_block;
     int os_block, os_nb_block;
@@ -66,9 +67,11 @@ template <typename T>
 void transpose_dt(const conv_gemm_conf_t &jcp, const T *__restrict im,
         T *__restrict imtr);
 
+// The padded area of col holds the source zero point (0 by default), so it
+// does not contribute to the convolution of the zero-point-adjusted source.
 template <typename im_dt, typename col_dt>
 void im2col_dt_3d(const conv_gemm_conf_t &jcp, const im_dt *__restrict im,
-        col_dt *__restrict col, int od);
+        col_dt *__restrict col, int od, int32_t src_zero_point = 0);
 
 template <typename data_type_t>
 void im2col(const conv_gemm_conf_t &jcp, const data_type_t *__restrict im,
@@ -77,7 +80,7 @@ void im2col(const conv_gemm_conf_t &jcp, const data_type_t *__restrict im,
 template <typename im_dt, typename col_dt>
 void im2col_dt(const conv_gemm_conf_t &jcp, const im_dt *__restrict im,
         im_dt *__restrict imtr, col_dt *__restrict col, int hs, int hb, int ws,
-        int wb);
+        int wb, int32_t src_zero_point = 0);
 
 template <typename T>
 void col2im_dt(
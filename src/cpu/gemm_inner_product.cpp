@@ -49,11 +49,23 @@ status_t gemm_inner_product_fwd_t<data_type>::execute_forward(
     const float *scales = pd()->attr()->output_scales_.scales_;
 
     float alpha = 1.;
-    status_t st = extended_sgemm(wei_tr ? "T" : "N", "N", &OC, &MB, &IC, &alpha,
-            weights, wei_tr ? &IC : &OC, src, &IC, &beta_, dst, &OC,
-            postops_in_ip_ ? nullptr : bias);
-
-    if (st != status::success) return st;
+    if (small_gemm_)
+        small_gemm_->execute(&alpha, weights, src, &beta_, dst);
+    else if (postops_in_ip_ && !pp_kernel_->sequential_kernel()) {
+        // apply the post-processing to the tiles of dst while they are
+        // still in cache
+        return extended_sgemm_epilogue(wei_tr ? "T" : "N", "N", &OC, &MB, &IC,
+                &alpha, weights, wei_tr ? &IC : &OC, src, &IC, &beta_, dst,
+                &OC, [&](dim_t start, dim_t end) {
+                    (*pp_kernel_)(dst, dst, (char *)bias, scales, start, end,
+                            0, nullptr);
+                });
+    } else {
+        status_t st = extended_sgemm(wei_tr ? "T" : "N", "N", &OC, &MB, &IC,
+                &alpha, weights, wei_tr ? &IC : &OC, src, &IC, &beta_, dst,
+                &OC, postops_in_ip_ ? nullptr : bias);
+        if (st != status::success) return st;
+    }
 
     if (postops_in_ip_) {
         const bool force_sequential = pp_kernel_->sequential_kernel();
@@ -26,6 +26,7 @@
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/gemm/f32/gemm_small_f32.hpp"
 #include "cpu/gemm/gemm.hpp"
 #include "cpu/gemm_inner_product_utils.hpp"
 
@@ -87,6 +88,30 @@ struct gemm_inner_product_fwd_t : public primitive_t {
                              : 0.0;
     }
 
+    status_t init(engine_t *engine) override {
+        const dim_t MB = pd()->MB();
+        const dim_t OC = pd()->OC();
+        const dim_t IC = pd()->IC_total_padded();
+        const bool wei_tr = pd()->weights_md()->format_desc.blocking.strides[0]
+                != 1;
+
+        // same problem as the gemm call in execute_forward()
+        gemm_small_f32_conf_t conf;
+        conf.transa = wei_tr;
+        conf.transb = false;
+        conf.m = OC;
+        conf.n = MB;
+        conf.k = IC;
+        conf.lda = wei_tr ? IC : OC;
+        conf.ldb = IC;
+        conf.ldc = OC;
+        conf.beta_is_zero = beta_ == 0.f;
+
+        if (data_type == data_type::f32)
+            small_gemm_.reset(gemm_small_f32_kernel_t::create(conf));
+        return status::success;
+    }
+
     typedef typename prec_traits<data_type>::type data_t;
 
     status_t execute(const exec_ctx_t &ctx) const override {
@@ -99,6 +124,8 @@ private:
 
     using pp_kernel_t = inner_product_utils::pp_kernel_t<data_type, data_type>;
     std::unique_ptr<pp_kernel_t> pp_kernel_;
+    // kernel specialized for the problem shape, used if the shape is small
+    std::unique_ptr<gemm_small_f32_kernel_t> small_gemm_;
     bool postops_in_ip_;
     float beta_;
 };
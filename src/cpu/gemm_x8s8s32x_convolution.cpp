@@ -22,6 +22,7 @@
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/cpu_primitive.hpp"
 #include "cpu/simple_q10n.hpp"
 
 #include "cpu/gemm/gemm.hpp"
@@ -43,17 +44,36 @@ status_t _gemm_x8s8s32x_convolution_fwd_t<src_type, dst_type>::execute_forward(
     auto bia_base = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
     auto dst_base = CTX_OUT_MEM(dst_data_t *, DNNL_ARG_DST);
 
+    DEFINE_ZERO_POINT_VALUE(src_zero_point, DNNL_ARG_SRC);
+    DEFINE_ZERO_POINT_VALUE(dst_zero_point, DNNL_ARG_DST);
+
     auto scratchpad = ctx.get_scratchpad_grantor();
 
     const conv_gemm_conf_t &jcp = this->pd()->jcp_;
 
     assert(IMPLICATION(jcp.ow_block != jcp.ow, jcp.oh_block == 1));
 
+    if (jcp.with_src_zero_point) {
+        // Combine the s8s8 compensation and the src zero point compensation
+        // into a single gemm C-offset vector:
+        //   comp[oc] = s8s8_comp[oc] - src_zero_point * SUM(wei[oc][...])
+        const ptrdiff_t offset
+                = (ptrdiff_t)jcp.ngroups * jcp.ks * jcp.ic * jcp.oc;
+        const int32_t *s8s8_comp = (const int32_t *)(wei_base + offset);
+        const int32_t *zp_comp
+                = s8s8_comp + (jcp.signed_input ? jcp.ngroups * jcp.oc : 0);
+        int32_t *comp = scratchpad.get<int32_t>(key_conv_zp_src_comp);
+        for (int i = 0; i < jcp.ngroups * jcp.oc; ++i)
+            comp[i] = (jcp.signed_input ? s8s8_comp[i] : 0)
+                    + src_zero_point * zp_comp[i];
+    }
+
     std::atomic<status_t> st(status::success);
 
     parallel(jcp.nthr, [&](const int ithr, const int nthr) {
-        status_t st_thr = execute_forward_thr(
-                ithr, nthr, src_base, wei_base, bia_base, dst_base, scratchpad);
+        status_t st_thr = execute_forward_thr(ithr, nthr, src_base, wei_base,
+                bia_base, dst_base, src_zero_point, dst_zero_point,
+                scratchpad);
 
         if (st_thr != status::success) st = st_thr;
     });
@@ -66,6 +86,7 @@ status_t
 _gemm_x8s8s32x_convolution_fwd_t<src_type, dst_type>::execute_forward_thr(
         const int ithr, const int nthr, const src_data_t *src_base,
         const wei_data_t *wei_base, const char *bia_base, dst_data_t *dst_base,
+        int32_t src_zero_point, int32_t dst_zero_point,
         const memory_tracking::grantor_t &scratchpad) const {
     const conv_gemm_conf_t &jcp = this->pd()->jcp_;
 
@@ -104,7 +125,10 @@ _gemm_x8s8s32x_convolution_fwd_t<src_type, dst_type>::execute_forward_thr(
             + (ptrdiff_t)ithr * jcp.oh_block * jcp.ow_block * jcp.oc;
 
     const ptrdiff_t offset = (ptrdiff_t)jcp.ngroups * jcp.ks * jcp.ic * jcp.oc;
-    const int32_t *_wei_comp = (const int32_t *)(wei_base + offset);
+    const int32_t *_wei_comp = jcp.with_src_zero_point
+            ? scratchpad.get<int32_t>(key_conv_zp_src_comp)
+            : (const int32_t *)(wei_base + offset);
+    const bool with_comp = jcp.signed_input || jcp.with_src_zero_point;
 
     int g {0}, n {0}, ohb {0}, owb {0};
     size_t start = 0, end = 0;
@@ -119,8 +143,11 @@ _gemm_x8s8s32x_convolution_fwd_t<src_type, dst_type>::execute_forward_thr(
     const size_t work_amount = (size_t)jcp.ngroups * jcp.mb * nb_oh * nb_ow;
     balance211(work_amount, nthr, ithr, start, end);
     nd_iterator_init(start, n, jcp.mb, g, jcp.ngroups, ohb, nb_oh, owb, nb_ow);
+    // padded elements of col hold the src zero point, so they do not
+    // contribute to the result after the compensation is applied
     uint8_t shift = jcp.signed_input ? 128 : 0;
-    parallel_nd(jcp.im2col_sz, [&](ptrdiff_t i) { col[i] = shift; });
+    uint8_t pad_value = (uint8_t)(shift + src_zero_point);
+    parallel_nd(jcp.im2col_sz, [&](ptrdiff_t i) { col[i] = pad_value; });
 
     status_t st = status::success;
 
@@ -145,10 +172,11 @@ _gemm_x8s8s32x_convolution_fwd_t<src_type, dst_type>::execute_forward_thr(
             if (jcp.im2col_sz) {
                 if (is_problem_3d)
                     jit_gemm_convolution_utils::im2col_dt_3d<src_data_t,
-                            uint8_t>(jcp, imtr, col, od);
+                            uint8_t>(jcp, imtr, col, od, src_zero_point);
                 else
                     jit_gemm_convolution_utils::im2col_dt<src_data_t, uint8_t>(
-                            jcp, src, imtr, col, oh, h_step, ow, w_step);
+                            jcp, src, imtr, col, oh, h_step, ow, w_step,
+                            src_zero_point);
             }
 
             const dim_t M = jcp.oc;
@@ -163,24 +191,24 @@ _gemm_x8s8s32x_convolution_fwd_t<src_type, dst_type>::execute_forward_thr(
             const float onef = 1.f, zerof = 0.f;
             const src_data_t *__restrict src_od
                     = src + od * jcp.oh * jcp.ow * jcp.ngroups * jcp.ic;
-            st = gemm_s8x8s32("N", BT, jcp.signed_input ? "C" : "F", &M, &N, &K,
-                    &onef, wei, &LDA, &off_a,
-                    jcp.im2col_sz ? col : (uint8_t *)src_od, &LDB, &off_b,
-                    &zerof, acc, &M, jcp.signed_input ? wei_comp : &off_c);
-
-            if (st != status::success) return st;
-
             auto wei_adj_scale
                     = (wei_md.extra().flags & memory_extra_flags::scale_adjust)
                     ? wei_md.extra().scale_adjust
                     : 1.f;
 
-            parallel(0, [&](int ithr, int nthr) {
-                size_t start, end;
-                balance211((size_t)N * jcp.oc, nthr, ithr, start, end);
-                (*pp_ker_)(dst, acc, bia_base, scales, nslope, sum_scale,
-                        1.f / wei_adj_scale, g, start, end);
-            });
+            // the output is post-processed tile by tile right after the
+            // tile is computed, while it is still in cache
+            st = gemm_s8x8s32_epilogue("N", BT, with_comp ? "C" : "F", &M,
+                    &N, &K, &onef, wei, &LDA, &off_a,
+                    jcp.im2col_sz ? col : (uint8_t *)src_od, &LDB, &off_b,
+                    &zerof, acc, &M, with_comp ? wei_comp : &off_c,
+                    [&](dim_t start, dim_t end) {
+                        (*pp_ker_)(dst, acc, bia_base, scales, nslope,
+                                sum_scale, 1.f / wei_adj_scale,
+                                (float)dst_zero_point, g, start, end);
+                    });
+
+            if (st != status::success) return st;
         }
         nd_iterator_step(n, jcp.mb, g, jcp.ngroups, ohb, nb_oh, owb, nb_ow);
     }
@@ -59,9 +59,12 @@ struct _gemm_x8s8s32x_convolution_fwd_t : public primitive_t {
                     && !has_zero_dim_memory()
                     && attr()->has_default_values(
                             primitive_attr_t::skip_mask_t::oscale
-                                    | primitive_attr_t::skip_mask_t::post_ops,
+                                    | primitive_attr_t::skip_mask_t::post_ops
+                                    | primitive_attr_t::skip_mask_t::
+                                            zero_points_runtime,
                             dst_type)
-                    && output_scales_mask_ok() && post_ops_ok();
+                    && output_scales_mask_ok() && zero_points_ok()
+                    && post_ops_ok();
             if (!ok) return status::unimplemented;
 
             auto scratchpad = scratchpad_registry().registrar();
@@ -78,6 +81,15 @@ struct _gemm_x8s8s32x_convolution_fwd_t : public primitive_t {
             return mask == 0 || mask == 1 << 1;
         }
 
+        bool zero_points_ok() const {
+            // only common src and dst zero points are supported
+            int mask_src = 0, mask_dst = 0;
+            attr()->zero_points_.get(DNNL_ARG_SRC, nullptr, &mask_src, nullptr);
+            attr()->zero_points_.get(DNNL_ARG_DST, nullptr, &mask_dst, nullptr);
+            return attr()->zero_points_.has_default_values(DNNL_ARG_WEIGHTS)
+                    && mask_src == 0 && mask_dst == 0;
+        }
+
         bool post_ops_ok() const {
             using namespace dnnl::impl::primitive_kind;
             auto const &po = attr()->post_ops_;
@@ -115,6 +127,7 @@ private:
     status_t execute_forward_thr(const int ithr, const int nthr,
             const src_data_t *src_base, const wei_data_t *wei_base,
             const char *bia_base, dst_data_t *dst_base,
+            int32_t src_zero_point, int32_t dst_zero_point,
             const memory_tracking::grantor_t &scratchpad) const;
 
     int nthr_ = 0;
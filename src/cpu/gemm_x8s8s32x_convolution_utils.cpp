@@ -44,7 +44,8 @@ struct ref_pp_ker_t : pp_ker_t {
 
     void operator()(void *dst, const acc_data_t *acc, const char *bias,
             const float *scales, float nslope, float sum_scale,
-            float signed_scale, int g, size_t start, size_t end) const override;
+            float signed_scale, float dst_zero_point, int g, size_t start,
+            size_t end) const override;
 
 private:
     std::unique_ptr<ref_eltwise_scalar_fwd_t> ref_eltwise_;
@@ -53,7 +54,8 @@ private:
 template <typename dst_data_t>
 void ref_pp_ker_t<dst_data_t>::operator()(void *void_dst, const acc_data_t *acc,
         const char *bias, const float *scales, float nslope, float sum_scale,
-        float signed_scale, int g, size_t start, size_t end) const {
+        float signed_scale, float dst_zero_point, int g, size_t start,
+        size_t end) const {
     if (end <= start) return;
 
     assert(data_traits<dst_data_t>::data_type == dst_data_type_);
@@ -79,6 +81,7 @@ void ref_pp_ker_t<dst_data_t>::operator()(void *void_dst, const acc_data_t *acc,
             d *= scales[(g * jcp_.oc + oc) * scale_idx_mult_];
             if (do_sum_) d += sum_scale * dst[dst_off];
             if (do_eltwise_) d = ref_eltwise_->compute_scalar(d);
+            if (do_dst_zero_point_) d += dst_zero_point;
             dst[dst_off] = qz_a1b0<float, dst_data_t>()(d);
         }
     }
@@ -98,6 +101,7 @@ pp_ker_t::pp_ker_t(const convolution_pd_t *pd, const conv_gemm_conf_t &jcp)
     auto &post_ops = pd->attr()->post_ops_;
 
     do_signed_scaling_ = jcp_.signed_input;
+    do_dst_zero_point_ = jcp_.with_dst_zero_point;
 
     do_sum_ = post_ops.contain(primitive_kind::sum, 0);
     do_bias_ = pd->with_bias();
@@ -34,7 +34,8 @@ struct pp_ker_t {
 
     virtual void operator()(void *dst, const acc_data_t *acc, const char *bias,
             const float *scales, float nslope, float sum_scale,
-            float signed_scale, int g, size_t start, size_t end) const = 0;
+            float signed_scale, float dst_zero_point, int g, size_t start,
+            size_t end) const = 0;
 
     size_t dst_os_stride_;
 
@@ -52,6 +53,7 @@ protected:
     post_ops_t::entry_t::eltwise_t eltwise_;
     bool do_sum_ = false;
     bool do_signed_scaling_ = false;
+    bool do_dst_zero_point_ = false;
 };
 
 } // namespace gemm_x8s8s32x_convolution_utils
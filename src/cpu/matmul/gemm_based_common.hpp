@@ -19,7 +19,11 @@
 
 #include <assert.h>
 
+#include <atomic>
+
 #include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_desc_wrapper.hpp"
 #include "common/primitive_attr.hpp"
 #include "common/type_helpers.hpp"
 
@@ -78,6 +82,87 @@ inline void book_acc_scratchpad(
     }
 }
 
+// gemm arguments of a matmul which depend on the actual memory descriptors
+struct gemm_args_t {
+    dim_t batch, M, N, K;
+    // transposition of src (gemm B) and weights (gemm A)
+    const char *transa, *transb;
+    dim_t lda, ldb, ldc;
+    dim_t src_strides[2], weights_strides[2];
+    dim_t src_batch_stride, weights_batch_stride, dst_batch_stride;
+};
+
+inline void init_gemm_args(gemm_args_t &args,
+        const memory_desc_wrapper &src_d, const memory_desc_wrapper &weights_d,
+        const memory_desc_wrapper &dst_d, bool batched, bool dst_is_acc) {
+    args.batch = batched ? dst_d.dims()[0] : 1;
+    args.M = dst_d.dims()[batched + 0];
+    args.N = dst_d.dims()[batched + 1];
+    args.K = src_d.dims()[batched + 1];
+
+    const auto src_strides = &src_d.blocking_desc().strides[batched];
+    const auto weights_strides = &weights_d.blocking_desc().strides[batched];
+    for (int d = 0; d < 2; ++d) {
+        args.src_strides[d] = src_strides[d];
+        args.weights_strides[d] = weights_strides[d];
+    }
+
+    args.transa = src_strides[1] == 1 && src_d.dims()[batched + 0] > 1 ? "N"
+                                                                        : "T";
+    args.transb = weights_strides[1] == 1 && weights_d.dims()[batched + 0] > 1
+            ? "N"
+            : "T";
+
+    args.lda = src_strides[*args.transa == 'N' ? 0 : 1];
+    args.ldb = weights_strides[*args.transb == 'N' ? 0 : 1];
+    args.ldc = dst_is_acc ? dst_d.blocking_desc().strides[batched + 0]
+                          : args.N;
+
+    args.src_batch_stride = src_d.blocking_desc().strides[0];
+    args.weights_batch_stride = weights_d.blocking_desc().strides[0];
+    args.dst_batch_stride = dst_d.blocking_desc().strides[0];
+}
+
+// Number of elements of the accumulator if dst cannot be used instead. Every
+// thread takes its own M x N slice, so it must be queried at execution time:
+// the number of threads may change after the primitive is created.
+inline dim_t get_acc_nelems(const gemm_args_t &args) {
+    return nstl::min(args.batch, (dim_t)dnnl_get_max_threads()) * args.M
+            * args.N;
+}
+
+// The accumulator of a matmul created with runtime dimensions, which cannot
+// be booked in the scratchpad. It is kept between executions instead of
+// being allocated for every call, and it only grows. A concurrent execution
+// that finds it busy allocates a private one.
+struct runtime_acc_t {
+    runtime_acc_t() : busy_(false) {}
+    ~runtime_acc_t() { free(acc_); }
+
+    // Returns a buffer of at least `size` bytes or nullptr if it is busy.
+    // A non-null buffer must be returned with release().
+    void *acquire(size_t size) {
+        if (busy_.exchange(true)) return nullptr;
+        if (size > size_) {
+            free(acc_);
+            acc_ = malloc(size, 64);
+            size_ = acc_ ? size : 0;
+            if (!acc_) {
+                busy_ = false;
+                return nullptr;
+            }
+        }
+        return acc_;
+    }
+
+    void release() { busy_ = false; }
+
+private:
+    std::atomic<bool> busy_;
+    void *acc_ = nullptr;
+    size_t size_ = 0;
+};
+
 } // namespace gemm_based
 } // namespace matmul
 } // namespace cpu
@@ -157,46 +157,49 @@ status_t gemm_bf16_matmul_t<dst_type>::execute_ref(
             : ctx.get_scratchpad_grantor().template get<acc_data_t>(
                     memory_tracking::names::key_matmul_dst_in_acc_dt);
 
-    const auto &dst_bd = dst_d.blocking_desc();
-
     const bool batched = pd()->batched();
 
-    const dim_t batch = batched ? dst_d.dims()[0] : 1;
-    const dim_t M = dst_d.dims()[batched + 0];
-    const dim_t N = dst_d.dims()[batched + 1];
-    const dim_t K = src_d.dims()[batched + 1];
+    gemm_based::gemm_args_t args;
+    gemm_based::init_gemm_args(
+            args, src_d, weights_d, dst_d, batched, dst_is_acc);
+
+    const dim_t batch = args.batch;
+    const dim_t M = args.M;
+    const dim_t N = args.N;
+    const dim_t K = args.K;
 
-    // case: dynamic sizes
-    bool need_free_acc = false;
+    // case: dynamic sizes, the accumulator is kept by the primitive instead
+    // of being allocated on every call
+    bool need_release_acc = false, need_free_acc = false;
     if (acc == nullptr) {
-        acc = (acc_data_t *)malloc(sizeof(acc_data_t)
-                        * nstl::min(batch, (dim_t)dnnl_get_max_threads()) * M
-                        * N,
-                64);
-        if (acc == nullptr) return status::out_of_memory;
-        need_free_acc = true;
+        const size_t acc_size
+                = sizeof(acc_data_t) * gemm_based::get_acc_nelems(args);
+        acc = (acc_data_t *)runtime_acc_.acquire(acc_size);
+        need_release_acc = acc != nullptr;
+        if (acc == nullptr) {
+            acc = (acc_data_t *)malloc(acc_size, 64);
+            if (acc == nullptr) return status::out_of_memory;
+            need_free_acc = true;
+        }
     }
+    auto put_back_acc = [&]() {
+        if (need_release_acc) runtime_acc_.release();
+        if (need_free_acc) free(acc);
+    };
 
-    const auto &src_strides = &src_d.blocking_desc().strides[batched];
-    const auto &weights_strides = &weights_d.blocking_desc().strides[batched];
-
-    const char *transA
-            = src_strides[1] == 1 && src_d.dims()[batched + 0] > 1 ? "N" : "T";
-    const char *transB
-            = weights_strides[1] == 1 && weights_d.dims()[batched + 0] > 1
-            ? "N"
-            : "T";
+    const char *transA = args.transa;
+    const char *transB = args.transb;
 
-    const dim_t lda = src_strides[*transA == 'N' ? 0 : 1];
-    const dim_t ldb = weights_strides[*transB == 'N' ? 0 : 1];
-    const dim_t ldc = dst_is_acc ? dst_bd.strides[batched + 0] : N;
+    const dim_t lda = args.lda;
+    const dim_t ldb = args.ldb;
+    const dim_t ldc = args.ldc;
 
     const float alpha = params.get_gemm_alpha(scales);
     const float beta = params.gemm_beta_;
 
-    const auto src_batch_stride = src_d.blocking_desc().strides[0];
-    const auto weights_batch_stride = weights_d.blocking_desc().strides[0];
-    const auto dst_batch_stride = dst_d.blocking_desc().strides[0];
+    const auto src_batch_stride = args.src_batch_stride;
+    const auto weights_batch_stride = args.weights_batch_stride;
+    const auto dst_batch_stride = args.dst_batch_stride;
     const auto acc_batch_stride = M * N;
 
     std::atomic<status_t> st(status::success);
@@ -240,7 +243,10 @@ status_t gemm_bf16_matmul_t<dst_type>::execute_ref(
     } else {
         st = gemm_bf16bf16f32(transB, transA, &N, &M, &K, &alpha, weights, &ldb,
                 src, &lda, &beta, acc, &ldc);
-        if (st != status::success) return st;
+        if (st != status::success) {
+            put_back_acc();
+            return st;
+        }
 
         if (params.has_pp_kernel_) {
             const bool force_sequential = pp_kernel_->sequential_kernel();
@@ -255,7 +261,7 @@ status_t gemm_bf16_matmul_t<dst_type>::execute_ref(
         }
     }
 
-    if (need_free_acc) free(acc);
+    put_back_acc();
 
     return st;
 }
@@ -75,6 +75,8 @@ private:
 
     using pp_kernel_t = inner_product_utils::pp_kernel_t<acc_type, dst_type>;
     std::unique_ptr<pp_kernel_t> pp_kernel_;
+
+    mutable gemm_based::runtime_acc_t runtime_acc_;
 };
 
 } // namespace matmul
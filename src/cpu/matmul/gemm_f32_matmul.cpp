@@ -14,8 +14,6 @@
 * limitations under the License.
 *******************************************************************************/
 
-#include <atomic>
-
 #include <assert.h>
 #include <float.h>
 #include <math.h>
@@ -116,6 +114,43 @@ status_t gemm_f32_matmul_t::pd_t::check_and_configure_attributes() {
     return status::success;
 }
 
+status_t gemm_f32_matmul_t::init(engine_t *engine) {
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper weights_d(pd()->weights_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    // the kernel is specialized for the exact shape and strides
+    if (pd()->batch() != 1 || src_d.has_runtime_dims_or_strides()
+            || weights_d.has_runtime_dims_or_strides()
+            || dst_d.has_runtime_dims_or_strides())
+        return status::success;
+
+    const bool batched = pd()->batched();
+    const auto &src_strides = &src_d.blocking_desc().strides[batched];
+    const auto &weights_strides = &weights_d.blocking_desc().strides[batched];
+
+    const bool trans_src
+            = !(src_strides[1] == 1 && src_d.dims()[batched + 0] > 1);
+    const bool trans_weights
+            = !(weights_strides[1] == 1 && weights_d.dims()[batched + 0] > 1);
+
+    // gemm is called with swapped operands, see execute_ref()
+    gemm_small_f32_conf_t conf;
+    conf.transa = trans_weights;
+    conf.transb = trans_src;
+    conf.m = pd()->N();
+    conf.n = pd()->M();
+    conf.k = pd()->K();
+    conf.lda = weights_strides[trans_weights ? 1 : 0];
+    conf.ldb = src_strides[trans_src ? 1 : 0];
+    conf.ldc = dst_d.blocking_desc().strides[batched + 0];
+    conf.beta_is_zero = pd()->params().gemm_beta_ == 0.f;
+
+    small_gemm_.reset(gemm_small_f32_kernel_t::create(conf));
+
+    return status::success;
+}
+
 status_t gemm_f32_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
     auto src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
     auto weights = CTX_IN_MEM(const weights_data_t *, DNNL_ARG_WEIGHTS);
@@ -163,54 +198,44 @@ status_t gemm_f32_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
     const float beta = params.gemm_beta_;
 
     const dim_t batch = batched ? src_d.dims()[0] : 1;
-    const auto src_batch_stride = src_d.blocking_desc().strides[0];
-    const auto weights_batch_stride = weights_d.blocking_desc().strides[0];
-    const auto dst_batch_stride = dst_d.blocking_desc().strides[0];
-
-    std::atomic<status_t> st(status::success);
-
-    const bool parallel_over_batch = batch > 1;
-    if (parallel_over_batch) {
-        parallel(0, [&](int ithr, int nthr) {
-            size_t batch_start {}, batch_end {};
-            balance211((size_t)(batch), nthr, ithr, batch_start, batch_end);
-            for (size_t b = batch_start; b < batch_end; ++b) {
-                const src_data_t *curr_src = src + b * src_batch_stride;
-                const weights_data_t *curr_weights
-                        = weights + b * weights_batch_stride;
-                dst_data_t *curr_dst = dst + b * dst_batch_stride;
-
-                status_t st_thr = extended_sgemm(transB, transA, &N, &M, &K,
-                        &alpha, curr_weights, &ldb, curr_src, &lda, &beta,
-                        curr_dst, &ldc, nullptr, false);
-                if (st_thr != status::success) {
-                    st = st_thr;
-                    return;
-                }
-
-                if (params.has_pp_kernel_) {
-                    const float *pp_scales
-                            = params.get_post_processing_scales(scales);
-                    (*pp_kernel_)(curr_dst, curr_dst, bias, pp_scales, 0, M * N,
-                            (size_t)N, nullptr);
+    const dim_t src_batch_stride
+            = batched ? src_d.blocking_desc().strides[0] : 0;
+    const dim_t weights_batch_stride
+            = batched ? weights_d.blocking_desc().strides[0] : 0;
+    const dim_t dst_batch_stride
+            = batched ? dst_d.blocking_desc().strides[0] : 0;
+
+    status_t st = status::success;
+    if (small_gemm_)
+        small_gemm_->execute(&alpha, weights, src, &beta, dst);
+    else
+        st = extended_sgemm_batch(transB, transA, &N, &M, &K, &alpha, weights,
+                &ldb, &weights_batch_stride, src, &lda, &src_batch_stride,
+                &beta, dst, &ldc, &dst_batch_stride, &batch, nullptr);
+    if (st != status::success) return st;
+
+    if (params.has_pp_kernel_) {
+        const bool force_sequential = pp_kernel_->sequential_kernel();
+        const float *pp_scales = params.get_post_processing_scales(scales);
+        // post-process all batch entries at once if they follow each other
+        const bool dst_batch_is_dense
+                = batch == 1 || dst_batch_stride == M * N;
+        parallel(force_sequential ? 1 : 0, [&](int ithr, int nthr) {
+            if (dst_batch_is_dense) {
+                size_t start {}, end {};
+                balance211((size_t)(batch * M * N), nthr, ithr, start, end);
+                (*pp_kernel_)(dst, dst, bias, pp_scales, start, end,
+                        (size_t)N, nullptr);
+            } else {
+                size_t batch_start {}, batch_end {};
+                balance211((size_t)batch, nthr, ithr, batch_start, batch_end);
+                for (size_t b = batch_start; b < batch_end; ++b) {
+                    dst_data_t *curr_dst = dst + b * dst_batch_stride;
+                    (*pp_kernel_)(curr_dst, curr_dst, bias, pp_scales, 0,
+                            M * N, (size_t)N, nullptr);
                 }
             }
         });
-    } else {
-        st = extended_sgemm(transB, transA, &N, &M, &K, &alpha, weights, &ldb,
-                src, &lda, &beta, dst, &ldc, nullptr, false);
-        if (st != status::success) return st;
-
-        if (params.has_pp_kernel_) {
-            const bool force_sequential = pp_kernel_->sequential_kernel();
-            const float *pp_scales = params.get_post_processing_scales(scales);
-            parallel(force_sequential ? 1 : 0, [&](int ithr, int nthr) {
-                size_t start {}, end {};
-                balance211((size_t)(M * N), nthr, ithr, start, end);
-                (*pp_kernel_)(dst, dst, bias, pp_scales, start, end, (size_t)N,
-                        nullptr);
-            });
-        }
     }
 
     return st;
@@ -23,6 +23,7 @@
 #include "common/primitive.hpp"
 #include "common/type_helpers.hpp"
 
+#include "cpu/gemm/f32/gemm_small_f32.hpp"
 #include "cpu/gemm_inner_product_utils.hpp"
 
 #include "cpu/matmul/cpu_matmul_pd.hpp"
@@ -54,6 +55,8 @@ struct gemm_f32_matmul_t : public primitive_t {
                     false));
     }
 
+    status_t init(engine_t *engine) override;
+
     static constexpr data_type_t src_type = data_type::f32;
     static constexpr data_type_t weights_type = data_type::f32;
     static constexpr data_type_t dst_type = data_type::f32;
@@ -74,6 +77,8 @@ private:
 
     using pp_kernel_t = inner_product_utils::pp_kernel_t<acc_type, dst_type>;
     std::unique_ptr<pp_kernel_t> pp_kernel_;
+    // kernel specialized for the problem shape, used if the shape is small
+    std::unique_ptr<gemm_small_f32_kernel_t> small_gemm_;
 };
 
 } // namespace matmul
@@ -52,7 +52,13 @@ void ncsp_batch_normalization_fwd_t<d_type>::execute_forward(
     auto scaleshift = CTX_IN_MEM(const acc_data_t *, DNNL_ARG_SCALE_SHIFT);
 
     auto scratchpad = ctx.get_scratchpad_grantor();
-    auto *ws_reduce = scratchpad.template get<acc_data_t>(key_bnorm_reduction);
+    auto *ws_reduce = scratchpad.template get<double>(key_bnorm_reduction);
+    // The statistics are computed in a single pass over src: every thread
+    // keeps the sums of the deviations of its part from the first value of
+    // the channel and of their squares, see bnorm_utils::finalize_shifted_sums
+    const size_t ws_stats_sz = pd()->C() * dnnl_get_max_threads();
+    double *ws_s1 = ws_reduce;
+    double *ws_s2 = ws_reduce + ws_stats_sz;
 
     acc_data_t *mean, *variance;
     if (!calculate_stats) {
@@ -91,6 +97,11 @@ void ncsp_batch_normalization_fwd_t<d_type>::execute_forward(
     size_t l3_size_ = platform::get_per_core_cache_size(3) * nthr / 2;
     size_t data_size = N * C * SP * sizeof(data_t);
     bool do_blocking = (data_size >= l3_size_ / 2 && l3_size_ > 0);
+    // A channel which fits in L2 cache is normalized right after its
+    // statistics by a thread which owns it entirely, so src is read from
+    // memory once instead of twice
+    const bool channel_fits_cache = N * SP * sizeof(data_t)
+            <= platform::get_per_core_cache_size(2) / 2;
 
     parallel(0, [&](const int ithr, const int nthr) {
         int C_ithr = 0, C_nthr = 0;
@@ -143,96 +154,37 @@ void ncsp_batch_normalization_fwd_t<d_type>::execute_forward(
             // iteration if threads are not synced by the algorithm.
             size_t ws_iter_off = (dnnl_thr_syncable() ? 0 : 1) * C_off;
 
-            if (calculate_stats) {
-                acc_data_t *mean_blk = mean + C_off;
-                acc_data_t *variance_blk = variance + C_off;
-                for (dim_t c = C_blk_s; c < C_blk_e; c++) {
-                    size_t off = (c + C_off) * SP;
-                    acc_data_t sum = 0;
-                    for (dim_t n = N_s; n < N_e; ++n) {
-                        const acc_data_t *scr_fp32;
-                        size_t soff = off + n * C * SP;
-                        if (d_type == bf16) {
-                            // convert src from bf16 to f32
-                            acc_data_t *tmp_src
-                                    = bf16_src_cvt_wsp + ithr * SP_cl_align;
-                            /*TODO: remove this conversion if performance
-                            doesn't degrade, since bfloat16_t supports +=
-                            operator with implicit conversions from bf16 to
-                            float */
-                            cvt_bfloat16_to_float(tmp_src + S_s,
-                                    (bfloat16_t *)src + soff + S_s, S_chunk);
-                            scr_fp32 = tmp_src;
-                        } else {
-                            scr_fp32 = reinterpret_cast<const acc_data_t *>(
-                                    src + soff);
-                        }
-                        PRAGMA_OMP_SIMD(reduction(+ : sum))
-                        for (dim_t sp = S_s; sp < S_e; ++sp) {
-                            sum += scr_fp32[sp];
-                        }
-                    }
-                    ws_reduce[ws_iter_off + SP_N_ithr * C_blks_per_iter + c]
-                            = sum;
-                }
-
-                if (dnnl_thr_syncable()) dnnl_thr_barrier();
-
-                for (dim_t c = C_blk_gl_s; c < C_blk_gl_e; c++) {
-                    mean_blk[c] = 0.;
-                    for (dim_t n = 0; n < SP_N_nthr; n++)
-                        mean_blk[c] += ws_reduce[ws_iter_off
-                                + n * C_blks_per_iter + c];
-                    mean_blk[c] /= (N * SP);
-                }
+            auto get_shift = [&](dim_t c) {
+                return static_cast<acc_data_t>(src[(c + C_off) * SP]);
+            };
 
-                if (dnnl_thr_syncable()) dnnl_thr_barrier();
-
-                for (dim_t c = C_blk_s; c < C_blk_e; c++) {
-                    size_t off = c + C_off;
-                    acc_data_t sum = 0.;
-                    for (dim_t n = N_s; n < N_e; ++n) {
-                        const acc_data_t *_src;
-                        size_t soff = off * SP + n * C * SP;
-                        if (d_type == bf16) {
-                            // convert src from bf16 to f32
-                            acc_data_t *tmp_src
-                                    = bf16_src_cvt_wsp + ithr * SP_cl_align;
-                            /*TODO: remove this conversion if performance
-                            doesn't degrade, since bfloat16_t supports +=
-                            operator with implicit conversions from bf16 to
-                            float */
-                            cvt_bfloat16_to_float(tmp_src + S_s,
-                                    (bfloat16_t *)src + soff + S_s, S_chunk);
-                            _src = tmp_src;
-                        } else {
-                            _src = reinterpret_cast<const acc_data_t *>(
-                                    src + soff);
-                        }
-                        PRAGMA_OMP_SIMD(reduction(+ : sum))
-                        for (dim_t sp = S_s; sp < S_e; ++sp) {
-                            acc_data_t m = _src[sp] - mean[off];
-                            sum += m * m;
-                        }
+            auto channel_stats = [&](dim_t c, acc_data_t shift, double &s1,
+                                         double &s2) {
+                size_t off = (c + C_off) * SP;
+                for (dim_t n = N_s; n < N_e; ++n) {
+                    const acc_data_t *scr_fp32;
+                    size_t soff = off + n * C * SP;
+                    if (d_type == bf16) {
+                        // convert src from bf16 to f32
+                        acc_data_t *tmp_src
+                                = bf16_src_cvt_wsp + ithr * SP_cl_align;
+                        /*TODO: remove this conversion if performance
+                        doesn't degrade, since bfloat16_t supports +=
+                        operator with implicit conversions from bf16 to
+                        float */
+                        cvt_bfloat16_to_float(tmp_src + S_s,
+                                (bfloat16_t *)src + soff + S_s, S_chunk);
+                        scr_fp32 = tmp_src;
+                    } else {
+                        scr_fp32 = reinterpret_cast<const acc_data_t *>(
+                                src + soff);
                     }
-                    ws_reduce[ws_iter_off + SP_N_ithr * C_blks_per_iter + c]
-                            = sum;
-                }
-
-                if (dnnl_thr_syncable()) dnnl_thr_barrier();
-
-                for (dim_t c = C_blk_gl_s; c < C_blk_gl_e; c++) {
-                    variance_blk[c] = 0.;
-                    for (dim_t n = 0; n < SP_N_nthr; n++)
-                        variance_blk[c] += ws_reduce[ws_iter_off
-                                + n * C_blks_per_iter + c];
-                    variance_blk[c] /= (N * SP);
+                    bnorm_utils::accumulate_shifted_sums(
+                            s1, s2, shift, scr_fp32 + S_s, S_chunk);
                 }
+            };
 
-                if (dnnl_thr_syncable()) dnnl_thr_barrier();
-            }
-
-            for (dim_t c = C_blk_s; c < C_blk_e; c++) {
+            auto normalize_channel = [&](dim_t c) {
                 size_t off = c + C_off;
                 acc_data_t sqrt_variance
                         = static_cast<acc_data_t>(sqrtf(variance[off] + eps));
@@ -285,7 +237,53 @@ void ncsp_batch_normalization_fwd_t<d_type>::execute_forward(
                                 _dst + S_s, S_chunk);
                     }
                 }
+            };
+
+            // The thread computes the statistics of its channels alone, so
+            // no reduction over the threads is required
+            if (calculate_stats && SP_N_nthr == 1 && channel_fits_cache) {
+                for (dim_t c = C_blk_s; c < C_blk_e; c++) {
+                    const acc_data_t shift = get_shift(c);
+                    double s1 = 0, s2 = 0;
+                    channel_stats(c, shift, s1, s2);
+                    bnorm_utils::finalize_shifted_sums(N * SP, shift, s1, s2,
+                            mean[c + C_off], variance[c + C_off]);
+                    normalize_channel(c);
+                }
+                continue;
             }
+
+            if (calculate_stats) {
+                acc_data_t *mean_blk = mean + C_off;
+                acc_data_t *variance_blk = variance + C_off;
+                for (dim_t c = C_blk_s; c < C_blk_e; c++) {
+                    double s1 = 0, s2 = 0;
+                    channel_stats(c, get_shift(c), s1, s2);
+                    const size_t ws_off
+                            = ws_iter_off + SP_N_ithr * C_blks_per_iter + c;
+                    ws_s1[ws_off] = s1;
+                    ws_s2[ws_off] = s2;
+                }
+
+                if (dnnl_thr_syncable()) dnnl_thr_barrier();
+
+                for (dim_t c = C_blk_gl_s; c < C_blk_gl_e; c++) {
+                    double s1 = 0, s2 = 0;
+                    for (dim_t n = 0; n < SP_N_nthr; n++) {
+                        const size_t ws_off
+                                = ws_iter_off + n * C_blks_per_iter + c;
+                        s1 += ws_s1[ws_off];
+                        s2 += ws_s2[ws_off];
+                    }
+                    bnorm_utils::finalize_shifted_sums(N * SP, get_shift(c),
+                            s1, s2, mean_blk[c], variance_blk[c]);
+                }
+
+                if (dnnl_thr_syncable()) dnnl_thr_barrier();
+            }
+
+            for (dim_t c = C_blk_s; c < C_blk_e; c++)
+                normalize_channel(c);
         }
     });
 }
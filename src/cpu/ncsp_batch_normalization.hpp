@@ -69,8 +69,9 @@ struct ncsp_batch_normalization_fwd_t : public primitive_t {
             using namespace memory_tracking::names;
             auto scratchpad = scratchpad_registry().registrar();
             if (!stats_is_src()) {
-                scratchpad.template book<acc_data_t>(
-                        key_bnorm_reduction, C() * dnnl_get_max_threads());
+                // The shifted sums of every thread
+                scratchpad.template book<double>(
+                        key_bnorm_reduction, 2 * C() * dnnl_get_max_threads());
 
                 if (!is_training()) {
                     scratchpad.template book<acc_data_t>(
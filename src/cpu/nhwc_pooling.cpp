@@ -56,6 +56,42 @@ size_t strided_offset(const int _n, const size_t _sn, const int _d,
         const size_t _sw) {
     return _n * _sn + _d * _sd + _h * _sh + _w * _sw;
 }
+
+// Conversions of the data to f32 which the computations are done in
+static void cvt_to_float(float *out, const bfloat16_t *inp, int n) {
+    cvt_bfloat16_to_float(out, inp, n);
+}
+
+template <typename data_t>
+static void cvt_to_float(float *out, const data_t *inp, int n) {
+    PRAGMA_OMP_SIMD()
+    for (int i = 0; i < n; ++i)
+        out[i] = (float)inp[i];
+}
+
+static void cvt_from_float(bfloat16_t *out, const float *inp, int n) {
+    cvt_float_to_bfloat16(out, inp, n);
+}
+
+template <typename data_t>
+static void cvt_from_float(data_t *out, const float *inp, int n) {
+    PRAGMA_OMP_SIMD()
+    for (int i = 0; i < n; ++i)
+        out[i] = saturate_and_round<data_t>(inp[i]);
+}
+
+// The initial value of the f32 maximum. It is below any value of the data, so
+// the first point of a window always updates the workspace, e.g. for the zeros
+// of u8. For bf16 the lowest f32 would be rounded to -inf.
+template <typename data_t>
+float max_init_value() {
+    return nstl::numeric_limits<float>::lowest();
+}
+
+template <>
+float max_init_value<bfloat16_t>() {
+    return nstl::numeric_limits<bfloat16_t>::lowest();
+}
 } // namespace nhwc_pooling
 
 template <data_type_t d_type>
@@ -139,15 +175,16 @@ void nhwc_pooling_fwd_t<d_type>::array_nhwc_initialize(const int n,
             ws[ws_offset + oc] = 0;
         else
             reinterpret_cast<int *>(ws)[ws_offset + oc] = 0;
-        dst[oc] = nstl::numeric_limits<data_t>::lowest();
+        dst[oc] = nhwc_pooling::max_init_value<data_t>();
     }
 }
 
 using namespace nstl;
 using namespace nhwc_pooling;
 
-template <data_type_t d_type>
-void nhwc_pooling_fwd_t<d_type>::execute_forward(const exec_ctx_t &ctx) const {
+template <>
+void nhwc_pooling_fwd_t<data_type::f32>::execute_forward(
+        const exec_ctx_t &ctx) const {
 
     auto alg = pd()->desc()->alg_kind;
 
@@ -283,9 +320,10 @@ void nhwc_pooling_fwd_t<d_type>::execute_forward(const exec_ctx_t &ctx) const {
     });
 }
 
-template <>
-void nhwc_pooling_fwd_t<data_type::bf16>::execute_forward(
-        const exec_ctx_t &ctx) const {
+// The data types other than f32 are converted to f32 point by point, the
+// results are rounded and saturated back to the data type
+template <data_type_t d_type>
+void nhwc_pooling_fwd_t<d_type>::execute_forward(const exec_ctx_t &ctx) const {
 
     auto alg = pd()->desc()->alg_kind;
 
@@ -294,9 +332,9 @@ void nhwc_pooling_fwd_t<data_type::bf16>::execute_forward(
     auto ws = CTX_OUT_MEM(unsigned char *, DNNL_ARG_WORKSPACE);
 
     auto scratchpad = ctx.get_scratchpad_grantor();
-    float *bf16cvt_src_wsp = scratchpad.template get<float>(
+    float *cvt_src_wsp = scratchpad.template get<float>(
             memory_tracking::names::key_pool_src_bf16cvt);
-    float *bf16cvt_dst_wsp = scratchpad.template get<float>(
+    float *cvt_dst_wsp = scratchpad.template get<float>(
             memory_tracking::names::key_pool_dst_bf16cvt);
 
     const memory_desc_wrapper MEM_D(src)(pd()->src_md());
@@ -344,8 +382,8 @@ void nhwc_pooling_fwd_t<data_type::bf16>::execute_forward(
                         ws_offset_init = strided_offset(mb, ws_n_stride, od,
                                 ws_d_stride, oh, ws_h_stride, ow, ws_w_stride);
                     }
-                    float *dst_f32 = &bf16cvt_dst_wsp[ithr * OC];
-                    float *src_f32 = &bf16cvt_src_wsp[ithr * OC];
+                    float *dst_f32 = &cvt_dst_wsp[ithr * OC];
+                    float *src_f32 = &cvt_src_wsp[ithr * OC];
 
                     // Note: GCC 4.8.5 won't vectorize below
                     // simple loops unless they are singled out
@@ -354,8 +392,7 @@ void nhwc_pooling_fwd_t<data_type::bf16>::execute_forward(
                     if (!ws) {
                         PRAGMA_OMP_SIMD()
                         for (int oc = 0; oc < OC; ++oc) {
-                            dst_f32[oc]
-                                    = nstl::numeric_limits<data_t>::lowest();
+                            dst_f32[oc] = max_init_value<data_t>();
                         }
                     } else {
                         array_nhwc_initialize(
@@ -377,8 +414,7 @@ void nhwc_pooling_fwd_t<data_type::bf16>::execute_forward(
                                 src_n_stride, id, src_d_stride, ih,
                                 src_h_stride, iw, src_w_stride);
 
-                        cvt_bfloat16_to_float(
-                                src_f32, &src[src_offset_init], OC);
+                        cvt_to_float(src_f32, &src[src_offset_init], OC);
 
                         if (!ws) {
                             PRAGMA_OMP_SIMD()
@@ -392,11 +428,11 @@ void nhwc_pooling_fwd_t<data_type::bf16>::execute_forward(
                                     kd * KH * KW + kh * KW + kw);
                         }
                     }
-                    cvt_float_to_bfloat16(dst + dst_offset_init, dst_f32, OC);
+                    cvt_from_float(dst + dst_offset_init, dst_f32, OC);
                 } else {
                     // pooling_avg
-                    float *dst_f32 = &bf16cvt_dst_wsp[ithr * OC];
-                    float *src_f32 = &bf16cvt_src_wsp[ithr * OC];
+                    float *dst_f32 = &cvt_dst_wsp[ithr * OC];
+                    float *src_f32 = &cvt_src_wsp[ithr * OC];
 
                     utils::array_set(dst_f32, 0, OC);
 
@@ -417,8 +453,7 @@ void nhwc_pooling_fwd_t<data_type::bf16>::execute_forward(
                         size_t src_offset_init = strided_offset(mb,
                                 src_n_stride, id, src_d_stride, ih,
                                 src_h_stride, iw, src_w_stride);
-                        cvt_bfloat16_to_float(
-                                src_f32, &src[src_offset_init], OC);
+                        cvt_to_float(src_f32, &src[src_offset_init], OC);
 
                         // need to move the loop to separate function
                         // for GCC 4.8.5 to vectorize
@@ -434,7 +469,7 @@ void nhwc_pooling_fwd_t<data_type::bf16>::execute_forward(
                     // need to move the loop to separate function
                     // for GCC 4.8.5 to vectorize
                     array_div_by_const(OC, dst_f32, num_summands, dst_f32);
-                    cvt_float_to_bfloat16(dst + dst_offset_init, dst_f32, OC);
+                    cvt_from_float(dst + dst_offset_init, dst_f32, OC);
                 }
             });
 }
@@ -736,6 +771,8 @@ template struct nhwc_pooling_fwd_t<data_type::f32>;
 template struct nhwc_pooling_bwd_t<data_type::f32>;
 template struct nhwc_pooling_fwd_t<data_type::bf16>;
 template struct nhwc_pooling_bwd_t<data_type::bf16>;
+template struct nhwc_pooling_fwd_t<data_type::s8>;
+template struct nhwc_pooling_fwd_t<data_type::u8>;
 
 } // namespace cpu
 } // namespace impl
@@ -78,7 +78,7 @@ struct nhwc_pooling_fwd_t : public primitive_t {
     private:
         void init_scratchpad() {
             using namespace memory_tracking::names;
-            if (src_md()->data_type == data_type::bf16) {
+            if (src_md()->data_type != data_type::f32) {
                 size_t bf16cvt_sz_ = C() * dnnl_get_max_threads();
                 auto scratchpad = scratchpad_registry().registrar();
                 scratchpad.template book<float>(
@@ -55,7 +55,7 @@ void nspc_batch_normalization_fwd_t<d_type>::execute_forward(
     auto scratchpad = ctx.get_scratchpad_grantor();
     auto tmp_mean = scratchpad.template get<acc_data_t>(key_bnorm_tmp_mean);
     auto tmp_var = scratchpad.template get<acc_data_t>(key_bnorm_tmp_var);
-    auto *ws_reduce = scratchpad.template get<acc_data_t>(key_bnorm_reduction);
+    auto *ws_reduce = scratchpad.template get<double>(key_bnorm_reduction);
 
     auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
     auto scaleshift = CTX_IN_MEM(const acc_data_t *, DNNL_ARG_SCALE_SHIFT);
@@ -94,100 +94,61 @@ void nspc_batch_normalization_fwd_t<d_type>::execute_forward(
             = [&](acc_data_t res) { return (with_relu && res < 0) ? 0 : res; };
     int nthr = dnnl_get_max_threads();
 
-    if (calculate_stats) {
-        parallel(nthr, [&](const int ithr, const int nthr) {
-            dim_t N_s = 0, N_e = 0;
-            balance211(N, nthr, ithr, N_s, N_e);
+    // The statistics are computed in a single pass over src: every thread
+    // keeps the sums of the deviations of its rows from the first row and
+    // of their squares, see bnorm_utils::finalize_shifted_sums
+    auto get_shift = [&](dim_t c) { return static_cast<acc_data_t>(src[c]); };
 
-            for (dim_t c = 0; c < C; c++)
-                ws_reduce[C * ithr + c] = 0.;
+    auto compute_stats = [&](const int ithr, const int nthr) {
+        dim_t N_s = 0, N_e = 0;
+        balance211(N, nthr, ithr, N_s, N_e);
 
-            for (dim_t n = N_s; n < N_e; n++) {
-                for (dim_t sp = 0; sp < SP; sp++) {
-                    const acc_data_t *_src;
-                    const size_t s_off = (size_t)n * SP * C + sp * C;
-                    if (d_type == bf16) {
-                        // convert src from b16 to f32
-                        acc_data_t *tmp_src = tmp_data_ + ithr * C_align;
-                        cvt_bfloat16_to_float(
-                                tmp_src, (bfloat16_t *)src + s_off, C);
-                        _src = tmp_src;
-                    } else {
-                        _src = reinterpret_cast<const acc_data_t *>(
-                                src + s_off);
-                    }
-                    PRAGMA_OMP_SIMD()
-                    for (int c = 0; c < C; c++) {
-                        ws_reduce[C * ithr + c] += _src[c];
-                    }
-                }
-            }
-        });
-        parallel_nd(C, [&](dim_t c) {
-            mean[c] = 0;
-            for (dim_t n = 0; n < nthr; n++)
-                mean[c] += ws_reduce[C * n + c];
-            mean[c] /= SP * N;
-        });
-        parallel(nthr, [&](const int ithr, const int nthr) {
-            dim_t N_s = 0, N_e = 0;
-            balance211(N, nthr, ithr, N_s, N_e);
+        double *s1_loc = ws_reduce + 2 * C * ithr;
+        double *s2_loc = s1_loc + C;
+        acc_data_t *shift = tmp_var + nstl::max(C, (dim_t)16) * ithr;
 
-            acc_data_t *mean_loc = tmp_mean + nstl::max(C, (dim_t)16) * ithr;
+        for (dim_t c = 0; c < C; c++) {
+            s1_loc[c] = 0.;
+            s2_loc[c] = 0.;
+            shift[c] = get_shift(c);
+        }
 
-            for (dim_t c = 0; c < C; c++) {
-                mean_loc[c] = mean[c];
-                ws_reduce[C * ithr + c] = 0.;
+        for (dim_t r = N_s * SP; r < N_e * SP; r++) {
+            const acc_data_t *_src;
+            const size_t s_off = (size_t)r * C;
+            if (d_type == bf16) {
+                // convert src from b16 to f32
+                acc_data_t *tmp_src = tmp_data_ + ithr * C_align;
+                cvt_bfloat16_to_float(tmp_src, (bfloat16_t *)src + s_off, C);
+                _src = tmp_src;
+            } else {
+                _src = reinterpret_cast<const acc_data_t *>(src + s_off);
             }
-
-            for (dim_t n = N_s; n < N_e; n++) {
-                for (dim_t sp = 0; sp < SP; sp++) {
-                    const acc_data_t *_src;
-                    const size_t s_off = (size_t)n * SP * C + sp * C;
-                    if (d_type == bf16) {
-                        // convert src from b16 to f32
-                        acc_data_t *tmp_src = tmp_data_ + ithr * C_align;
-                        cvt_bfloat16_to_float(
-                                tmp_src, (bfloat16_t *)src + s_off, C);
-                        _src = tmp_src;
-                    } else {
-                        _src = reinterpret_cast<const acc_data_t *>(
-                                src + s_off);
-                    }
-                    PRAGMA_OMP_SIMD()
-                    for (int c = 0; c < C; c++) {
-                        acc_data_t m = _src[c] - mean_loc[c];
-                        ws_reduce[C * ithr + c] += m * m;
-                    }
-                }
+            PRAGMA_OMP_SIMD()
+            for (int c = 0; c < C; c++) {
+                const double d = (double)_src[c] - shift[c];
+                s1_loc[c] += d;
+                s2_loc[c] += d * d;
             }
-        });
-        parallel_nd(C, [&](dim_t c) {
-            variance[c] = 0;
-            for (dim_t n = 0; n < nthr; n++)
-                variance[c] += ws_reduce[C * n + c];
-            variance[c] /= SP * N;
-        });
-        parallel(nthr, [&](const int ithr, const int nthr) {
-            acc_data_t *variance_loc = tmp_var + nstl::max(C, (dim_t)16) * ithr;
-            for (dim_t c = 0; c < C; c++)
-                variance_loc[c] = variance[c];
-        });
-    }
+        }
+    };
 
-    parallel(nthr, [&](const int ithr, const int nthr) {
+    auto merge_stats = [&](dim_t c, const int nthr) {
+        double s1 = 0, s2 = 0;
+        for (int n = 0; n < nthr; n++) {
+            s1 += ws_reduce[2 * C * n + c];
+            s2 += ws_reduce[2 * C * n + C + c];
+        }
+        bnorm_utils::finalize_shifted_sums(
+                SP * N, get_shift(c), s1, s2, mean[c], variance[c]);
+    };
+
+    auto normalize = [&](const int ithr, const int nthr,
+                             const acc_data_t *mean_loc,
+                             const acc_data_t *variance_loc) {
         dim_t N_s = 0, N_e = 0;
         balance211(N, nthr, ithr, N_s, N_e);
 
-        acc_data_t *mean_loc, *variance_loc;
-        if (calculate_stats) {
-            mean_loc = tmp_mean + nstl::max(C, (dim_t)16) * ithr;
-            variance_loc = tmp_var + nstl::max(C, (dim_t)16) * ithr;
-        } else {
-            mean_loc = mean;
-            variance_loc = variance;
-        }
-
         for (dim_t n = N_s; n < N_e; n++) {
             for (dim_t sp = 0; sp < SP; sp++) {
                 acc_data_t *_dst;
@@ -235,6 +196,49 @@ void nspc_batch_normalization_fwd_t<d_type>::execute_forward(
                 }
             }
         }
+    };
+
+    // When the part of src of a thread fits in L2 cache, the statistics, the
+    // merge and the normalization run in one parallel region, and the thread
+    // normalizes its part while it is still in cache
+    const bool fuse_stats_norm = calculate_stats && dnnl_thr_syncable()
+            && (size_t)utils::div_up(N, nthr) * SP * C * sizeof(data_t)
+                    <= platform::get_per_core_cache_size(2) / 2;
+    if (fuse_stats_norm) {
+        parallel(nthr, [&](const int ithr, const int nthr) {
+            compute_stats(ithr, nthr);
+            dnnl_thr_barrier();
+
+            dim_t C_s = 0, C_e = 0;
+            balance211(C, nthr, ithr, C_s, C_e);
+            for (dim_t c = C_s; c < C_e; c++)
+                merge_stats(c, nthr);
+            dnnl_thr_barrier();
+
+            normalize(ithr, nthr, mean, variance);
+        });
+        return;
+    }
+
+    if (calculate_stats) {
+        parallel(nthr, compute_stats);
+        parallel_nd(C, [&](dim_t c) { merge_stats(c, nthr); });
+        parallel(nthr, [&](const int ithr, const int nthr) {
+            acc_data_t *mean_loc = tmp_mean + nstl::max(C, (dim_t)16) * ithr;
+            acc_data_t *variance_loc = tmp_var + nstl::max(C, (dim_t)16) * ithr;
+            for (dim_t c = 0; c < C; c++) {
+                mean_loc[c] = mean[c];
+                variance_loc[c] = variance[c];
+            }
+        });
+    }
+
+    parallel(nthr, [&](const int ithr, const int nthr) {
+        if (calculate_stats)
+            normalize(ithr, nthr, tmp_mean + nstl::max(C, (dim_t)16) * ithr,
+                    tmp_var + nstl::max(C, (dim_t)16) * ithr);
+        else
+            normalize(ithr, nthr, mean, variance);
     });
 }
 
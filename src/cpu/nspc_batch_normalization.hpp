@@ -72,8 +72,9 @@ struct nspc_batch_normalization_fwd_t : public primitive_t {
             if (!stats_is_src()) {
                 const size_t stats_buf_sz
                         = nstl::max(C(), dim_t(16)) * dnnl_get_max_threads();
-                scratchpad.template book<acc_data_t>(
-                        key_bnorm_reduction, stats_buf_sz);
+                // The shifted sums of every thread
+                scratchpad.template book<double>(
+                        key_bnorm_reduction, 2 * C() * dnnl_get_max_threads());
                 scratchpad.template book<acc_data_t>(
                         key_bnorm_tmp_mean, stats_buf_sz);
                 scratchpad.template book<acc_data_t>(
@@ -175,6 +175,14 @@ struct ref_concat_t : public primitive_t {
         } else {
             auto dst_ptr = CTX_OUT_MEM(void *, DNNL_ARG_DST);
             for (int i = 0; i < n; ++i) {
+                const auto src_mem = ctx.input(DNNL_ARG_MULTIPLE_SRC + i);
+                bool in_place = false;
+                CHECK(pd()->src_is_in_place(i,
+                        src_mem ? src_mem->md() : nullptr,
+                        CTX_IN_MEM(const void *, DNNL_ARG_MULTIPLE_SRC + i),
+                        dst_ptr, in_place));
+                if (in_place) continue;
+
                 memory_t tent_dst_i(engine, pd()->src_image_md(i),
                         submemory_flags, dst_ptr);
 
@@ -20,7 +20,9 @@
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
 #include "common/type_helpers.hpp"
+
 #include "cpu/ref_layer_normalization.hpp"
+#include "cpu/simple_q10n.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -55,10 +57,14 @@ void ref_layer_normalization_fwd_t<d_type>::execute_forward(
             ? const_cast<float *>(CTX_IN_MEM(const float *, DNNL_ARG_VARIANCE))
             : CTX_OUT_MEM(float *, DNNL_ARG_VARIANCE);
 
-    auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+    auto residual = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC_1);
+    auto sum = CTX_OUT_MEM(data_t *, DNNL_ARG_DST_1);
 
     const memory_desc_wrapper src_d(pd()->src_md());
     const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper residual_d(pd()->residual_md());
+    const memory_desc_wrapper sum_d(pd()->sum_md());
     const memory_desc_wrapper stat_d(pd()->stat_md());
     const memory_desc_wrapper scaleshift_d(pd()->weights_md());
 
@@ -69,6 +75,10 @@ void ref_layer_normalization_fwd_t<d_type>::execute_forward(
     const bool use_scaleshift = pd()->use_scaleshift();
     const bool save_stats = pd()->is_training();
     const bool calculate_stats = !pd()->stats_are_src();
+    const bool with_residual = pd()->with_residual();
+    const bool with_sum = pd()->with_sum();
+    const float oscale = pd()->attr()->output_scales_.scales_[0];
+    const data_type_t dst_dt = dst_d.data_type();
 
     /* fast return */
     if (this->pd()->has_zero_dim_memory()) {
@@ -81,6 +91,29 @@ void ref_layer_normalization_fwd_t<d_type>::execute_forward(
         return;
     }
 
+    // the source with the residual added
+    auto load = [&](dim_t l_off) {
+        float x = maybe_up_convert(src[src_d.off_l(l_off)]);
+        if (with_residual)
+            x += maybe_up_convert(residual[residual_d.off_l(l_off)]);
+        return x;
+    };
+
+    auto store = [&](float d, dim_t l_off) {
+        const size_t dst_off = dst_d.off_l(l_off);
+        switch (dst_dt) {
+            case s8:
+                static_cast<int8_t *>(dst)[dst_off]
+                        = saturate_and_round<int8_t>(d);
+                break;
+            case u8:
+                static_cast<uint8_t *>(dst)[dst_off]
+                        = saturate_and_round<uint8_t>(d);
+                break;
+            default: static_cast<data_t *>(dst)[dst_off] = d; break;
+        }
+    };
+
     parallel_nd(N, [&](dim_t n) {
         const size_t s_off = stat_d.off_l(n);
         auto v_mean = calculate_stats ? 0 : mean[s_off];
@@ -88,11 +121,11 @@ void ref_layer_normalization_fwd_t<d_type>::execute_forward(
 
         if (calculate_stats) {
             for (dim_t c = 0; c < C; ++c)
-                v_mean += maybe_up_convert(src[src_d.off_l(n * C + c)]);
+                v_mean += load(n * C + c);
             v_mean /= C;
 
             for (dim_t c = 0; c < C; ++c) {
-                float m = src[src_d.off_l(n * C + c)] - v_mean;
+                float m = load(n * C + c) - v_mean;
                 v_variance += m * m;
             }
             v_variance /= C;
@@ -106,10 +139,10 @@ void ref_layer_normalization_fwd_t<d_type>::execute_forward(
                     / sqrt_variance;
             const float sv
                     = use_scaleshift ? scaleshift[scaleshift_d.off(1, c)] : 0;
-            const size_t dst_off = dst_d.off_l(n * C + c),
-                         src_off = src_d.off_l(n * C + c);
+            const float x = load(n * C + c);
+            if (with_sum) sum[sum_d.off_l(n * C + c)] = x;
 
-            dst[dst_off] = sm * (maybe_up_convert(src[src_off]) - v_mean) + sv;
+            store(oscale * (sm * (x - v_mean) + sv), n * C + c);
         }
 
         if (calculate_stats) {
@@ -44,12 +44,17 @@ struct ref_layer_normalization_fwd_t : public primitive_t {
 
         status_t init(engine_t *engine) {
             using namespace data_type;
+            using skip_mask_t = primitive_attr_t::skip_mask_t;
             bool ok = is_fwd() && platform::has_data_type_support(d_type)
                     && src_md()->data_type == d_type
+                    && utils::one_of(dst_md()->data_type, d_type, s8, u8)
+                    && IMPLICATION(with_residual(),
+                            residual_md()->data_type == d_type)
+                    && IMPLICATION(with_sum(), sum_md()->data_type == d_type)
                     && stat_md()->data_type == f32
                     && check_scale_shift_data_type()
-                    && attr()->has_default_values()
-                    && set_default_formats_common();
+                    && attr()->has_default_values(skip_mask_t::oscale)
+                    && attr_oscale_ok() && set_default_formats_common();
             if (!ok) return status::unimplemented;
 
             return status::success;
@@ -23,22 +23,23 @@
 #include "common/type_helpers.hpp"
 
 #include "cpu/ref_softmax.hpp"
+#include "cpu/simple_q10n.hpp"
 
 namespace dnnl {
 namespace impl {
 namespace cpu {
 
-template <impl::data_type_t data_type>
-void ref_softmax_fwd_t<data_type>::execute_forward_dense(
+template <impl::data_type_t src_type, impl::data_type_t dst_type>
+void ref_softmax_fwd_t<src_type, dst_type>::execute_forward_dense(
         const exec_ctx_t &ctx) const {
-    auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
-    auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+    auto src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(dst_data_t *, DNNL_ARG_DST);
 
     const auto ou_stride = pd()->outer_stride();
 
     parallel_nd(outer_size_, [&](int ou) {
-        const data_t *src_data = src + ou * ou_stride;
-        data_t *dst_data = dst + ou * ou_stride;
+        const src_data_t *src_data = src + ou * ou_stride;
+        dst_data_t *dst_data = dst + ou * ou_stride;
         float space_max = -FLT_MAX;
         float space_denom = 0;
         constexpr int unroll_factor = 32;
@@ -125,14 +126,51 @@ void ref_softmax_fwd_t<data_type>::execute_forward_dense(
     });
 }
 
-template <impl::data_type_t data_type>
-void ref_softmax_fwd_t<data_type>::execute_forward_generic(
+template <impl::data_type_t src_type, impl::data_type_t dst_type>
+void ref_softmax_fwd_t<src_type, dst_type>::execute_forward_generic(
         const exec_ctx_t &ctx) const {
 
-    auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
-    auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+    auto src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
+    auto mask = CTX_IN_MEM(const float *, DNNL_ARG_SRC_1);
+    auto dst = CTX_OUT_MEM(dst_data_t *, DNNL_ARG_DST);
 
     const memory_desc_wrapper data_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper mask_d(pd()->src_md(1));
+
+    const float src_scale
+            = pd()->attr()->scales_.get(DNNL_ARG_SRC).scales_[0];
+    const float dst_scale
+            = pd()->attr()->scales_.get(DNNL_ARG_DST).scales_[0];
+    const int ndims = pd()->ndims();
+    const int axis = pd()->axis();
+    // The exponents are kept in the destination unless it is not precise
+    // enough for them, then they are recomputed
+    const bool need_recompute
+            = utils::one_of(dst_type, data_type::s8, data_type::u8);
+
+    // The mask is plain and broadcast along the dimensions of size 1, so its
+    // offset is computed once per row along the softmax axis
+    const dim_t *mask_strides = mask_d.blocking_desc().strides;
+    const dim_t mask_c_stride
+            = mask && mask_d.dims()[axis] != 1 ? mask_strides[axis] : 0;
+    auto get_mask_row = [&](dim_t l_offset) -> const float * {
+        if (!mask) return nullptr;
+        dim_t off = mask_d.offset0();
+        for (int d = ndims - 1; d >= 0; --d) {
+            const dim_t pos = l_offset % data_d.dims()[d];
+            l_offset /= data_d.dims()[d];
+            if (mask_d.dims()[d] != 1) off += pos * mask_strides[d];
+        }
+        return mask + off;
+    };
+
+    // Returns the source value the softmax is computed for
+    auto load = [&](const float *mask_row, int c, size_t off) {
+        float s = src_scale * src[off];
+        if (mask_row) s += mask_row[c * mask_c_stride];
+        return s;
+    };
 
     parallel_nd(outer_size_, [&](int ou) {
         float space_max_val = 0, space_denom_val = 0;
@@ -150,36 +188,49 @@ void ref_softmax_fwd_t<data_type>::execute_forward_generic(
 
         for (int in = 0; in < inner_size_; in++) {
             dim_t ou_in_offset = ou * channels_ * inner_size_ + in;
+            const float *mask_row = get_mask_row(ou_in_offset);
 
             for (int c = 0; c < channels_; c++) {
                 size_t off = data_d.off_l(ou_in_offset + c * inner_size_);
-                space_max[in] = nstl::max(space_max[in], (float)src[off]);
+                space_max[in] = nstl::max(
+                        space_max[in], load(mask_row, c, off));
             }
 
             for (int c = 0; c < channels_; c++) {
-                size_t off = data_d.off_l(ou_in_offset + c * inner_size_);
+                dim_t l_off = ou_in_offset + c * inner_size_;
+                size_t off = data_d.off_l(l_off);
+                float D = load(mask_row, c, off) - space_max[in];
                 if (pd()->is_softmax()) {
-                    float D = expf(src[off] - space_max[in]);
+                    D = expf(D);
                     space_denom[in] += D;
-                    dst[off] = D;
                 } else if (pd()->is_logsoftmax()) {
-                    float D = src[off] - space_max[in];
                     space_denom[in] += expf(D);
-                    dst[off] = D;
                 }
+                if (!need_recompute) dst[dst_d.off_l(l_off)] = D;
             }
 
-            if (pd()->is_logsoftmax()) {
+            if (pd()->is_softmax()) {
+                space_denom[in] = space_denom[in] ? 1.f / space_denom[in] : 1.f;
+            } else if (pd()->is_logsoftmax()) {
                 space_denom[in] = logf(space_denom[in]);
             }
 
             for (int c = 0; c < channels_; c++) {
-                size_t off = data_d.off_l(ou_in_offset + c * inner_size_);
+                dim_t l_off = ou_in_offset + c * inner_size_;
+                size_t dst_off = dst_d.off_l(l_off);
+                float D;
+                if (need_recompute) {
+                    D = load(mask_row, c, data_d.off_l(l_off)) - space_max[in];
+                    if (pd()->is_softmax()) D = expf(D);
+                } else {
+                    D = dst[dst_off];
+                }
                 if (pd()->is_softmax()) {
-                    dst[off] = dst[off] / space_denom[in];
+                    D = D * space_denom[in];
                 } else if (pd()->is_logsoftmax()) {
-                    dst[off] = dst[off] - space_denom[in];
+                    D = D - space_denom[in];
                 }
+                dst[dst_off] = saturate_and_round<dst_data_t>(dst_scale * D);
             }
         }
     });
@@ -187,6 +238,10 @@ void ref_softmax_fwd_t<data_type>::execute_forward_generic(
 
 template struct ref_softmax_fwd_t<data_type::bf16>;
 template struct ref_softmax_fwd_t<data_type::f32>;
+template struct ref_softmax_fwd_t<data_type::f32, data_type::s8>;
+template struct ref_softmax_fwd_t<data_type::f32, data_type::u8>;
+template struct ref_softmax_fwd_t<data_type::bf16, data_type::s8>;
+template struct ref_softmax_fwd_t<data_type::bf16, data_type::u8>;
 
 // softmax along last physical dimension
 template <impl::data_type_t data_type>
@@ -31,7 +31,7 @@ namespace dnnl {
 namespace impl {
 namespace cpu {
 
-template <impl::data_type_t data_type>
+template <impl::data_type_t src_type, impl::data_type_t dst_type = src_type>
 struct ref_softmax_fwd_t : public primitive_t {
     struct pd_t : public cpu_softmax_fwd_pd_t {
         using cpu_softmax_fwd_pd_t::cpu_softmax_fwd_pd_t;
@@ -39,8 +39,15 @@ struct ref_softmax_fwd_t : public primitive_t {
         DECLARE_COMMON_PD_T("ref:any", ref_softmax_fwd_t);
 
         status_t init(engine_t *engine) {
-            bool ok = true && is_fwd() && src_md()->data_type == data_type
-                    && attr()->has_default_values();
+            using skip_mask_t = primitive_attr_t::skip_mask_t;
+            bool ok = true && is_fwd() && src_md()->data_type == src_type
+                    && dst_md()->data_type == dst_type
+                    && IMPLICATION(with_mask(),
+                            src_md(1)->data_type == data_type::f32)
+                    && attr()->has_default_values(skip_mask_t::scales)
+                    && attr_scales_ok() && set_default_formats()
+                    && IMPLICATION(with_mask(),
+                            memory_desc_wrapper(src_md(1)).is_plain());
             if (!ok) return status::unimplemented;
 
             init_scratchpad();
@@ -76,12 +83,17 @@ struct ref_softmax_fwd_t : public primitive_t {
             if (bd.inner_idxs[iblk] == axis)
                 axis_blk_size *= bd.inner_blks[iblk];
 
+        // The scales, the mask and the conversion are handled by the generic
+        // version only
         use_dense_ = true && inner_size_ == 1 && data_d.is_dense(true)
                 && data_d.only_padded_dim(axis)
-                && bd.strides[axis] == axis_blk_size;
+                && bd.strides[axis] == axis_blk_size
+                && data_d == memory_desc_wrapper(pd()->dst_md())
+                && !pd()->with_mask() && pd()->attr()->has_default_values();
     }
 
-    typedef typename prec_traits<data_type>::type data_t;
+    typedef typename prec_traits<src_type>::type src_data_t;
+    typedef typename prec_traits<dst_type>::type dst_data_t;
 
     status_t execute(const exec_ctx_t &ctx) const override {
         if (use_dense_)
@@ -14,16 +14,45 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <atomic>
 #include <cstring>
 
 #include "common/dnnl_thread.hpp"
 
+#if DNNL_X64
+#include "cpu/x64/jit_uni_concat_kernel.hpp"
+#endif
+
 #include "cpu/simple_concat.hpp"
 
 namespace dnnl {
 namespace impl {
 namespace cpu {
 
+namespace concat_utils {
+
+nt_copy_kernel_t *nt_copy_kernel_t::create() {
+#if DNNL_X64
+    return x64::concat_utils::nt_copy_kernel_create();
+#else
+    return nullptr;
+#endif
+}
+
+namespace {
+std::atomic<ptrdiff_t> nt_stores_threshold(-1);
+} // namespace
+
+void set_nt_stores_threshold(ptrdiff_t size) {
+    nt_stores_threshold = size;
+}
+
+ptrdiff_t get_nt_stores_threshold() {
+    return nt_stores_threshold;
+}
+
+} // namespace concat_utils
+
 using namespace memory_tracking::names;
 
 template <data_type_t data_type>
@@ -42,11 +71,18 @@ status_t simple_concat_t<data_type>::execute(const exec_ctx_t &ctx) const {
     for (int a = 0; a < num_arrs; ++a) {
         const memory_desc_wrapper i_d(pd()->src_md(a));
         const memory_desc_wrapper o_d(pd()->src_image_md(a));
+        const auto i_mem = ctx.input(DNNL_ARG_MULTIPLE_SRC + a);
+        const auto i_base_ptr
+                = CTX_IN_MEM(const data_t *, DNNL_ARG_MULTIPLE_SRC + a);
+
+        // The sources written in place are skipped by having nothing to copy
+        bool in_place = false;
+        CHECK(pd()->src_is_in_place(a, i_mem ? i_mem->md() : nullptr,
+                i_base_ptr, o_base_ptr, in_place));
 
-        iptrs[a] = CTX_IN_MEM(const data_t *, DNNL_ARG_MULTIPLE_SRC + a)
-                + i_d.blk_off(0);
+        iptrs[a] = i_base_ptr + i_d.blk_off(0);
         optrs[a] = o_base_ptr + o_d.blk_off(0);
-        nelems_to_copy[a] = pd()->nelems_to_concat(i_d);
+        nelems_to_copy[a] = in_place ? 0 : pd()->nelems_to_concat(i_d);
         for (int i = 0; i < DNNL_MAX_NDIMS; i++) {
             if (i < perm[concat_dim])
                 is[a][i] = size_t(i_d.blocking_desc().strides[iperm[i]]);
@@ -58,53 +94,79 @@ status_t simple_concat_t<data_type>::execute(const exec_ctx_t &ctx) const {
     const memory_desc_wrapper o_d(pd()->dst_md(0));
 
     strides_t os = {0};
-    bool has_outer_loop = false;
-    for (int i = 0; i < perm[concat_dim]; i++) {
-        os[i] = o_d.blocking_desc().strides[iperm[i]];
-        // CAVEAT: if this impl supports not matching stag and dtag, strides
-        // should be taken into account for this condition.
-        if (o_d.padded_dims()[iperm[i]] != 1) has_outer_loop = true;
-    }
-
-    // Applies when concat axis is the outermost dimension, e.g. concat_axis = 0
-    // or concat_axis = 1, and dims[0] = 1;
-    if (!has_outer_loop) {
-        for (int a = 0; a < num_arrs; ++a) {
-            const data_t *i = &iptrs[a][0];
-            data_t *o = &optrs[a][0];
-            parallel_nd(nelems_to_copy[a], [&](dim_t e) { o[e] = i[e]; });
-        }
-        return status::success;
-    }
-
     dims_t phys_dims;
     for (int i = 0; i < DNNL_MAX_NDIMS; i++) {
-        if (i < perm[concat_dim])
-            phys_dims[i]
-                    = o_d.padded_dims()[iperm[i]] / pd()->blocks_[iperm[i]];
-        else
+        if (i < perm[concat_dim]) {
+            os[i] = o_d.blocking_desc().strides[iperm[i]];
+            phys_dims[i] = o_d.padded_dims()[iperm[i]]
+                    / pd()->blocks_[iperm[i]];
+        } else
             phys_dims[i] = 1;
     }
 
-    parallel_nd(phys_dims[0], phys_dims[1], phys_dims[2], phys_dims[3],
-            phys_dims[4], num_arrs,
-            [&](dim_t n0, dim_t n1, dim_t n2, dim_t n3, dim_t n4, int a) {
-                // XXX: this code may access uninitialized values in is[*][0-4] --
-                // that's why we have to set them to zero although this is
-                // probably benign
-                size_t in_off = is[a][0] * n0 + is[a][1] * n1 + is[a][2] * n2
-                        + is[a][3] * n3 + is[a][4] * n4;
-                size_t out_off = os[0] * n0 + os[1] * n1 + os[2] * n2
-                        + os[3] * n3 + os[4] * n4;
-                const data_t *i = &iptrs[a][in_off];
-                data_t *o = &optrs[a][out_off];
+    // The work is the destination in the order of the outer dimensions, the
+    // inputs and the contiguous elements of an input. It is split evenly
+    // between the threads in a single parallel region, so that neither the
+    // number of inputs nor the difference of their sizes cause imbalance or
+    // additional synchronization.
+    dim_t nelems_per_outer = 0;
+    for (int a = 0; a < num_arrs; ++a)
+        nelems_per_outer += nelems_to_copy[a];
+    const dim_t work_amount = phys_dims[0] * phys_dims[1] * phys_dims[2]
+            * phys_dims[3] * phys_dims[4] * nelems_per_outer;
+    if (work_amount == 0) return status::success;
+
+    // Copying less than a page per thread does not pay off the threads
+    // synchronization
+    const dim_t min_nelems_per_thr = 4096 / sizeof(data_t);
+    const int nthr = (int)nstl::min<dim_t>(dnnl_get_max_threads(),
+            utils::div_up(work_amount, min_nelems_per_thr));
+
+    const auto *nt_copy = nt_copy_kernel_.get();
+    const auto copy = [&](data_t *o, const data_t *i, dim_t nelems) {
+        if (nt_copy) {
+            (*nt_copy)(o, i, nelems * sizeof(data_t));
+            return;
+        }
 #if defined(__GNUC__) && !defined(__INTEL_COMPILER)
-                std::memcpy(o, i, nelems_to_copy[a] * sizeof(data_t));
+        std::memcpy(o, i, nelems * sizeof(data_t));
 #else
-                PRAGMA_OMP_SIMD()
-                for (dim_t e = 0; e < nelems_to_copy[a]; ++e) o[e] = i[e];
+        PRAGMA_OMP_SIMD()
+        for (dim_t e = 0; e < nelems; ++e)
+            o[e] = i[e];
 #endif
-            });
+    };
+
+    parallel(nthr, [&](int ithr, int nthr) {
+        dim_t start {0}, end {0};
+        balance211(work_amount, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        dim_t n0 {0}, n1 {0}, n2 {0}, n3 {0}, n4 {0}, e {0};
+        utils::nd_iterator_init(start, n0, phys_dims[0], n1, phys_dims[1], n2,
+                phys_dims[2], n3, phys_dims[3], n4, phys_dims[4], e,
+                nelems_per_outer);
+        int a = 0;
+        while (e >= nelems_to_copy[a])
+            e -= nelems_to_copy[a++];
+
+        while (start < end) {
+            const dim_t nelems = nstl::min(nelems_to_copy[a] - e, end - start);
+            const size_t in_off = is[a][0] * n0 + is[a][1] * n1
+                    + is[a][2] * n2 + is[a][3] * n3 + is[a][4] * n4;
+            const size_t out_off = os[0] * n0 + os[1] * n1 + os[2] * n2
+                    + os[3] * n3 + os[4] * n4;
+            copy(&optrs[a][out_off + e], &iptrs[a][in_off + e], nelems);
+
+            start += nelems;
+            e = 0;
+            if (++a == num_arrs) {
+                a = 0;
+                utils::nd_iterator_step(n0, phys_dims[0], n1, phys_dims[1], n2,
+                        phys_dims[2], n3, phys_dims[3], n4, phys_dims[4]);
+            }
+        }
+    });
 
     return status::success;
 }
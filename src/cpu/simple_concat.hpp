@@ -17,6 +17,8 @@
 #ifndef CPU_SIMPLE_CONCAT_HPP
 #define CPU_SIMPLE_CONCAT_HPP
 
+#include <memory>
+
 #include "common/memory_tracking.hpp"
 #include "common/primitive.hpp"
 
@@ -28,6 +30,28 @@ namespace dnnl {
 namespace impl {
 namespace cpu {
 
+namespace concat_utils {
+
+// Copies the bytes bypassing the caches with non-temporal stores, which saves
+// the reads of the destination lines and keeps the caches for the consumers
+// of the other data when the destination does not fit into the caches anyway.
+struct nt_copy_kernel_t {
+    // Returns nullptr if the non-temporal copy is not available on the
+    // platform
+    static nt_copy_kernel_t *create();
+    virtual ~nt_copy_kernel_t() = default;
+
+    virtual void operator()(void *dst, const void *src, size_t size) const = 0;
+};
+
+// Overrides the size of the destination in bytes above which the copies use
+// non-temporal stores, the size of the last level cache by default. A
+// negative size restores the default. Intended for testing only.
+void DNNL_API set_nt_stores_threshold(ptrdiff_t size);
+ptrdiff_t get_nt_stores_threshold();
+
+} // namespace concat_utils
+
 template <data_type_t data_type>
 struct simple_concat_t : public primitive_t {
     struct pd_t : public cpu_concat_pd_t {
@@ -88,6 +112,15 @@ struct simple_concat_t : public primitive_t {
                 }
             }
 
+            // Non-temporal stores pay off only if the destination would
+            // evict itself from the last level cache anyway
+            const size_t llc_size = (size_t)platform::get_per_core_cache_size(3)
+                    * dnnl_get_max_threads();
+            const ptrdiff_t threshold = concat_utils::get_nt_stores_threshold();
+            use_nt_stores_ = threshold >= 0
+                    ? dst_d.size() > (size_t)threshold
+                    : llc_size > 0 && dst_d.size() > llc_size;
+
             init_scratchpad();
 
             return status::success;
@@ -96,6 +129,7 @@ struct simple_concat_t : public primitive_t {
         int perm_[DNNL_MAX_NDIMS] {};
         int iperm_[DNNL_MAX_NDIMS] {};
         dims_t blocks_ {};
+        bool use_nt_stores_ = false;
 
         dim_t nelems_to_concat(const memory_desc_wrapper &data_d) const {
             const int ndims = data_d.ndims();
@@ -150,17 +184,26 @@ struct simple_concat_t : public primitive_t {
             utils::array_copy(perm_, rhs.perm_, ndims);
             utils::array_copy(iperm_, rhs.iperm_, ndims);
             utils::array_copy(blocks_, rhs.blocks_, ndims);
+            use_nt_stores_ = rhs.use_nt_stores_;
         }
     };
 
     simple_concat_t(const pd_t *apd) : primitive_t(apd) {}
 
+    status_t init(engine_t *engine) override {
+        if (pd()->use_nt_stores_)
+            nt_copy_kernel_.reset(concat_utils::nt_copy_kernel_t::create());
+        return status::success;
+    }
+
     status_t execute(const exec_ctx_t &ctx) const override;
 
     typedef typename prec_traits<data_type>::type data_t;
 
 private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<concat_utils::nt_copy_kernel_t> nt_copy_kernel_;
 };
 
 } // namespace cpu
@@ -0,0 +1,338 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <assert.h>
+#include <math.h>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_batch_normalization_utils.hpp"
+#include "cpu/simple_group_normalization.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+using namespace memory_tracking::names;
+
+void simple_group_normalization_fwd_t::execute_forward(
+        const exec_ctx_t &ctx) const {
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper scaleshift_d(pd()->weights_md());
+
+    auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC) + src_d.offset0();
+    auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST) + dst_d.offset0();
+    auto scaleshift = CTX_IN_MEM(const float *, DNNL_ARG_SCALE_SHIFT);
+
+    auto scratchpad = ctx.get_scratchpad_grantor();
+    float *mean, *variance;
+    if (pd()->stats_are_src()) {
+        mean = const_cast<float *>(CTX_IN_MEM(const float *, DNNL_ARG_MEAN));
+        variance = const_cast<float *>(
+                CTX_IN_MEM(const float *, DNNL_ARG_VARIANCE));
+    } else if (pd()->stats_are_tmp()) {
+        mean = scratchpad.get<float>(key_gnorm_tmp_mean);
+        variance = scratchpad.get<float>(key_gnorm_tmp_var);
+    } else {
+        mean = CTX_OUT_MEM(float *, DNNL_ARG_MEAN);
+        variance = CTX_OUT_MEM(float *, DNNL_ARG_VARIANCE);
+    }
+
+    const dim_t N = pd()->MB();
+    const dim_t C = pd()->C();
+    const dim_t G = pd()->G();
+    const dim_t C_per_G = pd()->C_per_G();
+    const dim_t SP = pd()->D() * pd()->H() * pd()->W();
+    const dim_t sp_block = pd()->sp_block_;
+    const dim_t nb_sp = utils::div_up(SP, sp_block);
+    const bool is_nspc = pd()->is_nspc_;
+
+    const float eps = pd()->desc()->group_norm_epsilon;
+    const bool use_scaleshift = pd()->use_scaleshift();
+    const bool calculate_stats = !pd()->stats_are_src();
+
+    // The statistics are computed in a single pass with the double precision
+    // sums shifted by the first value of the group, see
+    // bnorm_utils::accumulate_shifted_sums()
+    if (calculate_stats && !is_nspc) {
+        // The channels of a group are contiguous
+        parallel_nd(N, G, [&](dim_t n, dim_t g) {
+            const float *s = src + (n * C + g * C_per_G) * SP;
+            double s1 = 0, s2 = 0;
+            bnorm_utils::accumulate_shifted_sums(s1, s2, s[0], s, C_per_G * SP);
+            bnorm_utils::finalize_shifted_sums((double)(C_per_G * SP), s[0],
+                    s1, s2, mean[n * G + g], variance[n * G + g]);
+        });
+    } else if (calculate_stats) {
+        // The per channel sums of the blocks of the spatial points are
+        // computed with the vectors over the channels, then added per group.
+        // The shifts are kept per channel in the coefficients, which are
+        // only computed after the statistics.
+        double *reduction = scratchpad.get<double>(key_gnorm_reduction);
+        float *shift = scratchpad.get<float>(key_gnorm_tmp_coeff);
+        parallel_nd(N, C, [&](dim_t n, dim_t c) {
+            shift[n * C + c] = src[n * SP * C + c / C_per_G * C_per_G];
+        });
+        parallel_nd(N, nb_sp, [&](dim_t n, dim_t b) {
+            const dim_t sp_s = b * sp_block;
+            const dim_t sp_e = nstl::min(sp_s + sp_block, SP);
+            const float *n_shift = shift + n * C;
+            double *b_s1 = reduction + (n * nb_sp + b) * 2 * C;
+            double *b_s2 = b_s1 + C;
+
+            PRAGMA_OMP_SIMD()
+            for (dim_t c = 0; c < C; ++c) {
+                b_s1[c] = 0;
+                b_s2[c] = 0;
+            }
+            for (dim_t sp = sp_s; sp < sp_e; ++sp) {
+                const float *s = src + (n * SP + sp) * C;
+                PRAGMA_OMP_SIMD()
+                for (dim_t c = 0; c < C; ++c) {
+                    const double d = (double)s[c] - n_shift[c];
+                    b_s1[c] += d;
+                    b_s2[c] += d * d;
+                }
+            }
+        });
+        parallel_nd(N, G, [&](dim_t n, dim_t g) {
+            double s1 = 0, s2 = 0;
+            for (dim_t b = 0; b < nb_sp; ++b) {
+                const double *b_s1 = reduction + (n * nb_sp + b) * 2 * C;
+                const double *b_s2 = b_s1 + C;
+                for (dim_t c = g * C_per_G; c < (g + 1) * C_per_G; ++c) {
+                    s1 += b_s1[c];
+                    s2 += b_s2[c];
+                }
+            }
+            bnorm_utils::finalize_shifted_sums((double)(C_per_G * SP),
+                    shift[n * C + g * C_per_G], s1, s2, mean[n * G + g],
+                    variance[n * G + g]);
+        });
+    }
+
+    auto get_scale_shift = [&](dim_t n, dim_t c, float &sm, float &sv) {
+        const float inv_std = 1.f / sqrtf(variance[n * G + c / C_per_G] + eps);
+        sm = use_scaleshift ? scaleshift[scaleshift_d.off(0, c)] * inv_std
+                            : inv_std;
+        sv = use_scaleshift ? scaleshift[scaleshift_d.off(1, c)] : 0.f;
+    };
+
+    if (!is_nspc) {
+        parallel_nd(N, C, [&](dim_t n, dim_t c) {
+            float sm, sv;
+            get_scale_shift(n, c, sm, sv);
+            const float v_mean = mean[n * G + c / C_per_G];
+            const float *s = src + (n * C + c) * SP;
+            float *d = dst + (n * C + c) * SP;
+            PRAGMA_OMP_SIMD()
+            for (dim_t sp = 0; sp < SP; ++sp)
+                d[sp] = sm * (s[sp] - v_mean) + sv;
+        });
+        return;
+    }
+
+    // The coefficients of a point are the vectors of the scales, the means
+    // and the shifts of all the channels
+    float *coeff = scratchpad.get<float>(key_gnorm_tmp_coeff);
+    parallel_nd(N, C, [&](dim_t n, dim_t c) {
+        float *n_coeff = coeff + n * 3 * C;
+        get_scale_shift(n, c, n_coeff[c], n_coeff[2 * C + c]);
+        n_coeff[C + c] = mean[n * G + c / C_per_G];
+    });
+    parallel_nd(N, SP, [&](dim_t n, dim_t sp) {
+        const float *sm = coeff + n * 3 * C;
+        const float *v_mean = sm + C;
+        const float *sv = sm + 2 * C;
+        const float *s = src + (n * SP + sp) * C;
+        float *d = dst + (n * SP + sp) * C;
+        PRAGMA_OMP_SIMD()
+        for (dim_t c = 0; c < C; ++c)
+            d[c] = sm[c] * (s[c] - v_mean[c]) + sv[c];
+    });
+}
+
+void simple_group_normalization_bwd_t::execute_backward(
+        const exec_ctx_t &ctx) const {
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
+    const memory_desc_wrapper diff_src_d(pd()->diff_src_md());
+    const memory_desc_wrapper scaleshift_d(pd()->weights_md());
+    const memory_desc_wrapper diff_scaleshift_d(pd()->diff_weights_md());
+
+    auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC) + src_d.offset0();
+    auto mean = CTX_IN_MEM(const float *, DNNL_ARG_MEAN);
+    auto variance = CTX_IN_MEM(const float *, DNNL_ARG_VARIANCE);
+    auto diff_dst = CTX_IN_MEM(const float *, DNNL_ARG_DIFF_DST)
+            + diff_dst_d.offset0();
+    auto scaleshift = CTX_IN_MEM(const float *, DNNL_ARG_SCALE_SHIFT);
+    auto diff_src
+            = CTX_OUT_MEM(float *, DNNL_ARG_DIFF_SRC) + diff_src_d.offset0();
+    auto diff_scaleshift = CTX_OUT_MEM(float *, DNNL_ARG_DIFF_SCALE_SHIFT);
+
+    auto scratchpad = ctx.get_scratchpad_grantor();
+    float *reduction = scratchpad.get<float>(key_gnorm_reduction);
+    float *coeff = scratchpad.get<float>(key_gnorm_tmp_coeff);
+
+    const dim_t N = pd()->MB();
+    const dim_t C = pd()->C();
+    const dim_t G = pd()->G();
+    const dim_t C_per_G = pd()->C_per_G();
+    const dim_t SP = pd()->D() * pd()->H() * pd()->W();
+    const dim_t M = C_per_G * SP;
+    const dim_t sp_block = pd()->sp_block_;
+    const dim_t nb_sp = utils::div_up(SP, sp_block);
+    const bool is_nspc = pd()->is_nspc_;
+
+    const float eps = pd()->desc()->group_norm_epsilon;
+    const bool use_scaleshift = pd()->use_scaleshift();
+    const bool calculate_diff_stats = !pd()->use_global_stats();
+
+    auto inv_std = [&](dim_t n, dim_t c) {
+        return 1.f / sqrtf(variance[n * G + c / C_per_G] + eps);
+    };
+    auto gamma = [&](dim_t c) {
+        return use_scaleshift ? scaleshift[scaleshift_d.off(0, c)] : 1.f;
+    };
+
+    // The coefficients of a channel: diff_src = a * diff_dst
+    // + b * (src - mean) + c, a is the only one that depends on the channel
+    // rather than on the group
+    auto coeff_a = [&](dim_t n) { return coeff + n * 4 * C; };
+    auto coeff_b = [&](dim_t n) { return coeff + n * 4 * C + C; };
+    auto coeff_c = [&](dim_t n) { return coeff + n * 4 * C + 2 * C; };
+    auto coeff_mean = [&](dim_t n) { return coeff + n * 4 * C + 3 * C; };
+
+    // The per channel sums of diff_dst and of diff_dst * (src - mean). For
+    // the channels last layout they are reduced over the blocks of the
+    // spatial points into the first block.
+    auto sum_dd = [&](dim_t n) { return reduction + n * nb_sp * 2 * C; };
+    auto sum_ddx = [&](dim_t n) { return reduction + n * nb_sp * 2 * C + C; };
+
+    parallel_nd(N, C, [&](dim_t n, dim_t c) {
+        coeff_mean(n)[c] = mean[n * G + c / C_per_G];
+    });
+
+    if (!is_nspc) {
+        parallel_nd(N, C, [&](dim_t n, dim_t c) {
+            const float v_mean = coeff_mean(n)[c];
+            const float *s = src + (n * C + c) * SP;
+            const float *dd = diff_dst + (n * C + c) * SP;
+            float v_sum_dd = 0, v_sum_ddx = 0;
+            PRAGMA_OMP_SIMD(reduction(+ : v_sum_dd, v_sum_ddx))
+            for (dim_t sp = 0; sp < SP; ++sp) {
+                v_sum_dd += dd[sp];
+                v_sum_ddx += dd[sp] * (s[sp] - v_mean);
+            }
+            sum_dd(n)[c] = v_sum_dd;
+            sum_ddx(n)[c] = v_sum_ddx;
+        });
+    } else {
+        parallel_nd(N, nb_sp, [&](dim_t n, dim_t b) {
+            const dim_t sp_s = b * sp_block;
+            const dim_t sp_e = nstl::min(sp_s + sp_block, SP);
+            const float *v_mean = coeff_mean(n);
+            float *b_sum_dd = sum_dd(n) + b * 2 * C;
+            float *b_sum_ddx = sum_ddx(n) + b * 2 * C;
+
+            PRAGMA_OMP_SIMD()
+            for (dim_t c = 0; c < C; ++c) {
+                b_sum_dd[c] = 0;
+                b_sum_ddx[c] = 0;
+            }
+            for (dim_t sp = sp_s; sp < sp_e; ++sp) {
+                const float *s = src + (n * SP + sp) * C;
+                const float *dd = diff_dst + (n * SP + sp) * C;
+                PRAGMA_OMP_SIMD()
+                for (dim_t c = 0; c < C; ++c) {
+                    b_sum_dd[c] += dd[c];
+                    b_sum_ddx[c] += dd[c] * (s[c] - v_mean[c]);
+                }
+            }
+        });
+        if (nb_sp > 1)
+            parallel_nd(N, C, [&](dim_t n, dim_t c) {
+                for (dim_t b = 1; b < nb_sp; ++b) {
+                    sum_dd(n)[c] += sum_dd(n)[b * 2 * C + c];
+                    sum_ddx(n)[c] += sum_ddx(n)[b * 2 * C + c];
+                }
+            });
+    }
+
+    if (diff_scaleshift) {
+        parallel_nd(C, [&](dim_t c) {
+            float diff_gamma = 0, diff_beta = 0;
+            for (dim_t n = 0; n < N; ++n) {
+                diff_gamma += sum_ddx(n)[c] * inv_std(n, c);
+                diff_beta += sum_dd(n)[c];
+            }
+            diff_scaleshift[diff_scaleshift_d.off(0, c)] = diff_gamma;
+            diff_scaleshift[diff_scaleshift_d.off(1, c)] = diff_beta;
+        });
+    }
+
+    parallel_nd(N, G, [&](dim_t n, dim_t g) {
+        const dim_t C_s = g * C_per_G, C_e = C_s + C_per_G;
+        const float v_inv_std = inv_std(n, C_s);
+        float dd_gamma = 0, dd_gamma_x = 0;
+        if (calculate_diff_stats) {
+            for (dim_t c = C_s; c < C_e; ++c) {
+                dd_gamma += gamma(c) * sum_dd(n)[c];
+                dd_gamma_x += gamma(c) * sum_ddx(n)[c];
+            }
+        }
+        const float b = -dd_gamma_x * v_inv_std * v_inv_std * v_inv_std / M;
+        const float c_ = -dd_gamma * v_inv_std / M;
+        for (dim_t c = C_s; c < C_e; ++c) {
+            coeff_a(n)[c] = gamma(c) * v_inv_std;
+            coeff_b(n)[c] = b;
+            coeff_c(n)[c] = c_;
+        }
+    });
+
+    if (!is_nspc) {
+        parallel_nd(N, C, [&](dim_t n, dim_t c) {
+            const float a = coeff_a(n)[c], b = coeff_b(n)[c];
+            const float c_ = coeff_c(n)[c], v_mean = coeff_mean(n)[c];
+            const float *s = src + (n * C + c) * SP;
+            const float *dd = diff_dst + (n * C + c) * SP;
+            float *ds = diff_src + (n * C + c) * SP;
+            PRAGMA_OMP_SIMD()
+            for (dim_t sp = 0; sp < SP; ++sp)
+                ds[sp] = a * dd[sp] + b * (s[sp] - v_mean) + c_;
+        });
+    } else {
+        parallel_nd(N, SP, [&](dim_t n, dim_t sp) {
+            const float *a = coeff_a(n), *b = coeff_b(n);
+            const float *c_ = coeff_c(n), *v_mean = coeff_mean(n);
+            const float *s = src + (n * SP + sp) * C;
+            const float *dd = diff_dst + (n * SP + sp) * C;
+            float *ds = diff_src + (n * SP + sp) * C;
+            PRAGMA_OMP_SIMD()
+            for (dim_t c = 0; c < C; ++c)
+                ds[c] = a[c] * dd[c] + b[c] * (s[c] - v_mean[c]) + c_[c];
+        });
+    }
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
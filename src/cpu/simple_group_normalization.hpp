@@ -0,0 +1,203 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_SIMPLE_GROUP_NORMALIZATION_HPP
+#define CPU_SIMPLE_GROUP_NORMALIZATION_HPP
+
+#include <assert.h>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/cpu_group_normalization_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace gnorm_utils {
+// Returns the number of the spatial points processed at once when the
+// statistics or the gradients of the channels last layout are reduced. Every
+// block has its own partial sums, so the blocks are processed in parallel.
+inline dim_t nspc_sp_block(dim_t C, dim_t SP) {
+    const dim_t blk = platform::get_per_core_cache_size(2) / 2
+            / (C * sizeof(float));
+    return nstl::max((dim_t)1, nstl::min(SP, blk));
+}
+} // namespace gnorm_utils
+
+struct simple_group_normalization_fwd_t : public primitive_t {
+    struct pd_t : public cpu_group_normalization_fwd_pd_t {
+        using cpu_group_normalization_fwd_pd_t::
+                cpu_group_normalization_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T("simple_group_normalization:any",
+                simple_group_normalization_fwd_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+            using namespace format_tag;
+
+            bool ok = is_fwd() && !has_zero_dim_memory()
+                    && utils::everyone_is(f32, src_md()->data_type,
+                            dst_md()->data_type, stat_md()->data_type)
+                    && check_scale_shift_data_type()
+                    && attr()->has_default_values()
+                    && set_default_formats_common()
+                    && memory_desc_matches_tag(*stat_md(), ab);
+            if (!ok) return status::unimplemented;
+
+            const int nd = ndims() - 3;
+            const auto nspc_tag = ndims() == 2
+                    ? nc
+                    : utils::pick(nd, nwc, nhwc, ndhwc);
+            const auto ncsp_tag = ndims() == 2
+                    ? nc
+                    : utils::pick(nd, ncw, nchw, ncdhw);
+            if (memory_desc_matches_tag(*src_md(), ncsp_tag))
+                is_nspc_ = false;
+            else if (memory_desc_matches_tag(*src_md(), nspc_tag))
+                is_nspc_ = true;
+            else
+                return status::unimplemented;
+
+            const dim_t SP = D() * H() * W();
+            sp_block_ = is_nspc_ ? gnorm_utils::nspc_sp_block(C(), SP) : SP;
+
+            init_scratchpad();
+            return status::success;
+        }
+
+        // If true, the channels are the innermost dimension
+        bool is_nspc_ = false;
+        dim_t sp_block_ = 0;
+
+    private:
+        void init_scratchpad() {
+            using namespace memory_tracking::names;
+            auto scratchpad = scratchpad_registry().registrar();
+            if (stats_are_tmp()) {
+                scratchpad.template book<float>(key_gnorm_tmp_mean, MB() * G());
+                scratchpad.template book<float>(key_gnorm_tmp_var, MB() * G());
+            }
+            if (is_nspc_) {
+                const dim_t nb_sp
+                        = utils::div_up(D() * H() * W(), sp_block_);
+                if (!stats_are_src())
+                    scratchpad.template book<double>(
+                            key_gnorm_reduction, MB() * nb_sp * 2 * C());
+                scratchpad.template book<float>(
+                        key_gnorm_tmp_coeff, MB() * 3 * C());
+            }
+        }
+    };
+
+    simple_group_normalization_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        execute_forward(ctx);
+        return status::success;
+    }
+
+private:
+    void execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+struct simple_group_normalization_bwd_t : public primitive_t {
+    struct pd_t : public cpu_group_normalization_bwd_pd_t {
+        using cpu_group_normalization_bwd_pd_t::
+                cpu_group_normalization_bwd_pd_t;
+
+        DECLARE_COMMON_PD_T("simple_group_normalization:any",
+                simple_group_normalization_bwd_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+            using namespace format_tag;
+
+            bool ok = is_bwd() && !has_zero_dim_memory()
+                    && set_default_formats_common()
+                    && utils::everyone_is(f32, src_md()->data_type,
+                            diff_src_md()->data_type, stat_md()->data_type)
+                    && check_scale_shift_data_type()
+                    && attr()->has_default_values()
+                    && memory_desc_matches_tag(*stat_md(), ab);
+            if (!ok) return status::unimplemented;
+
+            const int nd = ndims() - 3;
+            const auto nspc_tag = ndims() == 2
+                    ? nc
+                    : utils::pick(nd, nwc, nhwc, ndhwc);
+            const auto ncsp_tag = ndims() == 2
+                    ? nc
+                    : utils::pick(nd, ncw, nchw, ncdhw);
+            if (memory_desc_matches_tag(*src_md(), ncsp_tag)
+                    && memory_desc_matches_tag(*diff_src_md(), ncsp_tag))
+                is_nspc_ = false;
+            else if (memory_desc_matches_tag(*src_md(), nspc_tag)
+                    && memory_desc_matches_tag(*diff_src_md(), nspc_tag))
+                is_nspc_ = true;
+            else
+                return status::unimplemented;
+
+            const dim_t SP = D() * H() * W();
+            sp_block_ = is_nspc_ ? gnorm_utils::nspc_sp_block(C(), SP) : SP;
+
+            init_scratchpad();
+            return status::success;
+        }
+
+        bool is_nspc_ = false;
+        dim_t sp_block_ = 0;
+
+    private:
+        void init_scratchpad() {
+            using namespace memory_tracking::names;
+            auto scratchpad = scratchpad_registry().registrar();
+            const dim_t nb_sp = utils::div_up(D() * H() * W(), sp_block_);
+            scratchpad.template book<float>(
+                    key_gnorm_reduction, MB() * nb_sp * 2 * C());
+            scratchpad.template book<float>(
+                    key_gnorm_tmp_coeff, MB() * 4 * C());
+        }
+    };
+
+    simple_group_normalization_bwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        execute_backward(ctx);
+        return status::success;
+    }
+
+private:
+    void execute_backward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
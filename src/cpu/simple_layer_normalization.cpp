@@ -23,6 +23,7 @@
 
 #include "cpu/cpu_batch_normalization_utils.hpp"
 #include "cpu/cpu_engine.hpp"
+#include "cpu/simple_q10n.hpp"
 
 #include "cpu/simple_layer_normalization.hpp"
 
@@ -62,25 +63,47 @@ status_t create_reorder_pd(engine_t *engine, const memory_desc_t *from_md,
     }
     return status::success;
 }
+
+template <typename out_t>
+void normalize_row(out_t *dst, const float *x, const float *ss, float mean,
+        float inv_sqrtvar, float oscale, bool use_scaleshift, dim_t C) {
+    PRAGMA_OMP_SIMD()
+    for (dim_t c = 0; c < C; ++c) {
+        const float sm = (use_scaleshift ? ss[c] : 1.0f) * inv_sqrtvar;
+        const float sv = use_scaleshift ? ss[C + c] : 0;
+        dst[c] = saturate_and_round<out_t>(oscale * (sm * (x[c] - mean) + sv));
+    }
+}
 } // namespace
 
 template <data_type_t data_type>
 status_t simple_layer_normalization_fwd_t<data_type>::pd_t::init(
         engine_t *engine) {
     using namespace data_type;
+    using skip_mask_t = primitive_attr_t::skip_mask_t;
     const memory_desc_wrapper src_d(src_md());
 
     const bool ok = is_fwd() && !has_zero_dim_memory()
             && platform::has_data_type_support(data_type)
-            && utils::everyone_is(
-                    data_type, src_md()->data_type, dst_md()->data_type)
+            && src_md()->data_type == data_type
+            && utils::one_of(dst_md()->data_type, data_type, s8, u8)
+            && IMPLICATION(
+                    with_residual(), residual_md()->data_type == data_type)
+            && IMPLICATION(with_sum(), sum_md()->data_type == data_type)
             && (f32 == stat_md()->data_type) && check_scale_shift_data_type()
             && src_d.is_blocking_desc()
             && src_d.blocking_desc().strides[ndims() - 1]
                     == 1 // plain format, last logical dim is last physical
-            && attr()->has_default_values() && set_default_formats_common();
+            && attr()->has_default_values(skip_mask_t::oscale)
+            && attr_oscale_ok() && set_default_formats_common();
     if (!ok) return status::unimplemented;
 
+    // The fused row loop addresses all the tensors with the source offsets
+    for (auto md : {dst_md(), residual_md(), sum_md()})
+        if (!types::is_zero_md(md)
+                && !memory_desc_wrapper(md).similar_to(src_d, true, false))
+            return status::unimplemented;
+
     CHECK(fill_compatible_stats_md(*src_md(), reordered_stat_md_));
 
     if (reordered_stat_md_ != *stat_md() && !stats_are_tmp()) {
@@ -116,6 +139,11 @@ void simple_layer_normalization_fwd_t<data_type>::execute_forward(
                 : CTX_OUT_MEM(float *, DNNL_ARG_VARIANCE);
     }
 
+    if (pd()->with_fusion()) {
+        execute_forward_fused(ctx, mean, variance);
+        return;
+    }
+
     const memory_desc_wrapper src_d(pd()->src_md());
 
     const dim_t N = pd()->across_axis();
@@ -143,6 +171,100 @@ void simple_layer_normalization_fwd_t<data_type>::execute_forward(
     });
 }
 
+template <data_type_t data_type>
+void simple_layer_normalization_fwd_t<data_type>::execute_forward_fused(
+        const exec_ctx_t &ctx, float *mean, float *variance) const {
+    auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
+    auto residual = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC_1);
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+    auto sum = CTX_OUT_MEM(data_t *, DNNL_ARG_DST_1);
+    auto scaleshift = CTX_IN_MEM(const float *, DNNL_ARG_SCALE_SHIFT);
+    float *tmp_sum = ctx.get_scratchpad_grantor().template get<float>(
+            key_lnorm_tmp_sum);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+
+    const dim_t N = pd()->across_axis();
+    const dim_t C = pd()->norm_axis();
+    const dim_t C_padded = src_d.padded_dims()[pd()->ndims() - 1];
+
+    const float eps = pd()->desc()->layer_norm_epsilon;
+    const bool use_scaleshift = pd()->use_scaleshift();
+    const bool save_stats = pd()->is_training();
+    const bool calculate_stats = !pd()->stats_are_src();
+    const float oscale = pd()->attr()->output_scales_.scales_[0];
+    const data_type_t dst_dt = pd()->dst_md()->data_type;
+
+    // The sum of a row is kept in f32 between the statistics and the
+    // normalization, so the source and the residual are read once
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(N, nthr, ithr, start, end);
+        float *x = tmp_sum + ithr * C;
+
+        for (dim_t n = start; n < end; ++n) {
+            const data_t *s = src + n * C_padded;
+            if (residual) {
+                const data_t *r = residual + n * C_padded;
+                PRAGMA_OMP_SIMD()
+                for (dim_t c = 0; c < C; ++c)
+                    x[c] = (float)s[c] + (float)r[c];
+            } else {
+                PRAGMA_OMP_SIMD()
+                for (dim_t c = 0; c < C; ++c)
+                    x[c] = s[c];
+            }
+            if (sum) {
+                data_t *d = sum + n * C_padded;
+                PRAGMA_OMP_SIMD()
+                for (dim_t c = 0; c < C; ++c)
+                    d[c] = x[c];
+            }
+
+            float v_mean = 0, v_variance = 0;
+            if (calculate_stats) {
+                PRAGMA_OMP_SIMD(reduction(+ : v_mean))
+                for (dim_t c = 0; c < C; ++c)
+                    v_mean += x[c];
+                v_mean /= C;
+                PRAGMA_OMP_SIMD(reduction(+ : v_variance))
+                for (dim_t c = 0; c < C; ++c) {
+                    const float m = x[c] - v_mean;
+                    v_variance += m * m;
+                }
+                v_variance /= C;
+                if (save_stats) {
+                    mean[n] = v_mean;
+                    variance[n] = v_variance;
+                }
+            } else {
+                v_mean = mean[n];
+                v_variance = variance[n];
+            }
+
+            const float inv_sqrtvar = 1.f / sqrtf(v_variance + eps);
+            const dim_t off = n * C_padded;
+            switch (dst_dt) {
+                case s8:
+                    normalize_row(static_cast<int8_t *>(dst) + off, x,
+                            scaleshift, v_mean, inv_sqrtvar, oscale,
+                            use_scaleshift, C);
+                    break;
+                case u8:
+                    normalize_row(static_cast<uint8_t *>(dst) + off, x,
+                            scaleshift, v_mean, inv_sqrtvar, oscale,
+                            use_scaleshift, C);
+                    break;
+                default:
+                    normalize_row(static_cast<data_t *>(dst) + off, x,
+                            scaleshift, v_mean, inv_sqrtvar, oscale,
+                            use_scaleshift, C);
+                    break;
+            }
+        }
+    });
+}
+
 template <data_type_t data_type>
 status_t simple_layer_normalization_bwd_t<data_type>::pd_t::init(
         engine_t *engine) {
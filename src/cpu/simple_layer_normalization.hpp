@@ -56,6 +56,14 @@ struct simple_layer_normalization_fwd_t : public primitive_t {
 
         bool use_tmp_stats() const { return reorder_pd_ || stats_are_tmp(); }
 
+        // The residual, the output scale and the destination data type other
+        // than the source one are handled by the fused row loop instead of
+        // the kernels
+        bool with_fusion() const {
+            return with_residual() || dst_md()->data_type != data_type
+                    || !attr()->output_scales_.has_default_values();
+        }
+
         std::unique_ptr<primitive_desc_t> reorder_pd_;
         memory_desc_t reordered_stat_md_;
 
@@ -69,6 +77,9 @@ struct simple_layer_normalization_fwd_t : public primitive_t {
                 scratchpad.template book<float>(
                         key_lnorm_tmp_var, across_axis());
             }
+            if (with_fusion())
+                scratchpad.template book<float>(key_lnorm_tmp_sum,
+                        norm_axis() * dnnl_get_max_threads());
             if (reordered_stat_md_ != *stat_md() && !stats_are_tmp()) {
                 scratchpad.book(key_nested, reorder_pd_->scratchpad_registry());
             }
@@ -142,6 +153,8 @@ struct simple_layer_normalization_fwd_t : public primitive_t {
 private:
     using data_t = typename prec_traits<data_type>::type;
     void execute_forward(const exec_ctx_t &ctx) const;
+    void execute_forward_fused(
+            const exec_ctx_t &ctx, float *mean, float *variance) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 
     std::unique_ptr<lnorm_utils::statistics_kernel_t<data_type>> stat_kernel_;
@@ -140,14 +140,21 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
         const int oc = input_d.dims()[oc_idx];
         const int g = w_groups ? (input_d.dims()[0]) : 1;
 
+        const bool req_comp = output_d.extra().flags
+                & memory_extra_flags::compensation_conv_s8s8;
+        const bool req_asymmetric_comp = output_d.extra().flags
+                & memory_extra_flags::compensation_conv_asymmetric_src;
+        const int comp_mask = w_groups ? 0x3 : 0x1;
+
         const bool compensation_mask_ok
-                = output_d.extra().compensation_mask == (w_groups ? 0x3 : 0x1);
+                = IMPLICATION(req_comp,
+                          output_d.extra().compensation_mask == comp_mask)
+                && IMPLICATION(req_asymmetric_comp,
+                        output_d.extra().asymm_compensation_mask == comp_mask);
 
         return simple_attr_check(attr, true, false)
                 && output_d.matches_tag(tag_o) && input_d.is_plain()
-                && (output_d.extra().flags
-                        & memory_extra_flags::compensation_conv_s8s8)
-                && compensation_mask_ok
+                && (req_comp || req_asymmetric_comp) && compensation_mask_ok
                 && (input_d.data_type() == f32 || input_d.data_type() == s8)
                 && output_d.data_type() == s8
                 && (D_mask == 1 || D_mask == (size_t)g * oc);
@@ -179,8 +186,11 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
         const size_t D_mask = utils::array_product(input_d.dims(),
                 math::ilog2q(pd->attr()->output_scales_.mask_ + 1));
 
-        assert(output_d.extra().flags
-                & memory_extra_flags::compensation_conv_s8s8);
+        const bool req_comp = output_d.extra().flags
+                & memory_extra_flags::compensation_conv_s8s8;
+        const bool req_asymmetric_comp = output_d.extra().flags
+                & memory_extra_flags::compensation_conv_asymmetric_src;
+        assert(req_comp || req_asymmetric_comp);
         float adj_scale
                 = (output_d.extra().flags & memory_extra_flags::scale_adjust)
                 ? output_d.extra().scale_adjust
@@ -189,9 +199,13 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
         size_t offset
                 = G * pdims[w_groups + 0] * pdims[w_groups + 1] * D * H * W;
         int32_t *cp = reinterpret_cast<int32_t *>(output + offset);
+        // the asymmetric compensation follows the s8s8 one
+        int32_t *zp = cp
+                + output_d.compensation_buffer_size() / sizeof(int32_t);
 
         parallel_nd(G, OC, [&](int g, int oc) {
-            cp[g * OC + oc] = 0;
+            if (req_comp) cp[g * OC + oc] = 0;
+            if (req_asymmetric_comp) zp[g * OC + oc] = 0;
             for_(int ic = 0; ic < IC; ic++)
             for_(int d = 0; d < D; d++)
             for_(int h = 0; h < H; h++)
@@ -212,9 +226,10 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
                 const float s = scales[(D_mask == 1) ? 0 : g * OC + oc];
 
                 o = qz_b0<data_t<type_i>, data_t<type_o>>()(i, s * adj_scale);
-                cp[g * OC + oc] -= (int32_t)o;
+                if (req_comp) cp[g * OC + oc] -= (int32_t)o;
+                if (req_asymmetric_comp) zp[g * OC + oc] -= (int32_t)o;
             }
-            cp[g * OC + oc] *= 128;
+            if (req_comp) cp[g * OC + oc] *= 128;
         });
         return status::success;
     }
@@ -268,14 +283,21 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
         const int oc = (input_d.dims()[w_groups ? 1 : 0]);
         const int g = w_groups ? input_d.dims()[0] : 1;
 
+        const bool req_comp = output_d.extra().flags
+                & memory_extra_flags::compensation_conv_s8s8;
+        const bool req_asymmetric_comp = output_d.extra().flags
+                & memory_extra_flags::compensation_conv_asymmetric_src;
+        const int comp_mask = w_groups ? 0x3 : 0x1;
+
         const bool compensation_mask_ok
-                = output_d.extra().compensation_mask == (w_groups ? 0x3 : 0x1);
+                = IMPLICATION(req_comp,
+                          output_d.extra().compensation_mask == comp_mask)
+                && IMPLICATION(req_asymmetric_comp,
+                        output_d.extra().asymm_compensation_mask == comp_mask);
 
         return simple_attr_check(attr, true, false)
                 && input_d.matches_tag(tag_i) && output_d.matches_tag(tag_o)
-                && (output_d.extra().flags
-                        & memory_extra_flags::compensation_conv_s8s8)
-                && compensation_mask_ok
+                && (req_comp || req_asymmetric_comp) && compensation_mask_ok
                 && (input_d.data_type() == f32 || input_d.data_type() == s8)
                 && output_d.data_type() == s8
                 && (D_mask == 1 || D_mask == (size_t)g * oc);
@@ -321,16 +343,19 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
         const size_t D_mask = utils::array_product(input_d.dims(),
                 math::ilog2q(pd->attr()->output_scales_.mask_ + 1));
 
-        assert(output_d.extra().flags
-                & memory_extra_flags::compensation_conv_s8s8);
+        const bool req_comp = output_d.extra().flags
+                & memory_extra_flags::compensation_conv_s8s8;
+        const bool req_asymmetric_comp = output_d.extra().flags
+                & memory_extra_flags::compensation_conv_asymmetric_src;
+        assert(req_comp || req_asymmetric_comp);
         float adj_scale
                 = (output_d.extra().flags & memory_extra_flags::scale_adjust)
                 ? output_d.extra().scale_adjust
                 : 1.f;
 
         auto ker = [&](const data_t<type_i> *inp, data_t<type_o> *out,
-                           int32_t *c, const float *s, const int oc_block,
-                           const int ic_block) {
+                           int32_t *c, int32_t *zp, const float *s,
+                           const int oc_block, const int ic_block) {
 #define index AB_or_BC_blk_off<tag_traits<tag_o>::inner_blks>
             for_(int ic = 0; ic < ic_block; ++ic)
             for (int oc = 0; oc < oc_block; ++oc) {
@@ -339,7 +364,9 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
                         + ic * plain_d.blocking_desc().strides[w_groups + 1];
                 out[index(oc, ic)] = qz_b0<data_t<type_i>, data_t<type_o>>()(
                         inp[plain_off], s[oc] * adj_scale);
-                c[oc] -= (128 * (int32_t)(out[index(oc, ic)]));
+                if (req_comp) c[oc] -= (128 * (int32_t)(out[index(oc, ic)]));
+                if (req_asymmetric_comp)
+                    zp[oc] -= (int32_t)(out[index(oc, ic)]);
             }
 #undef index
         };
@@ -350,7 +377,13 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
         size_t offset
                 = G * pdims[w_groups + 0] * pdims[w_groups + 1] * D * H * W;
         int32_t *cp = reinterpret_cast<int32_t *>(output + offset);
-        parallel_nd(G * NB_OC * blksize, [&](int i) { cp[i] = 0; });
+        // the asymmetric compensation follows the s8s8 one
+        int32_t *zp = cp
+                + output_d.compensation_buffer_size() / sizeof(int32_t);
+        parallel_nd(G * NB_OC * blksize, [&](int i) {
+            if (req_comp) cp[i] = 0;
+            if (req_asymmetric_comp) zp[i] = 0;
+        });
 
 #define wei_blk_off(md, g, o, i, d, h, w) \
     (is_1d ? (md).blk_off<!w_groups>(g, o, i, w) \
@@ -371,6 +404,7 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
 
                 int _offset = (g * NB_OC + O) * blksize;
                 ker(i, o, (order_keep) ? &cp[_offset] : nullptr,
+                        (order_keep) ? &zp[_offset] : nullptr,
                         &scales[(D_mask == 1) ? 0 : _offset], oc_block,
                         ic_block);
             }
@@ -406,11 +440,15 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
         const dim_t oc = input_d.dims()[1];
         const dim_t ic = input_d.dims()[2];
 
+        const bool req_comp = output_d.extra().flags
+                & memory_extra_flags::compensation_conv_s8s8;
+        const bool req_asymmetric_comp = output_d.extra().flags
+                & memory_extra_flags::compensation_conv_asymmetric_src;
+
         return order_keep && oc == 1 && ic == 1 // depth-wise case
                 && simple_attr_check(attr, true, false)
                 && input_d.matches_tag(tag_i) && output_d.matches_tag(tag_o)
-                && (output_d.extra().flags
-                        & memory_extra_flags::compensation_conv_s8s8)
+                && (req_comp || req_asymmetric_comp)
                 && (input_d.data_type() == f32 || input_d.data_type() == s8)
                 && output_d.data_type() == s8
                 && (D_mask == 1 || D_mask == (size_t)g * oc);
@@ -441,30 +479,40 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
                 math::ilog2q(pd->attr()->output_scales_.mask_ + 1));
         const float *scales = pd->attr()->output_scales_.scales_;
 
-        assert(output_d.extra().flags
-                & memory_extra_flags::compensation_conv_s8s8);
+        const bool req_comp = output_d.extra().flags
+                & memory_extra_flags::compensation_conv_s8s8;
+        const bool req_asymmetric_comp = output_d.extra().flags
+                & memory_extra_flags::compensation_conv_asymmetric_src;
+        assert(req_comp || req_asymmetric_comp);
         float adj_scale
                 = (output_d.extra().flags & memory_extra_flags::scale_adjust)
                 ? output_d.extra().scale_adjust
                 : 1.f;
 
         auto ker = [&](const data_t<type_i> *inp, data_t<type_o> *out,
-                           int32_t *cp, const float *s, const int g_block) {
+                           int32_t *cp, int32_t *zp, const float *s,
+                           const int g_block) {
             PRAGMA_OMP_SIMD()
             for (int g = 0; g < g_block; g++) {
                 const auto i_off = g * input_d.blocking_desc().strides[0];
                 out[g] = qz_b0<data_t<type_i>, data_t<type_o>>()(
                         inp[i_off], s[g * OC] * adj_scale);
-                cp[g * OC] -= 128 * (int32_t)(out[g]);
+                if (req_comp) cp[g * OC] -= 128 * (int32_t)(out[g]);
+                if (req_asymmetric_comp) zp[g * OC] -= (int32_t)(out[g]);
             }
         };
 
         size_t cp_offset = output_d.size() - output_d.additional_buffer_size();
         int32_t *cp = reinterpret_cast<int32_t *>(output + cp_offset);
+        // the asymmetric compensation follows the s8s8 one
+        int32_t *zp = cp
+                + output_d.compensation_buffer_size() / sizeof(int32_t);
         parallel_nd((Gp / blksize) * OC, [&](int ib) {
             PRAGMA_OMP_SIMD()
-            for (int i = 0; i < blksize; i++)
-                cp[ib * blksize + i] = 0;
+            for (int i = 0; i < blksize; i++) {
+                if (req_comp) cp[ib * blksize + i] = 0;
+                if (req_asymmetric_comp) zp[ib * blksize + i] = 0;
+            }
         });
 
 #define wei_blk_off(md, g, o, i, h, w) \
@@ -480,7 +528,7 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
                     const auto out
                             = &output[wei_blk_off(output_d, gb, O, I, h, w)];
                     int offset = gb * blksize + O;
-                    ker(inp, out, &cp[offset],
+                    ker(inp, out, &cp[offset], &zp[offset],
                             &scales[(D_mask == 1) ? 0 : offset], g_block);
                 }
             }
@@ -0,0 +1,317 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/nstl.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_generator.hpp"
+
+#include "cpu/x64/gemm/f32/jit_avx512_core_gemm_small_f32_kern.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace Xbyak;
+
+namespace {
+
+constexpr dim_t vlen = cpu_isa_traits<avx512_core>::vlen / sizeof(float);
+
+// Register blocking of C.
+// 'N' A: the rows of C are vectorized, a block is um_n x un_n vectors.
+// 'T' A: every element of C is a dot product along K, a block is
+//        um_t x un_t accumulators which are reduced when K is done.
+constexpr int um_n = 4, un_n = 6;
+constexpr int um_t = 4, un_t = 4;
+
+dim_t m_blk(const gemm_small_f32_conf_t &conf) {
+    return conf.transa ? um_t : um_n * vlen;
+}
+
+dim_t a_blk_off(const gemm_small_f32_conf_t &conf) {
+    return conf.transa ? um_t * conf.lda : um_n * vlen;
+}
+
+} // namespace
+
+struct jit_avx512_core_gemm_small_f32_kern_t : public gemm_small_f32_kernel_t,
+                                               public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_avx512_core_gemm_small_f32_kern_t)
+
+    jit_avx512_core_gemm_small_f32_kern_t(const gemm_small_f32_conf_t &conf)
+        : gemm_small_f32_kernel_t(conf, m_blk(conf), a_blk_off(conf)) {
+        generate();
+        ker_ = getCode<decltype(ker_)>();
+    }
+
+protected:
+    void operator()(const call_params_t *p) const override { ker_(p); }
+
+private:
+    void (*ker_)(const call_params_t *) = nullptr;
+
+    Reg64 reg_param = abi_param1;
+    Reg64 reg_a = r8;
+    Reg64 reg_b = r9;
+    Reg64 reg_c = r10;
+    Reg64 reg_nblk = r11;
+    Reg64 reg_aa = r12;
+    Reg64 reg_bb = r13;
+    Reg64 reg_k = r14;
+    Reg64 reg_tmp = r15;
+    Reg64 reg_do_tail = rax;
+
+    Opmask k_tail = k1;
+
+    void generate();
+    void compute_block_n(int m_rows);
+    void compute_block_t(int m_rows);
+
+    // 'N' A registers
+    Zmm vmm_acc_n(int i, int j) { return Zmm(j * um_n + i); }
+    Zmm vmm_a_n(int i) { return Zmm(um_n * un_n + i); }
+    Zmm vmm_b_n = Zmm(28);
+    Zmm vmm_tmp_n = Zmm(29);
+    Zmm vmm_alpha_n = Zmm(30);
+    Zmm vmm_beta_n = Zmm(31);
+
+    // 'T' A registers. Reduction uses VEX instructions, hence the registers
+    // it touches have to be in the lower half.
+    Zmm vmm_acc_t(int i, int j) { return Zmm(16 + j * um_t + i); }
+    Zmm vmm_a_t(int i) { return Zmm(i); }
+    Zmm vmm_b_t(int j) { return Zmm(um_t + j); }
+    Zmm vmm_alpha_t = Zmm(8);
+    Zmm vmm_beta_t = Zmm(9);
+    Zmm vmm_red = Zmm(10);
+    Zmm vmm_red_tmp = Zmm(11);
+};
+
+#define GET_OFF(field) offsetof(gemm_small_f32_kernel_t::call_params_t, field)
+
+void jit_avx512_core_gemm_small_f32_kern_t::compute_block_n(int m_rows) {
+    const int um = (int)utils::div_up(m_rows, vlen);
+    const int m_tail = m_rows % vlen;
+    const dim_t ldb_step = conf_.transb ? 1 : conf_.ldb;
+    const dim_t k_step_b = conf_.transb ? conf_.ldb : 1;
+
+    auto mask = [&](int i, const Zmm &z) {
+        return (m_tail && i == um - 1) ? z | k_tail | T_z : z;
+    };
+
+    for (dim_t n0 = 0; n0 < conf_.n; n0 += un_n) {
+        const int un = (int)nstl::min<dim_t>(un_n, conf_.n - n0);
+
+        for (int j = 0; j < un; ++j)
+            for (int i = 0; i < um; ++i) {
+                const Zmm acc = vmm_acc_n(i, j);
+                vpxord(acc, acc, acc);
+            }
+
+        mov(reg_aa, reg_a);
+        mov(reg_bb, reg_b);
+        if (n0) add(reg_bb, n0 * ldb_step * sizeof(float));
+
+        Label l_k;
+        mov(reg_k, conf_.k);
+        L(l_k);
+        {
+            for (int i = 0; i < um; ++i)
+                vmovups(mask(i, vmm_a_n(i)),
+                        ptr[reg_aa + i * vlen * sizeof(float)]);
+            for (int j = 0; j < un; ++j) {
+                vbroadcastss(vmm_b_n,
+                        ptr[reg_bb + j * ldb_step * sizeof(float)]);
+                for (int i = 0; i < um; ++i)
+                    vfmadd231ps(vmm_acc_n(i, j), vmm_a_n(i), vmm_b_n);
+            }
+            add(reg_aa, conf_.lda * sizeof(float));
+            add(reg_bb, k_step_b * sizeof(float));
+            dec(reg_k);
+            jnz(l_k, T_NEAR);
+        }
+
+        for (int j = 0; j < un; ++j)
+            for (int i = 0; i < um; ++i) {
+                const Zmm acc = vmm_acc_n(i, j);
+                const bool is_tail = m_tail && i == um - 1;
+                const auto addr = ptr[reg_c
+                        + (i * vlen + (n0 + j) * conf_.ldc) * sizeof(float)];
+                vmulps(acc, acc, vmm_alpha_n);
+                if (!conf_.beta_is_zero) {
+                    if (is_tail) {
+                        vmovups(vmm_tmp_n | k_tail | T_z, addr);
+                        vfmadd231ps(acc, vmm_tmp_n, vmm_beta_n);
+                    } else
+                        vfmadd231ps(acc, vmm_beta_n, addr);
+                }
+                if (is_tail)
+                    vmovups(addr | k_tail, acc);
+                else
+                    vmovups(addr, acc);
+            }
+    }
+}
+
+void jit_avx512_core_gemm_small_f32_kern_t::compute_block_t(int m_rows) {
+    const dim_t nk_full = conf_.k / vlen;
+    const bool has_k_tail = conf_.k % vlen != 0;
+
+    for (dim_t n0 = 0; n0 < conf_.n; n0 += un_t) {
+        const int un = (int)nstl::min<dim_t>(un_t, conf_.n - n0);
+
+        for (int j = 0; j < un; ++j)
+            for (int i = 0; i < m_rows; ++i) {
+                const Zmm acc = vmm_acc_t(i, j);
+                vpxord(acc, acc, acc);
+            }
+
+        mov(reg_aa, reg_a);
+        mov(reg_bb, reg_b);
+        if (n0) add(reg_bb, n0 * conf_.ldb * sizeof(float));
+
+        auto k_step = [&](bool tail) {
+            for (int i = 0; i < m_rows; ++i) {
+                const Zmm a = tail ? vmm_a_t(i) | k_tail | T_z : vmm_a_t(i);
+                vmovups(a, ptr[reg_aa + i * conf_.lda * sizeof(float)]);
+            }
+            for (int j = 0; j < un; ++j) {
+                const Zmm b = tail ? vmm_b_t(j) | k_tail | T_z : vmm_b_t(j);
+                vmovups(b, ptr[reg_bb + j * conf_.ldb * sizeof(float)]);
+            }
+            for (int j = 0; j < un; ++j)
+                for (int i = 0; i < m_rows; ++i)
+                    vfmadd231ps(vmm_acc_t(i, j), vmm_a_t(i), vmm_b_t(j));
+        };
+
+        if (nk_full > 0) {
+            Label l_k;
+            mov(reg_k, nk_full);
+            L(l_k);
+            {
+                k_step(false);
+                add(reg_aa, vlen * sizeof(float));
+                add(reg_bb, vlen * sizeof(float));
+                dec(reg_k);
+                jnz(l_k, T_NEAR);
+            }
+        }
+        if (has_k_tail) k_step(true);
+
+        const Ymm ymm_red(vmm_red.getIdx()), ymm_red_tmp(vmm_red_tmp.getIdx());
+        const Xmm xmm_red(vmm_red.getIdx()), xmm_red_tmp(vmm_red_tmp.getIdx());
+        const Xmm xmm_alpha(vmm_alpha_t.getIdx()), xmm_beta(vmm_beta_t.getIdx());
+        for (int j = 0; j < un; ++j)
+            for (int i = 0; i < m_rows; ++i) {
+                vmovaps(vmm_red, vmm_acc_t(i, j));
+                vextractf64x4(ymm_red_tmp, vmm_red, 1);
+                vaddps(ymm_red, ymm_red, ymm_red_tmp);
+                vextractf128(xmm_red_tmp, ymm_red, 1);
+                vaddps(xmm_red, xmm_red, xmm_red_tmp);
+                vhaddps(xmm_red, xmm_red, xmm_red);
+                vhaddps(xmm_red, xmm_red, xmm_red);
+
+                const auto addr = dword[reg_c
+                        + (i + (n0 + j) * conf_.ldc) * sizeof(float)];
+                vmulss(xmm_red, xmm_red, xmm_alpha);
+                if (!conf_.beta_is_zero) vfmadd231ss(xmm_red, xmm_beta, addr);
+                vmovss(addr, xmm_red);
+            }
+    }
+}
+
+void jit_avx512_core_gemm_small_f32_kern_t::generate() {
+    preamble();
+
+    mov(reg_a, ptr[reg_param + GET_OFF(a)]);
+    mov(reg_b, ptr[reg_param + GET_OFF(b)]);
+    mov(reg_c, ptr[reg_param + GET_OFF(c)]);
+    mov(reg_nblk, ptr[reg_param + GET_OFF(nblk)]);
+    mov(reg_do_tail, ptr[reg_param + GET_OFF(do_tail)]);
+
+    const Zmm vmm_alpha = conf_.transa ? vmm_alpha_t : vmm_alpha_n;
+    const Zmm vmm_beta = conf_.transa ? vmm_beta_t : vmm_beta_n;
+    mov(reg_tmp, ptr[reg_param + GET_OFF(alpha)]);
+    vbroadcastss(vmm_alpha, ptr[reg_tmp]);
+    if (!conf_.beta_is_zero) {
+        mov(reg_tmp, ptr[reg_param + GET_OFF(beta)]);
+        vbroadcastss(vmm_beta, ptr[reg_tmp]);
+    }
+
+    // The tail mask covers M for 'N' A and K for 'T' A
+    const int tail = conf_.transa ? conf_.k % vlen : (conf_.m % m_blk_) % vlen;
+    if (tail) {
+        mov(reg_tmp.cvt32(), (1 << tail) - 1);
+        kmovw(k_tail, reg_tmp.cvt32());
+    }
+
+    auto compute_block = [&](int m_rows) {
+        if (conf_.transa)
+            compute_block_t(m_rows);
+        else
+            compute_block_n(m_rows);
+    };
+
+    Label l_blk, l_tail, l_end;
+    L(l_blk);
+    {
+        test(reg_nblk, reg_nblk);
+        jz(l_tail, T_NEAR);
+        compute_block((int)m_blk_);
+        add(reg_a, a_blk_off_ * sizeof(float));
+        add(reg_c, m_blk_ * sizeof(float));
+        dec(reg_nblk);
+        jmp(l_blk, T_NEAR);
+    }
+    L(l_tail);
+    const int m_tail = (int)(conf_.m % m_blk_);
+    if (m_tail) {
+        test(reg_do_tail, reg_do_tail);
+        jz(l_end, T_NEAR);
+        compute_block(m_tail);
+    }
+    L(l_end);
+
+    postamble();
+}
+
+#undef GET_OFF
+
+bool jit_avx512_core_gemm_small_f32_applicable(
+        const gemm_small_f32_conf_t &conf) {
+    if (!mayiuse(avx512_core)) return false;
+    // both A and B would have to be gathered
+    if (conf.transa && conf.transb) return false;
+
+    // all the offsets must fit into 32-bit displacements
+    const dim_t max_ld = nstl::max(conf.lda, nstl::max(conf.ldb, conf.ldc));
+    const dim_t max_off
+            = max_ld * (conf.n + nstl::max<dim_t>(um_n, um_t) * vlen);
+    return max_off * (dim_t)sizeof(float) < INT32_MAX;
+}
+
+gemm_small_f32_kernel_t *jit_avx512_core_gemm_small_f32_kern_create(
+        const gemm_small_f32_conf_t &conf) {
+    if (!jit_avx512_core_gemm_small_f32_applicable(conf)) return nullptr;
+    return new jit_avx512_core_gemm_small_f32_kern_t(conf);
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
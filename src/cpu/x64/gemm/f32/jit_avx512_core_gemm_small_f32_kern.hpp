@@ -0,0 +1,38 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_GEMM_F32_JIT_AVX512_CORE_GEMM_SMALL_F32_KERN_HPP
+#define CPU_X64_GEMM_F32_JIT_AVX512_CORE_GEMM_SMALL_F32_KERN_HPP
+
+#include "cpu/gemm/f32/gemm_small_f32.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+bool jit_avx512_core_gemm_small_f32_applicable(
+        const gemm_small_f32_conf_t &conf);
+
+gemm_small_f32_kernel_t *jit_avx512_core_gemm_small_f32_kern_create(
+        const gemm_small_f32_conf_t &conf);
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif // CPU_X64_GEMM_F32_JIT_AVX512_CORE_GEMM_SMALL_F32_KERN_HPP
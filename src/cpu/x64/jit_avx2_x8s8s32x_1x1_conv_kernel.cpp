@@ -98,6 +98,9 @@ void jit_avx2_x8s8s32x_1x1_conv_kernel::bcast_loop(int load_loop_blk) {
 
 void jit_avx2_x8s8s32x_1x1_conv_kernel::reduce_loop(
         int load_loop_blk, int ur, int substep, bool wraparound) {
+    // the src zero point compensation is pre-combined with the s8s8 one
+    const bool with_comp = jcp.signed_input || jcp.src_zero_point;
+
     auto vreg_load = [&](int i_load) {
         const int ymm_idx = ur * load_loop_blk + i_load;
         assert(ymm_idx < 13);
@@ -182,15 +185,14 @@ void jit_avx2_x8s8s32x_1x1_conv_kernel::reduce_loop(
             auto ymm_bias = ymm_tmp;
             auto ymm_comp = ymm_bcast;
             if (jcp.with_bias) {
-                if (jcp.signed_input)
-                    mov(reg_bias_data, ptr[rsp + reg_bias_data_off]);
+                if (with_comp) mov(reg_bias_data, ptr[rsp + reg_bias_data_off]);
                 cvt2ps(jcp.bia_dt, ymm_bias, reg_bias_data,
                         jcp.typesize_bia * jcp.oc_block * i_load,
                         mask_flag ? get_tail_size() : simd_w);
                 if (jcp.signed_input)
                     vmulps(ymm_bias, ymm_bias, ymm_bias_alpha());
             }
-            if (jcp.signed_input) {
+            if (with_comp) {
                 mov(reg_comp_data, ptr[rsp + reg_comp_data_off]);
                 cvt2ps(data_type::s32, ymm_comp, reg_comp_data,
                         sizeof(int32_t) * jcp.oc_block * i_load,
@@ -200,7 +202,7 @@ void jit_avx2_x8s8s32x_1x1_conv_kernel::reduce_loop(
             for (int i_ur = 0; i_ur < ur; ++i_ur) {
                 auto r = vreg_accum(i_load, i_ur);
                 vcvtdq2ps(r, r);
-                if (jcp.signed_input) vaddps(r, r, ymm_comp);
+                if (with_comp) vaddps(r, r, ymm_comp);
                 if (jcp.with_bias) vaddps(r, r, ymm_bias);
 
                 const auto ptr_scales_offset = jcp.is_oc_scale
@@ -243,6 +245,18 @@ void jit_avx2_x8s8s32x_1x1_conv_kernel::reduce_loop(
         if (maybe_eltwise(1))
             eltwise_injector_->compute_vector_range(0, ur * load_loop_blk);
 
+        if (jcp.dst_zero_point) {
+            const auto ymm_dst_zp = ymm_bcast;
+            mov(reg_ptr_scales, ptr[rsp + reg_dst_zero_point_off]);
+            vpbroadcastd(ymm_dst_zp, ptr[reg_ptr_scales]);
+            vcvtdq2ps(ymm_dst_zp, ymm_dst_zp);
+            for (int i_ur = 0; i_ur < ur; ++i_ur)
+                for (int i_load = 0; i_load < load_loop_blk; ++i_load) {
+                    auto r = vreg_accum(i_load, i_ur);
+                    vaddps(r, r, ymm_dst_zp);
+                }
+        }
+
         // Properly saturate the accumulators for integer datatypes
         if (utils::one_of(jcp.dst_dt, u8, s8, s32)) {
             init_saturate_f32(ymm_zero, ymm_saturation, aux_reg_saturation, f32,
@@ -368,8 +382,14 @@ void jit_avx2_x8s8s32x_1x1_conv_kernel::generate() {
 
     sub(rsp, stack_space_needed);
 
+    if (jcp.dst_zero_point) {
+        mov(reg_init_bcast, ptr[param1 + GET_OFF(dst_zero_point)]);
+        mov(ptr[rsp + reg_dst_zero_point_off], reg_init_bcast);
+    }
+
+    const bool with_comp = jcp.signed_input || jcp.src_zero_point;
     if (jcp.with_bias) mov(reg_bias_data, ptr[param1 + GET_OFF(bias_data)]);
-    if (jcp.signed_input) {
+    if (with_comp) {
         mov(ptr[rsp + reg_bias_data_off], reg_bias_data);
         mov(reg_comp_data, ptr[param1 + GET_OFF(compensation)]);
         mov(ptr[rsp + reg_comp_data_off], reg_comp_data);
@@ -390,14 +410,12 @@ void jit_avx2_x8s8s32x_1x1_conv_kernel::generate() {
         bcast_loop(load_loop_blk);
         add(reg_load_data, load_loop_blk * jcp.load_loop_load_step);
         if (jcp.with_bias) {
-            if (jcp.signed_input)
-                mov(reg_bias_data, ptr[rsp + reg_bias_data_off]);
+            if (with_comp) mov(reg_bias_data, ptr[rsp + reg_bias_data_off]);
             add(reg_bias_data,
                     load_loop_blk * jcp.load_block * jcp.typesize_bia);
-            if (jcp.signed_input)
-                mov(ptr[rsp + reg_bias_data_off], reg_bias_data);
+            if (with_comp) mov(ptr[rsp + reg_bias_data_off], reg_bias_data);
         }
-        if (jcp.signed_input) {
+        if (with_comp) {
             mov(reg_comp_data, ptr[rsp + reg_comp_data_off]);
             add(reg_comp_data,
                     load_loop_blk * jcp.load_block * sizeof(int32_t));
@@ -541,6 +559,12 @@ status_t jit_avx2_x8s8s32x_1x1_conv_kernel::init_conf(jit_1x1_conv_conf_t &jcp,
     jcp.with_eltwise = eltwise_ind != -1;
     if (jcp.with_eltwise) jcp.eltwise = p.entry_[eltwise_ind].eltwise;
 
+    const auto &zp = attr.zero_points_;
+    jcp.src_zero_point = !zp.has_default_values(DNNL_ARG_SRC);
+    jcp.dst_zero_point = !zp.has_default_values(DNNL_ARG_DST);
+    if ((jcp.src_zero_point || jcp.dst_zero_point) && jcp.with_dw_conv)
+        return status::unimplemented;
+
     format_tag_t dat_tag = utils::pick(
             ndims - 3, format_tag::nwc, format_tag::nhwc, format_tag::ndhwc);
     jcp.src_tag = src_d.matches_one_of_tag(dat_tag);
@@ -751,6 +775,9 @@ void jit_avx2_x8s8s32x_1x1_conv_kernel::init_scratchpad(
         dim_t count = nstl::max<dim_t>(attr.output_scales_.count_, 8);
         scratchpad.book<float>(key_conv_adjusted_scales, count);
     }
+    if (jcp.src_zero_point)
+        scratchpad.book<int32_t>(key_conv_zp_src_comp,
+                (size_t)jcp.ngroups * rnd_up(jcp.oc, jcp.oc_block));
 }
 
 } // namespace x64
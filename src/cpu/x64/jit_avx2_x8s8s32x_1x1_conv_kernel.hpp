@@ -103,7 +103,8 @@ private:
     constexpr static int reg_load_data_off = 3 * reg64_size;
     constexpr static int reg_ptr_sum_scale_off = 4 * reg64_size;
     constexpr static int reg_comp_data_off = 5 * reg64_size;
-    constexpr static int stack_space_needed = 6 * reg64_size;
+    constexpr static int reg_dst_zero_point_off = 6 * reg64_size;
+    constexpr static int stack_space_needed = 7 * reg64_size;
 
     void bcast_loop(int load_loop_blk);
     void reduce_loop(int load_loop_blk, int ur, int substep, bool wraparound);
@@ -66,9 +66,11 @@ struct jit_avx2_x8s8s32x_1x1_convolution_fwd_t : public primitive_t {
                                     data_type::s8, data_type::u8))
                     && attr()->has_default_values(
                             primitive_attr_t::skip_mask_t::oscale
-                                    | primitive_attr_t::skip_mask_t::post_ops,
+                                    | primitive_attr_t::skip_mask_t::post_ops
+                                    | primitive_attr_t::skip_mask_t::
+                                            zero_points_runtime,
                             dst_type)
-                    && !has_zero_dim_memory()
+                    && zero_points_ok() && !has_zero_dim_memory()
                     && set_default_formats_common(
                             dat_tag(), format_tag::any, dat_tag())
                     && set_or_check_wei_format();
@@ -178,6 +180,15 @@ struct jit_avx2_x8s8s32x_1x1_convolution_fwd_t : public primitive_t {
                     format_tag::ndhwc);
         }
 
+        bool zero_points_ok() const {
+            // only common src and dst zero points are supported
+            int mask_src = 0, mask_dst = 0;
+            attr()->zero_points_.get(DNNL_ARG_SRC, nullptr, &mask_src, nullptr);
+            attr()->zero_points_.get(DNNL_ARG_DST, nullptr, &mask_dst, nullptr);
+            return attr()->zero_points_.has_default_values(DNNL_ARG_WEIGHTS)
+                    && mask_src == 0 && mask_dst == 0;
+        }
+
         bool set_or_check_wei_format() {
             using namespace format_tag;
 
@@ -198,6 +209,12 @@ struct jit_avx2_x8s8s32x_1x1_convolution_fwd_t : public primitive_t {
                         = (1 << 0) + (with_groups() ? (1 << 1) : 0);
                 want_wei_md.extra.scale_adjust = 0.5f;
             }
+            if (!attr()->zero_points_.has_default_values(DNNL_ARG_SRC)) {
+                want_wei_md.extra.flags
+                        |= memory_extra_flags::compensation_conv_asymmetric_src;
+                want_wei_md.extra.asymm_compensation_mask
+                        = (1 << 0) + (with_groups() ? (1 << 1) : 0);
+            }
 
             if (weights_md_.format_kind == format_kind::any) {
                 weights_md_ = want_wei_md;
@@ -359,15 +376,15 @@ struct jit_avx2_x8s8s32x_1x1_convolution_fwd_t : public primitive_t {
     typedef typename prec_traits<data_type::s32>::type acc_data_t;
 
     status_t execute(const exec_ctx_t &ctx) const override {
-        execute_forward(ctx);
-        return status::success;
+        return execute_forward(ctx);
     }
 
 private:
-    void execute_forward(const exec_ctx_t &ctx) const;
+    status_t execute_forward(const exec_ctx_t &ctx) const;
     void execute_forward_thr(const int ithr, const int nthr,
             const src_data_t *src, const wei_data_t *weights, const char *bias,
             const wei_data_t *weights_dw, const char *bias_dw, dst_data_t *dst,
+            const int32_t *dst_zero_point,
             const memory_tracking::grantor_t &scratchpad) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 
@@ -124,6 +124,9 @@ void _jit_avx512_core_x8s8s32x_1x1_conv_kernel<Vmm>::cvt2ps(data_type_t type_in,
 template <typename Vmm>
 void _jit_avx512_core_x8s8s32x_1x1_conv_kernel<Vmm>::reduce_loop(
         int load_loop_blk, int ur, int substep, bool wraparound) {
+    // the src zero point compensation is pre-combined with the s8s8 one
+    const bool with_comp = jcp.signed_input || jcp.src_zero_point;
+
     auto vreg_load
             = [=](int i_load) { return Vmm(ur * load_loop_blk + i_load); };
 
@@ -212,14 +215,14 @@ void _jit_avx512_core_x8s8s32x_1x1_conv_kernel<Vmm>::reduce_loop(
             auto vmm_bias = vmm_tmp;
             auto vmm_comp = vmm_bcast;
             if (jcp.with_bias) {
-                if (jcp.signed_input)
+                if (with_comp)
                     mov(reg_bias_data,
                             EVEX_compress_addr(rsp, reg_bias_data_off));
                 cvt2ps(jcp.bia_dt, vmm_bias, bias_ptr(i_load), mask_flag);
                 if (jcp.signed_input && jcp.ver != ver_vnni)
                     vmulps(vmm_bias, vmm_bias, vmm_bias_alpha());
             }
-            if (jcp.signed_input) {
+            if (with_comp) {
                 mov(reg_comp_data, EVEX_compress_addr(rsp, reg_comp_data_off));
                 cvt2ps(data_type::s32, vmm_comp, comp_ptr(i_load), mask_flag);
             }
@@ -227,7 +230,7 @@ void _jit_avx512_core_x8s8s32x_1x1_conv_kernel<Vmm>::reduce_loop(
             for (int i_ur = 0; i_ur < ur; ++i_ur) {
                 auto r = vreg_accum(i_load, i_ur);
                 vcvtdq2ps(r, r);
-                if (jcp.signed_input) vaddps(r, r, vmm_comp);
+                if (with_comp) vaddps(r, r, vmm_comp);
                 if (jcp.with_bias) vaddps(r, r, vmm_bias);
 
                 const Vmm mask_vmm = mask_flag ? r | ktail_mask | T_z : r;
@@ -259,6 +262,19 @@ void _jit_avx512_core_x8s8s32x_1x1_conv_kernel<Vmm>::reduce_loop(
         if (maybe_eltwise(1))
             eltwise_injector_->compute_vector_range(0, ur * load_loop_blk);
 
+        if (jcp.dst_zero_point) {
+            const auto vmm_dst_zp = vmm_bcast;
+            mov(reg_ptr_scales,
+                    EVEX_compress_addr(rsp, reg_dst_zero_point_off));
+            vpbroadcastd(vmm_dst_zp, ptr[reg_ptr_scales]);
+            vcvtdq2ps(vmm_dst_zp, vmm_dst_zp);
+            for (int i_load = 0; i_load < load_loop_blk; ++i_load)
+                for (int i_ur = 0; i_ur < ur; ++i_ur) {
+                    auto r = vreg_accum(i_load, i_ur);
+                    vaddps(r, r, vmm_dst_zp);
+                }
+        }
+
         // Properly saturate the accumulators for integer datatypes
         if (one_of(jcp.dst_dt, u8, s8, s32)) {
             init_saturate_f32(vmm_zero, vmm_saturation,
@@ -415,8 +431,14 @@ void _jit_avx512_core_x8s8s32x_1x1_conv_kernel<Vmm>::generate() {
         kmovw(ktail_mask, regw_tmp);
     }
 
+    if (jcp.dst_zero_point) {
+        mov(reg_scratch, ptr[param1 + GET_OFF(dst_zero_point)]);
+        mov(EVEX_compress_addr(rsp, reg_dst_zero_point_off), reg_scratch);
+    }
+
+    const bool with_comp = jcp.signed_input || jcp.src_zero_point;
     if (jcp.with_bias) mov(reg_bias_data, ptr[param1 + GET_OFF(bias_data)]);
-    if (jcp.signed_input) {
+    if (with_comp) {
         mov(EVEX_compress_addr(rsp, reg_bias_data_off), reg_bias_data);
         mov(reg_comp_data, ptr[param1 + GET_OFF(compensation)]);
         mov(EVEX_compress_addr(rsp, reg_comp_data_off), reg_comp_data);
@@ -437,14 +459,14 @@ void _jit_avx512_core_x8s8s32x_1x1_conv_kernel<Vmm>::generate() {
         bcast_loop(load_loop_blk);
         add(reg_load_data, load_loop_blk * jcp.load_loop_load_step);
         if (jcp.with_bias) {
-            if (jcp.signed_input)
+            if (with_comp)
                 mov(reg_bias_data, EVEX_compress_addr(rsp, reg_bias_data_off));
             add(reg_bias_data,
                     load_loop_blk * jcp.load_block * jcp.typesize_bia);
-            if (jcp.signed_input)
+            if (with_comp)
                 mov(EVEX_compress_addr(rsp, reg_bias_data_off), reg_bias_data);
         }
-        if (jcp.signed_input) {
+        if (with_comp) {
             mov(reg_comp_data, EVEX_compress_addr(rsp, reg_comp_data_off));
             add(reg_comp_data,
                     load_loop_blk * jcp.load_block * sizeof(int32_t));
@@ -624,6 +646,12 @@ status_t jit_avx512_core_x8s8s32x_1x1_conv_kernel::init_conf(
     jcp.with_eltwise = eltwise_ind != -1;
     if (jcp.with_eltwise) jcp.eltwise = p.entry_[eltwise_ind].eltwise;
 
+    const auto &zp = attr.zero_points_;
+    jcp.src_zero_point = !zp.has_default_values(DNNL_ARG_SRC);
+    jcp.dst_zero_point = !zp.has_default_values(DNNL_ARG_DST);
+    if ((jcp.src_zero_point || jcp.dst_zero_point) && jcp.with_dw_conv)
+        return status::unimplemented;
+
     format_tag_t dat_tag = utils::pick(
             ndims - 3, format_tag::nwc, format_tag::nhwc, format_tag::ndhwc);
     jcp.src_tag = src_d.matches_one_of_tag(dat_tag);
@@ -664,6 +692,12 @@ status_t jit_avx512_core_x8s8s32x_1x1_conv_kernel::init_conf(
             want_wei_md.extra.scale_adjust
                     = mayiuse(avx512_core_vnni) ? 1.f : 0.5f;
         }
+        if (jcp.src_zero_point) {
+            want_wei_md.extra.flags
+                    |= memory_extra_flags::compensation_conv_asymmetric_src;
+            want_wei_md.extra.asymm_compensation_mask
+                    = (1 << 0) + (with_groups ? (1 << 1) : 0);
+        }
 
         if (weights_md.format_kind == format_kind::any) {
             weights_md = want_wei_md;
@@ -896,6 +930,9 @@ void jit_avx512_core_x8s8s32x_1x1_conv_kernel::init_scratchpad(
                 attr.output_scales_.count_, (dim_t)jcp.ic_block);
         scratchpad.book<float>(key_conv_adjusted_scales, count);
     }
+    if (jcp.src_zero_point)
+        scratchpad.book<int32_t>(key_conv_zp_src_comp,
+                (size_t)jcp.ngroups * rnd_up(jcp.oc, jcp.oc_block));
 }
 
 template struct _jit_avx512_core_x8s8s32x_1x1_conv_kernel<Xbyak::Zmm>;
@@ -95,7 +95,8 @@ private:
     int reg_load_data_off = 24;
     int reg_ptr_sum_scale_off = 32;
     int reg_comp_data_off = 40;
-    int stack_space_needed = 48;
+    int reg_dst_zero_point_off = 48;
+    int stack_space_needed = 56;
 
     void bcast_loop(int load_loop_blk);
     void reduce_loop(int load_loop_blk, int ur, int substep, bool wraparound);
@@ -19,6 +19,8 @@
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/cpu_primitive.hpp"
+
 #include "cpu/x64/jit_generator.hpp"
 
 #include "cpu/x64/jit_avx512_core_x8s8s32x_1x1_convolution.hpp"
@@ -34,7 +36,7 @@ using namespace dnnl::impl::utils;
 
 /* convolution forward */
 template <data_type_t src_type, data_type_t dst_type>
-void jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t<src_type,
+status_t jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t<src_type,
         dst_type>::execute_forward(const exec_ctx_t &ctx) const {
     auto src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
     auto weights = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
@@ -45,8 +47,27 @@ void jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t<src_type,
     auto bias_dw = CTX_IN_MEM(
             const char *, DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_BIAS);
 
+    DEFINE_ZERO_POINT_VALUE(src_zero_point, DNNL_ARG_SRC);
+    DEFINE_ZERO_POINT_VALUE(dst_zero_point, DNNL_ARG_DST);
+
     auto scratchpad = ctx.get_scratchpad_grantor();
 
+    if (pd()->jcp_.src_zero_point) {
+        // comp[oc] = s8s8_comp[oc] - src_zero_point * SUM(wei[oc][...])
+        const auto &jcp = pd()->jcp_;
+        const memory_desc_wrapper weights_d(pd()->weights_md(0));
+        const int32_t *s8s8_comp = reinterpret_cast<const int32_t *>(weights
+                + weights_d.size() - weights_d.additional_buffer_size());
+        const int32_t *zp_comp = s8s8_comp
+                + weights_d.compensation_buffer_size() / sizeof(int32_t);
+        const size_t nelems
+                = weights_d.asymm_compensation_buffer_size() / sizeof(int32_t);
+        auto comp = scratchpad.template get<int32_t>(key_conv_zp_src_comp);
+        for (size_t i = 0; i < nelems; ++i)
+            comp[i] = (jcp.signed_input ? s8s8_comp[i] : 0)
+                    + src_zero_point * zp_comp[i];
+    }
+
     if (pd()->jcp_.signed_input && pd()->jcp_.ver != ver_vnni) {
         auto local_scales
                 = scratchpad.template get<float>(key_conv_adjusted_scales);
@@ -85,8 +106,9 @@ void jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t<src_type,
     }
     parallel(pd()->jcp_.nthr, [&](const int ithr, const int nthr) {
         execute_forward_thr(ithr, nthr, src, weights, bias, weights_dw, bias_dw,
-                dst, scratchpad);
+                dst, &dst_zero_point, scratchpad);
     });
+    return status::success;
 }
 
 template <data_type_t src_type, data_type_t dst_type>
@@ -94,6 +116,7 @@ void jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t<src_type,
         dst_type>::execute_forward_thr(const int ithr, const int nthr,
         const src_data_t *src, const wei_data_t *weights, const char *bias,
         const wei_data_t *weights_dw, const char *bias_dw, dst_data_t *dst,
+        const int32_t *dst_zero_point,
         const memory_tracking::grantor_t &scratchpad) const {
     const memory_desc_wrapper src_d(pd()->src_md());
     const memory_desc_wrapper dst_d(pd()->dst_md());
@@ -130,8 +153,9 @@ void jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t<src_type,
 
     auto offset = weights_d.size() - weights_d.additional_buffer_size();
     wei_data_t *w = const_cast<wei_data_t *>(weights);
-    int32_t *compensation
-            = (jcp.signed_input) ? reinterpret_cast<int32_t *>(w + offset) : 0;
+    int32_t *compensation = jcp.src_zero_point
+            ? scratchpad.get<int32_t>(key_conv_zp_src_comp)
+            : (jcp.signed_input) ? reinterpret_cast<int32_t *>(w + offset) : 0;
 
     auto p = jit_1x1_conv_call_s();
 
@@ -242,8 +266,8 @@ void jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t<src_type,
                 = &weights[pd()->with_groups() ? weights_d.blk_off(g, ocb, icb)
                                                : weights_d.blk_off(ocb, icb)];
         p.bias_data = &bias[_ocb * jcp.oc_block * bia_dt_size];
-        p.compensation
-                = (jcp.signed_input) ? &compensation[_ocb * jcp.oc_block] : 0;
+        p.compensation = compensation ? &compensation[_ocb * jcp.oc_block] : 0;
+        p.dst_zero_point = dst_zero_point;
         p.scales = (jcp.signed_input && jcp.ver != ver_vnni)
                 ? &local_scales[jcp.is_oc_scale * _ocb * jcp.oc_block]
                 : &oscales[jcp.is_oc_scale * _ocb * jcp.oc_block];
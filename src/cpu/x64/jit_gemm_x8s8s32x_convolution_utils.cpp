@@ -48,7 +48,7 @@ struct jit_pp_ker_t : pp_ker_t, jit_generator {
 
     void operator()(void *void_dst, const acc_data_t *acc, const char *bias,
             const float *scales, float nslope, float sum_scale,
-            float signed_scale, int g, size_t start,
+            float signed_scale, float dst_zero_point, int g, size_t start,
             size_t end) const override {
         assert(ker_);
 
@@ -68,6 +68,7 @@ struct jit_pp_ker_t : pp_ker_t, jit_generator {
         args.nslope = nslope;
         args.sum_scale = sum_scale;
         args.signed_scale = signed_scale;
+        args.dst_zero_point = dst_zero_point;
         args.len = end - start;
         args.oc_offset = oc_offset;
         ker_(&args);
@@ -84,6 +85,7 @@ private:
         float nslope;
         float sum_scale;
         float signed_scale;
+        float dst_zero_point;
         size_t len;
         size_t oc_offset;
     };
@@ -125,6 +127,8 @@ void jit_pp_ker_t::generate() {
     Zmm vreg_sum_scale = Zmm(3);
     Zmm vreg_signed_scale = Zmm(4);
     Zmm vreg_saturation_ubound = Zmm(5);
+    // the registers for unrolling end at Zmm(29)
+    Zmm vreg_dst_zero_point = Zmm(30);
 
     size_t def_unroll = 4;
     size_t max_unroll = 12;
@@ -150,6 +154,9 @@ void jit_pp_ker_t::generate() {
     vbroadcastss(vreg_nslope, ptr[reg_param + PARAM_OFF(nslope)]);
     vbroadcastss(vreg_sum_scale, ptr[reg_param + PARAM_OFF(sum_scale)]);
     vbroadcastss(vreg_signed_scale, ptr[reg_param + PARAM_OFF(signed_scale)]);
+    if (do_dst_zero_point_)
+        vbroadcastss(
+                vreg_dst_zero_point, ptr[reg_param + PARAM_OFF(dst_zero_point)]);
     if (scale_idx_mult_ == 0) vbroadcastss(vreg_scale, dword[reg_scales]);
 
 #undef PARAM_OFF
@@ -237,6 +244,9 @@ void jit_pp_ker_t::generate() {
         if (do_eltwise_)
             eltwise_injector_->compute_vector(vreg_dst(idx).getIdx());
 
+        if (do_dst_zero_point_)
+            vaddps(vreg_dst(idx), vreg_dst(idx), vreg_dst_zero_point);
+
         if (one_of(dst_data_type_, data_type::u8, data_type::s8,
                     data_type::s32)) {
             saturate_f32(vreg_dst(idx), vreg_zero, vreg_saturation_ubound,
@@ -20,6 +20,7 @@
 #include <limits.h>
 
 #include "common/bit_cast.hpp"
+#include "common/memory_footprint.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
@@ -1525,13 +1526,26 @@ public:
 
     DNNL_DISALLOW_COPY_AND_ASSIGN(jit_generator);
 
+private:
+    // The code is accounted once, even if it is requested several times
+    void account_jit_code(size_t code_size) {
+        if (jit_code_size_ != 0) return;
+        jit_code_size_ = code_size;
+        memory_footprint::add(memory_footprint::jit_code, code_size);
+    }
+
+    size_t jit_code_size_ = 0;
+
 public:
     jit_generator(void *code_ptr = nullptr, size_t code_size = MAX_CODE_SIZE,
             bool use_autogrow = true)
         : Xbyak::CodeGenerator(code_size,
                 (code_ptr == nullptr && use_autogrow) ? Xbyak::AutoGrow
                                                       : code_ptr) {}
-    virtual ~jit_generator() {}
+    virtual ~jit_generator() {
+        memory_footprint::add(
+                memory_footprint::jit_code, -(ptrdiff_t)jit_code_size_);
+    }
 
     virtual const char *name() const = 0;
     virtual const char *source_file() const = 0;
@@ -1544,6 +1558,7 @@ public:
         this->ready();
         const Xbyak::uint8 *code = CodeGenerator::getCode();
         register_jit_code(code, getSize());
+        account_jit_code(getSize());
         return code;
     }
 
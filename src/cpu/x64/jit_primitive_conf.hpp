@@ -528,6 +528,9 @@ struct jit_1x1_conv_conf_t {
     data_type_t dst_dt;
     bool signed_input;
     float wei_adj_scale;
+    // common zero points; the src one is folded into the compensation
+    bool src_zero_point;
+    bool dst_zero_point;
 
     cpu_isa_t isa;
     bool uses_permw_transposition;
@@ -542,6 +545,7 @@ struct jit_1x1_conv_call_s {
     const void *scales;
     const void *compensation;
     const void *store_buffer;
+    const void *dst_zero_point;
 
     size_t load_dim;
     size_t bcast_dim;
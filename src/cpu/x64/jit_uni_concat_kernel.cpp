@@ -0,0 +1,145 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_generator.hpp"
+
+#include "cpu/x64/jit_uni_concat_kernel.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace concat_utils {
+
+using namespace Xbyak;
+
+template <cpu_isa_t isa>
+struct jit_uni_nt_copy_kernel_t : public cpu::concat_utils::nt_copy_kernel_t,
+                                  public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(concat_utils::jit_uni_nt_copy_kernel_t);
+
+    jit_uni_nt_copy_kernel_t() {
+        generate();
+        ker_ = getCode<decltype(ker_)>();
+    }
+
+    void operator()(void *dst, const void *src, size_t size) const override {
+        ker_args_t args;
+        args.dst = dst;
+        args.src = src;
+        args.size = size;
+        ker_(&args);
+    }
+
+private:
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+    static constexpr int vlen = cpu_isa_traits<isa>::vlen;
+    static constexpr int unroll = 4;
+
+    struct ker_args_t {
+        void *dst;
+        const void *src;
+        size_t size;
+    };
+    void (*ker_)(const ker_args_t *args) = nullptr;
+
+    Reg64 reg_param = abi_param1;
+    Reg64 reg_dst = r8;
+    Reg64 reg_src = r9;
+    Reg64 reg_size = r10;
+    Reg64 reg_tmp = rax;
+
+    // Copies bytes one by one while the condition holds
+    template <typename F>
+    void copy_bytes(F cond, Label &l_end) {
+        Label l_loop, l_done;
+        L(l_loop);
+        {
+            cond(l_done);
+            test(reg_size, reg_size);
+            jz(l_end, T_NEAR);
+            mov(reg_tmp.cvt8(), ptr[reg_src]);
+            mov(ptr[reg_dst], reg_tmp.cvt8());
+            add(reg_src, 1);
+            add(reg_dst, 1);
+            sub(reg_size, 1);
+            jmp(l_loop);
+        }
+        L(l_done);
+    }
+
+    // Copies the vectors while at least n_vecs vectors remain
+    void copy_vectors(int n_vecs) {
+        Label l_loop, l_done;
+        L(l_loop);
+        {
+            cmp(reg_size, n_vecs * vlen);
+            jl(l_done, T_NEAR);
+            for (int i = 0; i < n_vecs; ++i)
+                uni_vmovups(Vmm(i), ptr[reg_src + i * vlen]);
+            for (int i = 0; i < n_vecs; ++i)
+                uni_vmovntps(ptr[reg_dst + i * vlen], Vmm(i));
+            add(reg_src, n_vecs * vlen);
+            add(reg_dst, n_vecs * vlen);
+            sub(reg_size, n_vecs * vlen);
+            jmp(l_loop);
+        }
+        L(l_done);
+    }
+
+    void generate() {
+        Label l_end;
+
+        preamble();
+#define PARAM_OFF(x) offsetof(ker_args_t, x)
+        mov(reg_dst, ptr[reg_param + PARAM_OFF(dst)]);
+        mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
+        mov(reg_size, ptr[reg_param + PARAM_OFF(size)]);
+#undef PARAM_OFF
+
+        // Non-temporal stores require the destination aligned on the vector
+        // length
+        copy_bytes(
+                [&](Label &l_done) {
+                    test(reg_dst, vlen - 1);
+                    jz(l_done, T_NEAR);
+                },
+                l_end);
+        copy_vectors(unroll);
+        copy_vectors(1);
+        copy_bytes([&](Label &l_done) {}, l_end);
+
+        L(l_end);
+        // Makes the non-temporal stores visible to the other threads
+        sfence();
+        postamble();
+    }
+};
+
+cpu::concat_utils::nt_copy_kernel_t *nt_copy_kernel_create() {
+    if (mayiuse(avx512_common))
+        return new jit_uni_nt_copy_kernel_t<avx512_common>();
+    if (mayiuse(avx)) return new jit_uni_nt_copy_kernel_t<avx>();
+    if (mayiuse(sse41)) return new jit_uni_nt_copy_kernel_t<sse41>();
+    return nullptr;
+}
+
+} // namespace concat_utils
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
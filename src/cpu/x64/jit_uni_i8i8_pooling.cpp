@@ -1066,8 +1066,23 @@ status_t jit_uni_i8i8_pooling_fwd_ker_t<isa>::init_conf(
     const bool is_1d = ndims == 3;
     const bool is_3d = ndims == 5;
 
+    using namespace format_tag;
+    const auto nspc_tag = utils::pick(ndims - 3, nwc, nhwc, ndhwc);
+    const auto blk16_tag = utils::pick(ndims - 3, nCw16c, nChw16c, nCdhw16c);
+    const auto blk8_tag = utils::pick(ndims - 3, nCw8c, nChw8c, nCdhw8c);
+    const auto fmt_tag
+            = src_d.matches_one_of_tag(nspc_tag, blk16_tag, blk8_tag);
+    if (fmt_tag == format_tag::undef || !dst_d.matches_tag(fmt_tag))
+        return status::unimplemented;
+
     jpp.mb = src_d.dims()[0];
-    jpp.c = src_d.dims()[1];
+    jpp.c_without_padding = src_d.dims()[1];
+    jpp.tag_kind = fmt_tag == nspc_tag ? jptg_nspc : jptg_blocked;
+    // A channel block of the blocked layout has the same structure as
+    // a channels last image with the block size channels, so the kernel
+    // processes the blocks one by one, the padded channels included
+    jpp.c = fmt_tag == nspc_tag ? jpp.c_without_padding
+                                : (fmt_tag == blk16_tag ? 16 : 8);
 
     jpp.id = is_3d ? src_d.dims()[ndims - 3] : 1;
     jpp.ih = is_1d ? 1 : src_d.dims()[ndims - 2];
@@ -1115,7 +1130,7 @@ status_t jit_uni_i8i8_pooling_fwd_ker_t<isa>::init_conf(
      * size, otherwise load/store will always spill outside the memory
      * boundary.*/
     bool safe_load_n_store = IMPLICATION(isa == avx2,
-            jpp.mb * jpp.c * nstl::min(jpp.id, jpp.od)
+            jpp.mb * src_d.padded_dims()[1] * nstl::min(jpp.id, jpp.od)
                             * nstl::min(jpp.ih, jpp.oh)
                             * nstl::min(jpp.iw, jpp.ow)
                     >= simd_w);
@@ -1198,8 +1213,12 @@ void jit_uni_i8i8_pooling_fwd_t<isa>::execute_forward(
             reinterpret_cast<ptrdiff_t>(dst_i8 + dst_d.size() - 1)
             - (cpu_isa_traits<isa>::vlen - 1));
 
-    parallel_nd(
-            jpp.mb, jpp.od, jpp.oh, jpp.ow, [&](int n, int od, int oh, int ow) {
+    const int nb_c_blk = jpp.tag_kind == jptg_blocked
+            ? src_d.padded_dims()[1] / jpp.c
+            : 1;
+
+    parallel_nd(jpp.mb, nb_c_blk, jpp.od, jpp.oh, jpp.ow,
+            [&](int n, int cb, int od, int oh, int ow) {
                 const int id = nstl::max(od * jpp.stride_d - jpp.f_pad, 0);
                 const int ih = nstl::max(oh * jpp.stride_h - jpp.t_pad, 0);
                 const int iw = nstl::max(ow * jpp.stride_w - jpp.l_pad, 0);
@@ -1219,9 +1238,10 @@ void jit_uni_i8i8_pooling_fwd_t<isa>::execute_forward(
 
                 auto p = typename jit_uni_i8i8_pooling_fwd_ker_t<
                         isa>::call_params_t();
-                p.src_i8 = &src_i8[get_offset(src_d, n, 0, id, ih, iw)
+                // The offsets of the blocked layout take the block index
+                p.src_i8 = &src_i8[get_offset(src_d, n, cb, id, ih, iw)
                         * src_d.data_type_size()];
-                p.dst_i8 = &dst_i8[get_offset(dst_d, n, 0, od, oh, ow)
+                p.dst_i8 = &dst_i8[get_offset(dst_d, n, cb, od, oh, ow)
                         * dst_d.data_type_size()];
                 p.kd_range = (size_t)(kd_end - kd_start);
                 p.kh_range = (size_t)(kh_end - kh_start);
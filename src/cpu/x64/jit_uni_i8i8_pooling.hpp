@@ -52,15 +52,7 @@ struct jit_uni_i8i8_pooling_fwd_t : public primitive_t {
                     && utils::one_of(src_md()->data_type, data_type::s32,
                             data_type::s8, data_type::u8)
                     && src_md()->data_type == dst_md()->data_type
-                    && attr()->has_default_values()
-                    && memory_desc_matches_one_of_tag(*src_md(),
-                               format_tag::nwc, format_tag::nhwc,
-                               format_tag::ndhwc)
-                            != format_tag::undef
-                    && memory_desc_matches_one_of_tag(*dst_md(),
-                               format_tag::nwc, format_tag::nhwc,
-                               format_tag::ndhwc)
-                            != format_tag::undef;
+                    && attr()->has_default_values();
             if (!ok) return status::unimplemented;
 
             return jit_conf();
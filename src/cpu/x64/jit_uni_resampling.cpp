@@ -0,0 +1,566 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <assert.h>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/resampling_utils.hpp"
+
+#include "cpu/x64/jit_generator.hpp"
+
+#include "cpu/x64/jit_uni_resampling.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace Xbyak;
+using namespace resampling_utils;
+
+#define GET_OFF(field) offsetof(jit_resampling_call_s, field)
+struct jit_resampling_call_s {
+    // The input points (nspc) or rows (ncsp) and their weights
+    const float *const *src;
+    const float *wei;
+    size_t n;
+    float *dst;
+    // ncsp: the byte offsets in a row and the weights along the width
+    const int *w_idx;
+    const float *w_wei;
+};
+
+dim_t jit_resampling_table_t::max_size() const {
+    dim_t max_size = 0;
+    for (size_t p = 0; p + 1 < off.size(); ++p)
+        max_size = nstl::max(max_size, size(p));
+    return max_size;
+}
+
+namespace {
+
+// out_len is the length of the dimension of the output side, in_len is the
+// one of the input side
+void init_table(jit_resampling_table_t &t, alg_kind_t alg, bool is_fwd,
+        dim_t out_len, dim_t in_len, float f) {
+    t.off.clear();
+    t.idx.clear();
+    t.wei.clear();
+
+    // The neighbouring entries of the same input point are merged, this
+    // removes the second entry of the dimensions which are not resampled
+    auto push = [&](dim_t p, dim_t idx, float wei) {
+        if (t.idx.size() > (size_t)t.off[p] && t.idx.back() == idx) {
+            t.wei.back() += wei;
+            return;
+        }
+        t.idx.push_back(idx);
+        t.wei.push_back(wei);
+    };
+
+    const bool is_nearest = alg == alg_kind::resampling_nearest;
+    for (dim_t p = 0; p < out_len; ++p) {
+        t.off.push_back((dim_t)t.idx.size());
+        if (is_fwd && is_nearest) {
+            push(p, nearest_idx(p, f), 1.f);
+        } else if (is_fwd) {
+            const linear_coeffs_t c(p, f, in_len);
+            for (int k = 0; k < 2; ++k)
+                push(p, c.idx[k], c.wei[k]);
+        } else if (is_nearest) {
+            const dim_t start = ceil_idx(p * f - 0.5f);
+            const dim_t end = ceil_idx((p + 1.f) * f - 0.5f);
+            for (dim_t o = start; o < end; ++o)
+                push(p, o, 1.f);
+        } else {
+            const bwd_linear_coeffs_t c(p, f, out_len, in_len);
+            for_(int k = 0; k < 2; ++k)
+            for (dim_t o = c.start[k]; o < c.end[k]; ++o)
+                push(p, o, linear_weight(k, o, f));
+        }
+    }
+    t.off.push_back((dim_t)t.idx.size());
+}
+
+void init_w_table(const jit_resampling_conf_t &conf,
+        const jit_resampling_table_t &tw, std::vector<int> &w_idx,
+        std::vector<float> &w_wei) {
+    if (conf.is_nspc) return;
+
+    // The table is padded to the full vectors, the padded entries have
+    // zero weights and point to the beginning of the row
+    const dim_t plane_size = conf.w_stride / sizeof(float);
+    w_idx.assign(conf.n_w_entries * plane_size, 0);
+    w_wei.assign(conf.n_w_entries * plane_size, 0.f);
+    for_(dim_t p = 0; p < conf.inner_size; ++p)
+    for (dim_t k = 0; k < tw.size(p); ++k) {
+        const dim_t e = tw.off[p] + k;
+        w_idx[k * plane_size + p] = (int)(tw.idx[e] * sizeof(float));
+        w_wei[k * plane_size + p] = tw.wei[e];
+    }
+}
+
+} // namespace
+
+status_t init_resampling_conf(const resampling_pd_t *pd, format_tag_t dat_tag,
+        jit_resampling_conf_t &conf, jit_resampling_table_t tables[3]) {
+    using namespace format_tag;
+
+    const bool is_fwd = pd->is_fwd();
+    const alg_kind_t alg = pd->desc()->alg_kind;
+    const dim_t out_d = is_fwd ? pd->OD() : pd->ID();
+    const dim_t out_h = is_fwd ? pd->OH() : pd->IH();
+    const dim_t out_w = is_fwd ? pd->OW() : pd->IW();
+    const dim_t in_d = is_fwd ? pd->ID() : pd->OD();
+    const dim_t in_h = is_fwd ? pd->IH() : pd->OH();
+    const dim_t in_w = is_fwd ? pd->IW() : pd->OW();
+
+    init_table(tables[0], alg, is_fwd, out_d, in_d, pd->FD());
+    init_table(tables[1], alg, is_fwd, out_h, in_h, pd->FH());
+    init_table(tables[2], alg, is_fwd, out_w, in_w, pd->FW());
+
+    conf.is_nspc = utils::one_of(dat_tag, nwc, nhwc, ndhwc);
+    conf.inner_size = conf.is_nspc ? pd->C() : out_w;
+    conf.n_w_entries = 0;
+    conf.w_stride = 0;
+    if (!conf.is_nspc) {
+        // The entries along the width are unrolled in the kernel
+        const dim_t max_w_entries = 16;
+        const dim_t n_w_entries = tables[2].max_size();
+        if (n_w_entries > max_w_entries) return status::unimplemented;
+
+        // The planes are padded to the widest vector
+        const int simd_w = cpu_isa_traits<avx512_common>::vlen / sizeof(float);
+        conf.n_w_entries = (int)n_w_entries;
+        conf.w_stride = utils::rnd_up(out_w, simd_w) * sizeof(float);
+    }
+    conf.max_entries = tables[0].max_size() * tables[1].max_size()
+            * (conf.is_nspc ? tables[2].max_size() : 1);
+
+    return status::success;
+}
+
+void init_resampling_scratchpad(memory_tracking::registrar_t &scratchpad,
+        const jit_resampling_conf_t &conf) {
+    using namespace memory_tracking::names;
+    const size_t nthr = dnnl_get_max_threads();
+    scratchpad.book<const float *>(
+            key_resampling_src_ptrs, conf.max_entries * nthr);
+    scratchpad.book<float>(key_resampling_wei, conf.max_entries * nthr);
+}
+
+// nspc: a kernel call computes all the channels of a point of the output
+// side as a weighted sum of the channels of the input points.
+// ncsp: a kernel call computes a row of the output side. The input rows are
+// weighted sums of the gathered elements, the weights and the offsets along
+// the width are read from a table.
+template <cpu_isa_t isa>
+struct jit_uni_resampling_kernel_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_resampling_kernel_t)
+
+    jit_uni_resampling_kernel_t(const jit_resampling_conf_t &conf)
+        : conf_(conf) {
+        generate();
+        ker_ = (decltype(ker_))getCode();
+    }
+
+    void operator()(const jit_resampling_call_s *args) const { ker_(args); }
+
+private:
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+    static constexpr int vlen = cpu_isa_traits<isa>::vlen;
+    static constexpr int simd_w = vlen / sizeof(float);
+    static constexpr bool is_avx512 = isa == avx512_common;
+    // The number of vectors of the channels accumulated at once
+    static constexpr int unroll = 4;
+
+    const jit_resampling_conf_t conf_;
+    void (*ker_)(const jit_resampling_call_s *) = nullptr;
+
+    Reg64 reg_param = abi_param1;
+    Reg64 reg_src_list = r8;
+    Reg64 reg_wei_list = r9;
+    Reg64 reg_n = r10;
+    Reg64 reg_dst = r11;
+    Reg64 reg_w_idx = r12;
+    Reg64 reg_w_wei = r13;
+    Reg64 reg_off = r14;
+    Reg64 reg_i = r15;
+    Reg64 reg_src = rax;
+    Reg64 reg_work = rbx;
+    Reg64 reg_tmp = rdx;
+
+    Opmask k_tail = Opmask(1);
+    Opmask k_gather = Opmask(2);
+
+    Vmm vmm_acc(int idx) { return Vmm(idx); }
+    Vmm vmm_wei = Vmm(unroll);
+    Vmm vmm_tmp = Vmm(unroll + 1);
+    Vmm vmm_row = Vmm(unroll + 2);
+    Vmm vmm_idx = Vmm(unroll + 3);
+    Vmm vmm_gather_mask = Vmm(unroll + 4);
+    Vmm vmm_tail_mask = Vmm(15);
+
+    void prepare_tail_mask(int tail) {
+        if (is_avx512) {
+            mov(reg_tmp.cvt32(), (1 << tail) - 1);
+            kmovw(k_tail, reg_tmp.cvt32());
+        } else {
+            static const uint32_t mask_f32[14]
+                    = {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+                            0xffffffff, 0xffffffff, 0xffffffff, 0, 0, 0, 0, 0,
+                            0, 0};
+            mov(reg_tmp, reinterpret_cast<size_t>(&mask_f32[7 - tail]));
+            vmovups(vmm_tail_mask, ptr[reg_tmp]);
+        }
+    }
+
+    void load_tail(const Vmm &v, const Address &addr) {
+        if (is_avx512)
+            vmovups(v | k_tail | T_z, addr);
+        else
+            vmaskmovps(v, vmm_tail_mask, addr);
+    }
+
+    void store(const Address &addr, const Vmm &v, bool tail) {
+        if (!tail)
+            uni_vmovups(addr, v);
+        else if (is_avx512)
+            vmovups(addr | k_tail, v);
+        else
+            vmaskmovps(addr, vmm_tail_mask, v);
+    }
+
+    // The gather clears its mask, so it is restored every time
+    void gather(const Vmm &v, const Reg64 &base, const Vmm &vidx) {
+        if (is_avx512) {
+            kxnorw(k_gather, k_gather, k_gather);
+            vgatherdps(v | k_gather, ptr[base + vidx]);
+        } else {
+            vpcmpeqd(vmm_gather_mask, vmm_gather_mask, vmm_gather_mask);
+            vgatherdps(v, ptr[base + vidx], vmm_gather_mask);
+        }
+    }
+
+    template <typename body_t>
+    void entry_loop(body_t body) {
+        Label loop, loop_end;
+        xor_(reg_i, reg_i);
+        L(loop);
+        {
+            cmp(reg_i, reg_n);
+            jge(loop_end, T_NEAR);
+
+            mov(reg_src, ptr[reg_src_list + reg_i * sizeof(void *)]);
+            body();
+
+            inc(reg_i);
+            jmp(loop, T_NEAR);
+        }
+        L(loop_end);
+    }
+
+    // The tail applies to the last vector of the block
+    void nspc_block(int n_vecs, bool tail) {
+        for (int v = 0; v < n_vecs; ++v)
+            uni_vpxor(vmm_acc(v), vmm_acc(v), vmm_acc(v));
+
+        entry_loop([&]() {
+            uni_vbroadcastss(
+                    vmm_wei, ptr[reg_wei_list + reg_i * sizeof(float)]);
+            for (int v = 0; v < n_vecs; ++v) {
+                const Address addr = ptr[reg_src + reg_off + v * vlen];
+                if (tail && v == n_vecs - 1) {
+                    load_tail(vmm_tmp, addr);
+                    uni_vfmadd231ps(vmm_acc(v), vmm_wei, vmm_tmp);
+                } else
+                    uni_vfmadd231ps(vmm_acc(v), vmm_wei, addr);
+            }
+        });
+
+        for (int v = 0; v < n_vecs; ++v)
+            store(ptr[reg_dst + reg_off + v * vlen], vmm_acc(v),
+                    tail && v == n_vecs - 1);
+    }
+
+    void ncsp_vec(bool tail) {
+        const Vmm vmm_acc0 = vmm_acc(0);
+        const Vmm vmm_data = vmm_acc(1);
+        uni_vpxor(vmm_acc0, vmm_acc0, vmm_acc0);
+
+        entry_loop([&]() {
+            uni_vpxor(vmm_row, vmm_row, vmm_row);
+            for (int k = 0; k < conf_.n_w_entries; ++k) {
+                const dim_t plane_off = k * conf_.w_stride;
+                uni_vmovups(vmm_idx, ptr[reg_w_idx + reg_off + plane_off]);
+                gather(vmm_data, reg_src, vmm_idx);
+                uni_vfmadd231ps(vmm_row, vmm_data,
+                        ptr[reg_w_wei + reg_off + plane_off]);
+            }
+            uni_vbroadcastss(
+                    vmm_wei, ptr[reg_wei_list + reg_i * sizeof(float)]);
+            uni_vfmadd231ps(vmm_acc0, vmm_row, vmm_wei);
+        });
+
+        store(ptr[reg_dst + reg_off], vmm_acc0, tail);
+    }
+
+    void generate() {
+        preamble();
+
+        mov(reg_src_list, ptr[reg_param + GET_OFF(src)]);
+        mov(reg_wei_list, ptr[reg_param + GET_OFF(wei)]);
+        mov(reg_n, ptr[reg_param + GET_OFF(n)]);
+        mov(reg_dst, ptr[reg_param + GET_OFF(dst)]);
+        if (!conf_.is_nspc) {
+            mov(reg_w_idx, ptr[reg_param + GET_OFF(w_idx)]);
+            mov(reg_w_wei, ptr[reg_param + GET_OFF(w_wei)]);
+        }
+
+        const dim_t blk = conf_.is_nspc ? unroll * simd_w : simd_w;
+        const dim_t nb = conf_.inner_size / blk;
+        const int tail = conf_.inner_size % simd_w;
+        if (tail) prepare_tail_mask(tail);
+
+        xor_(reg_off, reg_off);
+        if (nb > 0) {
+            Label block_loop;
+            mov(reg_work, nb);
+            L(block_loop);
+            {
+                if (conf_.is_nspc)
+                    nspc_block(unroll, false);
+                else
+                    ncsp_vec(false);
+                add(reg_off, blk * sizeof(float));
+                dec(reg_work);
+                jnz(block_loop, T_NEAR);
+            }
+        }
+
+        if (conf_.is_nspc) {
+            const int n_vecs = (conf_.inner_size % blk) / simd_w + (tail > 0);
+            if (n_vecs) nspc_block(n_vecs, tail > 0);
+        } else if (tail)
+            ncsp_vec(true);
+
+        postamble();
+    }
+};
+
+namespace {
+
+template <cpu_isa_t isa>
+void execute_common(const resampling_pd_t *pd,
+        const jit_resampling_conf_t &conf,
+        const jit_resampling_table_t tables[3], const std::vector<int> &w_idx,
+        const std::vector<float> &w_wei,
+        const jit_uni_resampling_kernel_t<isa> &kernel,
+        const memory_tracking::grantor_t &scratchpad, const float *in,
+        float *out) {
+    using namespace memory_tracking::names;
+
+    const bool is_fwd = pd->is_fwd();
+    const dim_t MB = pd->MB();
+    const dim_t C = pd->C();
+    const dim_t out_d = is_fwd ? pd->OD() : pd->ID();
+    const dim_t out_h = is_fwd ? pd->OH() : pd->IH();
+    const dim_t out_w = is_fwd ? pd->OW() : pd->IW();
+    const dim_t in_d = is_fwd ? pd->ID() : pd->OD();
+    const dim_t in_h = is_fwd ? pd->IH() : pd->OH();
+    const dim_t in_w = is_fwd ? pd->IW() : pd->OW();
+    const auto &td = tables[0];
+    const auto &th = tables[1];
+    const auto &tw = tables[2];
+
+    // nspc: the work is the points of the output side, ncsp: its rows
+    const dim_t nsp_outer = conf.is_nspc ? MB : MB * C;
+    const dim_t inner_w = conf.is_nspc ? out_w : 1;
+    const dim_t work_amount = nsp_outer * out_d * out_h * inner_w;
+    const dim_t max_entries = conf.max_entries;
+    const float **src_ptrs
+            = scratchpad.get<const float *>(key_resampling_src_ptrs);
+    float *wei_base = scratchpad.get<float>(key_resampling_wei);
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(work_amount, nthr, ithr, start, end);
+        if (start == end) return;
+
+        const float **src = src_ptrs + ithr * max_entries;
+        float *wei = wei_base + ithr * max_entries;
+
+        dim_t n {0}, od {0}, oh {0}, ow {0};
+        utils::nd_iterator_init(start, n, nsp_outer, od, out_d, oh, out_h, ow,
+                inner_w);
+        for (dim_t iwork = start; iwork < end; ++iwork) {
+            const dim_t in_c = conf.is_nspc ? C : 1;
+            const float *in_n = in + n * in_d * in_h * in_w * in_c;
+            size_t n_entries = 0;
+            for_(dim_t i = td.off[od]; i < td.off[od + 1]; ++i)
+            for (dim_t j = th.off[oh]; j < th.off[oh + 1]; ++j) {
+                const float *in_row
+                        = in_n + (td.idx[i] * in_h + th.idx[j]) * in_w * in_c;
+                const float wei_dh = td.wei[i] * th.wei[j];
+                if (!conf.is_nspc) {
+                    src[n_entries] = in_row;
+                    wei[n_entries] = wei_dh;
+                    ++n_entries;
+                    continue;
+                }
+                for (dim_t k = tw.off[ow]; k < tw.off[ow + 1]; ++k) {
+                    src[n_entries] = in_row + tw.idx[k] * C;
+                    wei[n_entries] = wei_dh * tw.wei[k];
+                    ++n_entries;
+                }
+            }
+
+            const dim_t out_off = conf.is_nspc
+                    ? (((n * out_d + od) * out_h + oh) * out_w + ow) * C
+                    : ((n * out_d + od) * out_h + oh) * out_w;
+
+            jit_resampling_call_s args;
+            args.src = src;
+            args.wei = wei;
+            args.n = n_entries;
+            args.dst = out + out_off;
+            args.w_idx = w_idx.data();
+            args.w_wei = w_wei.data();
+            kernel(&args);
+
+            utils::nd_iterator_step(
+                    n, nsp_outer, od, out_d, oh, out_h, ow, inner_w);
+        }
+    });
+}
+
+} // namespace
+
+template <cpu_isa_t isa>
+status_t jit_uni_resampling_fwd_t<isa>::pd_t::init(engine_t *engine) {
+    using namespace format_tag;
+    using namespace data_type;
+
+    bool ok = mayiuse(isa) && is_fwd() && !has_zero_dim_memory()
+            && utils::everyone_is(f32, src_md()->data_type, dst_md()->data_type)
+            && set_default_params() == status::success
+            && attr()->has_default_values();
+    if (!ok) return status::unimplemented;
+
+    const format_tag_t dat_tag = memory_desc_matches_one_of_tag(
+            *src_md(), ncw, nchw, ncdhw, nwc, nhwc, ndhwc);
+    if (dat_tag == format_tag::undef
+            || !memory_desc_matches_tag(*dst_md(), dat_tag))
+        return status::unimplemented;
+
+    CHECK(init_resampling_conf(this, dat_tag, conf_, tables_));
+
+    auto scratchpad = scratchpad_registry().registrar();
+    init_resampling_scratchpad(scratchpad, conf_);
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+jit_uni_resampling_fwd_t<isa>::jit_uni_resampling_fwd_t(const pd_t *apd)
+    : primitive_t(apd) {}
+
+template <cpu_isa_t isa>
+jit_uni_resampling_fwd_t<isa>::~jit_uni_resampling_fwd_t() = default;
+
+template <cpu_isa_t isa>
+status_t jit_uni_resampling_fwd_t<isa>::init(engine_t *engine) {
+    init_w_table(pd()->conf_, pd()->tables_[2], w_idx_, w_wei_);
+    kernel_.reset(new jit_uni_resampling_kernel_t<isa>(pd()->conf_));
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_resampling_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
+    const auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    execute_common<isa>(pd(), pd()->conf_, pd()->tables_, w_idx_, w_wei_,
+            *kernel_, ctx.get_scratchpad_grantor(), src, dst);
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_resampling_bwd_t<isa>::pd_t::init(engine_t *engine) {
+    using namespace format_tag;
+    using namespace data_type;
+
+    bool ok = mayiuse(isa) && !is_fwd() && !has_zero_dim_memory()
+            && utils::everyone_is(
+                    f32, diff_src_md()->data_type, diff_dst_md()->data_type)
+            && set_default_params() == status::success
+            && attr()->has_default_values();
+    if (!ok) return status::unimplemented;
+
+    const format_tag_t dat_tag = memory_desc_matches_one_of_tag(
+            *diff_src_md(), ncw, nchw, ncdhw, nwc, nhwc, ndhwc);
+    if (dat_tag == format_tag::undef
+            || !memory_desc_matches_tag(*diff_dst_md(), dat_tag))
+        return status::unimplemented;
+
+    CHECK(init_resampling_conf(this, dat_tag, conf_, tables_));
+
+    auto scratchpad = scratchpad_registry().registrar();
+    init_resampling_scratchpad(scratchpad, conf_);
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+jit_uni_resampling_bwd_t<isa>::jit_uni_resampling_bwd_t(const pd_t *apd)
+    : primitive_t(apd) {}
+
+template <cpu_isa_t isa>
+jit_uni_resampling_bwd_t<isa>::~jit_uni_resampling_bwd_t() = default;
+
+template <cpu_isa_t isa>
+status_t jit_uni_resampling_bwd_t<isa>::init(engine_t *engine) {
+    init_w_table(pd()->conf_, pd()->tables_[2], w_idx_, w_wei_);
+    kernel_.reset(new jit_uni_resampling_kernel_t<isa>(pd()->conf_));
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_resampling_bwd_t<isa>::execute(const exec_ctx_t &ctx) const {
+    const auto diff_dst = CTX_IN_MEM(const float *, DNNL_ARG_DIFF_DST);
+    auto diff_src = CTX_OUT_MEM(float *, DNNL_ARG_DIFF_SRC);
+
+    execute_common<isa>(pd(), pd()->conf_, pd()->tables_, w_idx_, w_wei_,
+            *kernel_, ctx.get_scratchpad_grantor(), diff_dst, diff_src);
+    return status::success;
+}
+
+template struct jit_uni_resampling_fwd_t<avx512_common>;
+template struct jit_uni_resampling_fwd_t<avx2>;
+template struct jit_uni_resampling_bwd_t<avx512_common>;
+template struct jit_uni_resampling_bwd_t<avx2>;
+
+#undef GET_OFF
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
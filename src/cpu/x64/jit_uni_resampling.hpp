@@ -0,0 +1,139 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_UNI_RESAMPLING_HPP
+#define CPU_X64_JIT_UNI_RESAMPLING_HPP
+
+#include <memory>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/cpu_resampling_pd.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// A point of the output side (dst for forward, diff_src for backward) is a
+// weighted sum of the points of the input side. The weights are separable,
+// so they are precomputed for every spatial dimension: the point p of a
+// dimension takes the input points idx[off[p]], ..., idx[off[p + 1] - 1]
+// with the weights wei[off[p]], ..., wei[off[p + 1] - 1].
+struct jit_resampling_table_t {
+    std::vector<dim_t> off;
+    std::vector<dim_t> idx;
+    std::vector<float> wei;
+
+    dim_t size(dim_t p) const { return off[p + 1] - off[p]; }
+    dim_t max_size() const;
+};
+
+struct jit_resampling_conf_t {
+    // If true, the vectors go over the channels, otherwise over the width
+    bool is_nspc;
+    // nspc: the number of channels, ncsp: the width of the output side
+    dim_t inner_size;
+    // ncsp: the maximal number of the input points of an output one along
+    // the width and the distance between their planes of the width table
+    int n_w_entries;
+    dim_t w_stride;
+    // The maximal number of the input points (nspc) or rows (ncsp) of a
+    // kernel call
+    dim_t max_entries;
+};
+
+status_t init_resampling_conf(const resampling_pd_t *pd, format_tag_t dat_tag,
+        jit_resampling_conf_t &conf, jit_resampling_table_t tables[3]);
+
+// Books the per thread lists of the input pointers and the weights passed to
+// the kernel
+void init_resampling_scratchpad(memory_tracking::registrar_t &scratchpad,
+        const jit_resampling_conf_t &conf);
+
+template <cpu_isa_t isa>
+struct jit_uni_resampling_kernel_t;
+
+template <cpu_isa_t isa>
+struct jit_uni_resampling_fwd_t : public primitive_t {
+    struct pd_t : public cpu_resampling_fwd_pd_t {
+        using cpu_resampling_fwd_pd_t::cpu_resampling_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit:", isa, ""),
+                jit_uni_resampling_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        jit_resampling_conf_t conf_;
+        jit_resampling_table_t tables_[3];
+    };
+
+    jit_uni_resampling_fwd_t(const pd_t *apd);
+    ~jit_uni_resampling_fwd_t();
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::vector<int> w_idx_;
+    std::vector<float> w_wei_;
+    std::unique_ptr<jit_uni_resampling_kernel_t<isa>> kernel_;
+};
+
+template <cpu_isa_t isa>
+struct jit_uni_resampling_bwd_t : public primitive_t {
+    struct pd_t : public cpu_resampling_bwd_pd_t {
+        using cpu_resampling_bwd_pd_t::cpu_resampling_bwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit:", isa, ""),
+                jit_uni_resampling_bwd_t);
+
+        status_t init(engine_t *engine);
+
+        jit_resampling_conf_t conf_;
+        jit_resampling_table_t tables_[3];
+    };
+
+    jit_uni_resampling_bwd_t(const pd_t *apd);
+    ~jit_uni_resampling_bwd_t();
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::vector<int> w_idx_;
+    std::vector<float> w_wei_;
+    std::unique_ptr<jit_uni_resampling_kernel_t<isa>> kernel_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,291 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <assert.h>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/x64/jit_generator.hpp"
+
+#include "cpu/x64/jit_uni_shuffle.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_shuffle_call_s, field)
+struct jit_shuffle_call_s {
+    const void *src; // fwd: src bwd: diff_dst
+    void *dst; // fwd: dst bwd: diff_src
+    const int *offsets;
+    size_t work_amount; // the number of points, or vectors to copy
+};
+
+// A point is a set of the channels which share the spatial position. For the
+// channels last layout it is all the channels, for the blocked one it is a
+// block, so the offsets are loaded once per kernel call.
+template <cpu_isa_t isa>
+struct jit_uni_shuffle_kernel_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_shuffle_kernel_t)
+
+    jit_uni_shuffle_kernel_t(const jit_shuffle_conf_t &conf) : conf_(conf) {
+        generate();
+        ker_ = (decltype(ker_))getCode();
+    }
+
+    void operator()(const jit_shuffle_call_s *args) const { ker_(args); }
+
+private:
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+    static constexpr int vlen = cpu_isa_traits<isa>::vlen;
+    // The gathers of up to n_regs vectors are issued back to back, before
+    // their stores, to hide their latency. The vector v of a point uses the
+    // registers and the gather mask v % n_regs.
+    static constexpr int n_regs = 4;
+
+    const jit_shuffle_conf_t conf_;
+    void (*ker_)(const jit_shuffle_call_s *) = nullptr;
+
+    Reg64 reg_param = abi_param1;
+    Reg64 reg_src = r8;
+    Reg64 reg_dst = r9;
+    Reg64 reg_offsets = r10;
+    Reg64 reg_work = r11;
+    Reg64 reg_tmp = rax;
+
+    Opmask k_full = Opmask(1);
+    Opmask k_tail = Opmask(2);
+
+    Vmm vmm_data(int idx) { return Vmm(idx % n_regs); }
+    Vmm vmm_offsets(int idx) { return Vmm(n_regs + idx % n_regs); }
+    Opmask k_gather(int idx) { return Opmask(3 + idx % n_regs); }
+
+    void load_vec(int v, bool tail) {
+        const Vmm vdata = vmm_data(v);
+        const Opmask &k = tail ? k_tail : k_full;
+        if (conf_.gather) {
+            // The offsets of a single vector are loaded once, before the loop
+            const Vmm voffsets = vmm_offsets(v);
+            if (conf_.n_vecs > 1)
+                vmovups(voffsets, ptr[reg_offsets + v * vlen]);
+            // The gather clears the mask when it completes
+            const Opmask kg = k_gather(v);
+            kmovw(kg, k);
+            vpgatherdd(vdata | kg, ptr[reg_src + voffsets]);
+        } else {
+            vmovups(vdata | k | T_z, ptr[reg_src + v * vlen]);
+        }
+    }
+
+    void store_vec(int v, bool tail) {
+        const Opmask &k = tail ? k_tail : k_full;
+        vmovups(ptr[reg_dst + v * vlen] | k, vmm_data(v));
+    }
+
+    void generate() {
+        preamble();
+
+        mov(reg_src, ptr[reg_param + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_param + GET_OFF(dst)]);
+        mov(reg_work, ptr[reg_param + GET_OFF(work_amount)]);
+        if (conf_.gather) mov(reg_offsets, ptr[reg_param + GET_OFF(offsets)]);
+
+        kxnorw(k_full, k_full, k_full);
+        if (conf_.tail) {
+            mov(reg_tmp.cvt32(), (1 << conf_.tail) - 1);
+            kmovw(k_tail, reg_tmp.cvt32());
+        }
+        if (conf_.gather && conf_.n_vecs == 1)
+            vmovups(vmm_offsets(0), ptr[reg_offsets]);
+
+        Label point_loop, point_loop_end;
+        L(point_loop);
+        {
+            cmp(reg_work, 0);
+            jle(point_loop_end, T_NEAR);
+
+            auto is_tail = [&](int v) {
+                return conf_.gather && conf_.tail && v == conf_.n_vecs - 1;
+            };
+            for (int v_s = 0; v_s < conf_.n_vecs; v_s += n_regs) {
+                const int v_e = nstl::min(v_s + n_regs, conf_.n_vecs);
+                for (int v = v_s; v < v_e; ++v)
+                    load_vec(v, is_tail(v));
+                for (int v = v_s; v < v_e; ++v)
+                    store_vec(v, is_tail(v));
+            }
+
+            add(reg_src, conf_.stride);
+            add(reg_dst, conf_.stride);
+            dec(reg_work);
+            jmp(point_loop, T_NEAR);
+        }
+        L(point_loop_end);
+
+        if (!conf_.gather && conf_.tail) {
+            load_vec(0, true);
+            store_vec(0, true);
+        }
+
+        postamble();
+    }
+};
+
+template <cpu_isa_t isa>
+jit_uni_shuffle_t<isa>::jit_uni_shuffle_t(const pd_t *apd)
+    : primitive_t(apd) {}
+
+template <cpu_isa_t isa>
+jit_uni_shuffle_t<isa>::~jit_uni_shuffle_t() {
+    free(rev_transposed_);
+    free(offsets_);
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_shuffle_t<isa>::init(engine_t *engine) {
+    const int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+    const dim_t C = pd()->C();
+    const dim_t SP = pd()->D() * pd()->H() * pd()->W();
+    const dim_t C_padded = utils::rnd_up(C, simd_w);
+    const int axis_size = pd()->axis_size();
+    const int group_size = pd()->group_size();
+    const int transpose_row
+            = pd()->is_fwd() ? group_size : axis_size / group_size;
+    const int transpose_col
+            = pd()->is_fwd() ? axis_size / group_size : group_size;
+
+    rev_transposed_ = (int *)malloc(
+            axis_size * sizeof(int), platform::get_cache_line_size());
+    if (rev_transposed_ == nullptr) return status::out_of_memory;
+    parallel_nd(transpose_col, transpose_row, [&](int i, int j) {
+        rev_transposed_[j * transpose_col + i] = i * transpose_row + j;
+    });
+
+    const auto dat_tag = pd()->dat_tag_;
+    conf_.gather = dat_tag != pd()->ncsp_tag_;
+    if (dat_tag == pd()->blk_tag_) {
+        conf_.n_vecs = 1;
+        conf_.tail = 0;
+        conf_.stride = simd_w * sizeof(float);
+    } else if (dat_tag == pd()->nspc_tag_) {
+        conf_.n_vecs = C_padded / simd_w;
+        conf_.tail = C % simd_w;
+        conf_.stride = C * sizeof(float);
+    } else {
+        conf_.n_vecs = 1;
+        conf_.tail = SP % simd_w;
+        conf_.stride = simd_w * sizeof(float);
+    }
+
+    if (conf_.gather) {
+        offsets_ = (int *)malloc(
+                C_padded * sizeof(int), platform::get_cache_line_size());
+        if (offsets_ == nullptr) return status::out_of_memory;
+        const bool is_blk = dat_tag == pd()->blk_tag_;
+        for (dim_t c = 0; c < C_padded; ++c) {
+            // The padded channels are taken from the padding of the input,
+            // which keeps zeros, so the blocks are always processed fully
+            const dim_t ic = c < C ? rev_transposed_[c] : c;
+            const dim_t off = is_blk
+                    ? (ic / simd_w) * SP * simd_w + ic % simd_w
+                    : (c < C ? ic : 0);
+            offsets_[c] = (int)(off * sizeof(float));
+        }
+    }
+
+    kernel_.reset(new jit_uni_shuffle_kernel_t<isa>(conf_));
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_shuffle_t<isa>::execute(const exec_ctx_t &ctx) const {
+    const int i_arg = pd()->is_fwd() ? DNNL_ARG_SRC : DNNL_ARG_DIFF_DST;
+    const int o_arg = pd()->is_fwd() ? DNNL_ARG_DST : DNNL_ARG_DIFF_SRC;
+    auto input = CTX_IN_MEM(const char *, i_arg);
+    auto output = CTX_OUT_MEM(char *, o_arg);
+
+    const memory_desc_wrapper data_d(pd()->data_md());
+    const int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+    const dim_t MB = pd()->MB();
+    const dim_t C = pd()->C();
+    const dim_t SP = pd()->D() * pd()->H() * pd()->W();
+    const dim_t stride_mb = data_d.blocking_desc().strides[0] * sizeof(float);
+    const auto dat_tag = pd()->dat_tag_;
+
+    // The points of a call take about a half of L1 cache
+    const dim_t point_size = conf_.n_vecs * simd_w * sizeof(float);
+    const dim_t sp_blk = nstl::max((dim_t)1,
+            nstl::min(SP, (dim_t)platform::get_per_core_cache_size(1) / 2
+                            / point_size));
+    const dim_t nb_sp = utils::div_up(SP, sp_blk);
+
+    if (dat_tag == pd()->blk_tag_) {
+        const dim_t CB = utils::div_up(C, simd_w);
+        parallel_nd(MB, CB, nb_sp, [&](dim_t mb, dim_t cb, dim_t spb) {
+            const dim_t sp = spb * sp_blk;
+            const dim_t off = mb * stride_mb + sp * simd_w * sizeof(float);
+            jit_shuffle_call_s args;
+            args.src = input + off;
+            args.dst = output + off + cb * SP * simd_w * sizeof(float);
+            args.offsets = offsets_ + cb * simd_w;
+            args.work_amount = nstl::min(sp_blk, SP - sp);
+            (*kernel_)(&args);
+        });
+    } else if (dat_tag == pd()->nspc_tag_) {
+        parallel_nd(MB, nb_sp, [&](dim_t mb, dim_t spb) {
+            const dim_t sp = spb * sp_blk;
+            const dim_t off = mb * stride_mb + sp * C * sizeof(float);
+            jit_shuffle_call_s args;
+            args.src = input + off;
+            args.dst = output + off;
+            args.offsets = offsets_;
+            args.work_amount = nstl::min(sp_blk, SP - sp);
+            (*kernel_)(&args);
+        });
+    } else {
+        parallel_nd(MB, C, [&](dim_t mb, dim_t c) {
+            const dim_t off = mb * stride_mb;
+            jit_shuffle_call_s args;
+            args.src = input + off + rev_transposed_[c] * SP * sizeof(float);
+            args.dst = output + off + c * SP * sizeof(float);
+            args.offsets = nullptr;
+            args.work_amount = SP / simd_w;
+            (*kernel_)(&args);
+        });
+    }
+
+    return status::success;
+}
+
+template struct jit_uni_shuffle_t<avx512_common>;
+
+#undef GET_OFF
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
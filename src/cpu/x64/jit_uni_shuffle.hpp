@@ -0,0 +1,123 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_UNI_SHUFFLE_HPP
+#define CPU_X64_JIT_UNI_SHUFFLE_HPP
+
+#include <assert.h>
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/nstl.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_shuffle_pd.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+struct jit_shuffle_conf_t {
+    // If false, the kernel copies contiguous vectors, otherwise it gathers
+    // the elements of a vector using a table of byte offsets
+    bool gather;
+    // The number of vectors computed for a point
+    int n_vecs;
+    // The number of elements in the last vector of a point for the gather
+    // kernel, or in the vector copied after all the points for the copy one
+    int tail;
+    // The distance between the points in bytes
+    dim_t stride;
+};
+
+template <cpu_isa_t isa>
+struct jit_uni_shuffle_kernel_t;
+
+template <cpu_isa_t isa>
+struct jit_uni_shuffle_t : public primitive_t {
+    struct pd_t : public cpu_shuffle_pd_t {
+        using cpu_shuffle_pd_t::cpu_shuffle_pd_t;
+
+        DECLARE_COMMON_PD_T(
+                JIT_IMPL_NAME_HELPER("jit:", isa, ""), jit_uni_shuffle_t);
+
+        status_t init(engine_t *engine) {
+            using namespace format_tag;
+
+            const data_type_t data_type = data_md()->data_type;
+            bool ok = mayiuse(isa) && axis() == 1
+                    && utils::one_of(ndims(), 3, 4, 5)
+                    && types::data_type_size(data_type) == sizeof(float)
+                    && attr()->has_default_values()
+                    && IMPLICATION(!is_fwd(), set_default_formats_common());
+            if (!ok) return status::unimplemented;
+
+            const int nd = ndims() - 3;
+            blk_tag_ = utils::pick(nd, nCw16c, nChw16c, nCdhw16c);
+            nspc_tag_ = utils::pick(nd, nwc, nhwc, ndhwc);
+            ncsp_tag_ = utils::pick(nd, ncw, nchw, ncdhw);
+            dat_tag_ = memory_desc_matches_one_of_tag(
+                    *data_md(), blk_tag_, nspc_tag_, ncsp_tag_);
+            if (dat_tag_ == format_tag::undef) return status::unimplemented;
+
+            // The gather offsets are 32-bit signed integers
+            const memory_desc_wrapper data_d(data_md());
+            const dim_t max_offset = data_d.padded_dims()[1] * D() * H() * W()
+                    * sizeof(float);
+            if (dat_tag_ == blk_tag_
+                    && max_offset > nstl::numeric_limits<int32_t>::max())
+                return status::unimplemented;
+
+            return status::success;
+        }
+
+        format_tag_t dat_tag_ = format_tag::undef;
+        format_tag_t blk_tag_ = format_tag::undef;
+        format_tag_t nspc_tag_ = format_tag::undef;
+        format_tag_t ncsp_tag_ = format_tag::undef;
+    };
+
+    jit_uni_shuffle_t(const pd_t *apd);
+    ~jit_uni_shuffle_t();
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    jit_shuffle_conf_t conf_;
+    // The input channel which the output one is taken from
+    int *rev_transposed_ = nullptr;
+    // The byte offsets of the input elements for the gather kernel
+    int *offsets_ = nullptr;
+    std::unique_ptr<jit_uni_shuffle_kernel_t<isa>> kernel_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
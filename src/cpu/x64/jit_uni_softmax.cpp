@@ -50,6 +50,7 @@ struct jit_softmax_base_t : public jit_generator {
     struct call_params_t {
         // keep all sizes at 8 bytes -- jit code expects this
         const void *src, *dst, *diff_dst; // src dubs as diff_src
+        const void *mask;
         size_t spat_offt_count;
     };
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_softmax_t)
@@ -80,6 +81,7 @@ struct jit_softmax_base_t : public jit_generator {
     Reg64 reg_spat_offt_count = r11;
     Reg64 reg_reverse_spat_offt = r12;
     Reg64 reg_tmp = r13;
+    Reg64 reg_mask = rdx;
 
     Opmask injector_mask = Opmask(1);
 
@@ -93,14 +95,30 @@ struct jit_softmax_base_t : public jit_generator {
     Vmm vmax = Vmm(isa == avx512_common ? 31 : 15);
     Vmm vsbr = vsum; // must be not equal to vmax
 
-    bool is_bf16_ = false;
     bool is_softmax_ = pd_->is_softmax();
     bool is_logsoftmax_ = pd_->is_logsoftmax();
 
-    size_t data_type_size_ = 0;
+    data_type_t src_dt_ = data_type::undef; // dubs as diff_src data type
+    data_type_t dst_dt_ = data_type::undef;
+    size_t src_dt_size_ = 0;
+    size_t dst_dt_size_ = 0;
+    float src_scale_ = 1.f;
+    float dst_scale_ = 1.f;
+    bool with_mask_ = false;
+    // An int8 destination cannot keep the exponents between the passes, so
+    // they are computed once again from the source
+    bool need_recompute_ = false;
     size_t simd_w_ = 0;
     size_t unroll_regs_ = 4;
 
+    // If the axis is not the innermost dimension of a plain layout, the
+    // vector lanes hold the consecutive inner elements and the reduction
+    // goes over the vectors of the axis, so no horizontal op is needed. The
+    // lane tail is the number of the inner elements left for the last
+    // vector, it is handled by a separate kernel.
+    bool axis_is_strided_ = false;
+    size_t lane_tail_ = 0;
+
     size_t axis_simd_full_;
     size_t axis_simd_tail_;
     size_t n_loops_;
@@ -108,18 +126,26 @@ struct jit_softmax_base_t : public jit_generator {
     size_t axis_stride_;
 
     void compute_predefined_variables() {
-        axis_simd_full_ = pd_->axis_size() / simd_w_;
-        axis_simd_tail_ = pd_->axis_size() % simd_w_;
+        if (axis_is_strided_) {
+            axis_simd_full_ = pd_->axis_size();
+            axis_simd_tail_ = 0;
+        } else {
+            axis_simd_full_ = pd_->axis_size() / simd_w_;
+            axis_simd_tail_ = pd_->axis_size() % simd_w_;
+        }
         n_loops_ = axis_simd_full_ / unroll_regs_;
         loop_tail_ = axis_simd_full_ - n_loops_ * unroll_regs_;
         axis_stride_ = compute_axis_stride();
     }
 
+    // The offsets are counted in elements, as the source and the
+    // destination may be of different data types
     size_t compute_axis_stride() {
         const auto &bd = data_d_.blocking_desc();
 
-        if (bd.inner_nblks) return data_type_size_ * bd.strides[pd_->axis()];
-        return is_bf16_ ? vlen / 2 : vlen;
+        if (bd.inner_nblks || axis_is_strided_)
+            return bd.strides[pd_->axis()];
+        return simd_w_;
     }
 
     void load_common_params() {
@@ -139,23 +165,33 @@ struct jit_softmax_base_t : public jit_generator {
             mov(reg_diff_src, ptr[reg_param + PARAM_OFF(src)]); // src is reused
             mov(reg_diff_dst, ptr[reg_param + PARAM_OFF(diff_dst)]);
         }
+        if (with_mask_) mov(reg_mask, ptr[reg_param + PARAM_OFF(mask)]);
 #undef PARAM_OFF
     }
 
     Address diff_src_ptr(size_t offt = 0) {
-        return vmmword[reg_diff_src + reg_spat_offt + offt];
+        return vmmword[reg_diff_src + reg_spat_offt * (int)src_dt_size_
+                + offt * src_dt_size_];
     }
 
     Address src_ptr(size_t offt = 0) {
-        return vmmword[reg_src + reg_spat_offt + offt];
+        return vmmword[reg_src + reg_spat_offt * (int)src_dt_size_
+                + offt * src_dt_size_];
     }
 
     Address dst_ptr(size_t offt = 0) {
-        return vmmword[reg_dst + reg_spat_offt + offt];
+        return vmmword[reg_dst + reg_spat_offt * (int)dst_dt_size_
+                + offt * dst_dt_size_];
     }
 
     Address diff_dst_ptr(size_t offt = 0) {
-        return vmmword[reg_diff_dst + reg_spat_offt + offt];
+        return vmmword[reg_diff_dst + reg_spat_offt * (int)dst_dt_size_
+                + offt * dst_dt_size_];
+    }
+
+    Address mask_ptr(size_t offt = 0) {
+        return vmmword[reg_mask + reg_spat_offt * (int)sizeof(float)
+                + offt * sizeof(float)];
     }
 
     enum class op_t : unsigned { max, sum };
@@ -170,6 +206,7 @@ struct jit_softmax_base_t : public jit_generator {
     template <typename body_t>
     void axis_loop(body_t body) {
         Label main_loop, tail_loop, tail_axis;
+        const bool tail = lane_tail_ > 0;
 
         // reverse_spat_offt to dispatch between labels
         mov(reg_reverse_spat_offt, reg_spat_offt_count);
@@ -180,7 +217,7 @@ struct jit_softmax_base_t : public jit_generator {
                 cmp(reg_reverse_spat_offt, unroll_regs_ * axis_stride_);
                 jl(tail_loop, T_NEAR);
 
-                body(unroll_regs_, false);
+                body(unroll_regs_, tail);
                 sub(reg_reverse_spat_offt, unroll_regs_ * axis_stride_);
                 add(reg_spat_offt, unroll_regs_ * axis_stride_);
                 jmp(main_loop);
@@ -190,7 +227,7 @@ struct jit_softmax_base_t : public jit_generator {
         L(tail_loop);
         {
             if (loop_tail_) {
-                body(loop_tail_, false);
+                body(loop_tail_, tail);
                 add(reg_spat_offt, loop_tail_ * axis_stride_);
             }
         }
@@ -240,7 +277,7 @@ struct jit_softmax_base_t : public jit_generator {
         initialization_hook();
         if (exp_injector_) exp_injector_->load_table_addr();
         if (log_injector_) log_injector_->load_table_addr();
-        if (axis_simd_tail_) prepare_tail_mask();
+        if (axis_simd_tail_ || lane_tail_) prepare_tail_mask();
         load_common_params();
         if (pd_->is_fwd())
             forward();
@@ -253,11 +290,25 @@ struct jit_softmax_base_t : public jit_generator {
         ker = reinterpret_cast<decltype(ker)>(const_cast<uint8_t *>(getCode()));
     }
 
-    jit_softmax_base_t(const softmax_pd_t *pd)
-        : pd_(pd), data_d_(pd_->dst_md()) {
-        is_bf16_ = data_d_.data_type() == data_type::bf16;
-        data_type_size_ = is_bf16_ ? sizeof(bfloat16_t) : sizeof(float);
+    jit_softmax_base_t(const softmax_pd_t *pd, bool lane_tail)
+        : pd_(pd), data_d_(pd_->is_fwd() ? pd_->src_md() : pd_->dst_md()) {
+        src_dt_ = pd_->is_fwd() ? pd_->src_md()->data_type
+                                : pd_->diff_src_md()->data_type;
+        dst_dt_ = pd_->dst_md()->data_type;
+        src_dt_size_ = types::data_type_size(src_dt_);
+        dst_dt_size_ = types::data_type_size(dst_dt_);
+        if (pd_->is_fwd()) {
+            src_scale_ = pd_->attr()->scales_.get(DNNL_ARG_SRC).scales_[0];
+            dst_scale_ = pd_->attr()->scales_.get(DNNL_ARG_DST).scales_[0];
+            with_mask_ = !types::is_zero_md(pd_->src_md(1));
+        }
+        need_recompute_
+                = utils::one_of(dst_dt_, data_type::s8, data_type::u8);
         simd_w_ = vlen / sizeof(float); // bf16 works on ymms
+
+        const auto inner_size = data_d_.blocking_desc().strides[pd_->axis()];
+        axis_is_strided_ = data_d_.is_plain() && inner_size != 1;
+        if (axis_is_strided_ && lane_tail) lane_tail_ = inner_size % simd_w_;
     }
 };
 
@@ -275,34 +326,71 @@ struct jit_softmax_t<avx512_common> : public jit_softmax_base_t<avx512_common> {
     Zmm bf16_emu_zmm_5 = Zmm(27);
     Reg64 bf16_emu_gpr = r15;
 
+    Vmm vsrc_scale = Vmm(16);
+    Vmm vdst_scale = Vmm(17);
+    Vmm vsaturation_lbound = Vmm(18);
+    Vmm vsaturation_ubound = Vmm(19);
+
     Opmask tail_opmask = Opmask(2);
 
-    void store(const Address &addr, const Vmm &vmm, bool tail = false) {
+    // Saturates and converts the vmm in place for an int8 data type
+    void store(const Address &addr, const Vmm &vmm, data_type_t dt,
+            bool tail = false) {
         auto effective_addr = addr;
         if (tail) effective_addr = addr | tail_opmask;
-        if (is_bf16_) {
-            if (bf16_emu_)
-                bf16_emu_->vcvtneps2bf16(bf16_cvt_ymm, vmm);
-            else
-                vcvtneps2bf16(bf16_cvt_ymm, vmm);
-            vmovdqu16(effective_addr, bf16_cvt_ymm);
-        } else
-            uni_vmovups(effective_addr, vmm);
+        switch (dt) {
+            case data_type::bf16:
+                if (bf16_emu_)
+                    bf16_emu_->vcvtneps2bf16(bf16_cvt_ymm, vmm);
+                else
+                    vcvtneps2bf16(bf16_cvt_ymm, vmm);
+                vmovdqu16(effective_addr, bf16_cvt_ymm);
+                break;
+            case data_type::s8:
+            case data_type::u8: {
+                // The down conversions can't take a mask with memory, so the
+                // bytes are converted in the register and stored with a mask
+                const Xmm xmm_i8(vmm.getIdx());
+                saturate_f32(vmm, vsaturation_lbound, vsaturation_ubound, dt);
+                vcvtps2dq(vmm, vmm);
+                if (dt == data_type::s8)
+                    vpmovsdb(xmm_i8, vmm);
+                else
+                    vpmovusdb(xmm_i8, vmm);
+                vmovdqu8(effective_addr, xmm_i8);
+                break;
+            }
+            default: uni_vmovups(effective_addr, vmm);
+        }
     };
 
-    void load(const Vmm &vmm, const Address &addr, bool tail = false) {
+    void load(const Vmm &vmm, const Address &addr, data_type_t dt,
+            bool tail = false) {
         auto effective_vmm = vmm;
         if (tail) effective_vmm = vmm | tail_opmask | T_z;
 
-        if (is_bf16_) {
+        if (dt == data_type::bf16) {
             vpmovzxwd(effective_vmm, addr);
             vpslld(effective_vmm, effective_vmm, 0x10);
         } else
             uni_vmovups(effective_vmm, addr);
     };
 
+    // Loads the source scaled and with the mask added
+    void load_src(const Vmm &vmm, size_t offt, bool tail = false) {
+        load(vmm, src_ptr(offt), src_dt_, tail);
+        if (src_scale_ != 1.f) uni_vmulps(vmm, vmm, vsrc_scale);
+        if (with_mask_) {
+            if (tail)
+                vaddps(vmm | tail_opmask | T_z, vmm, mask_ptr(offt));
+            else
+                vaddps(vmm, vmm, mask_ptr(offt));
+        }
+    }
+
     void prepare_tail_mask() override {
-        const int mask_f32 = (1 << axis_simd_tail_) - 1;
+        const int mask_f32
+                = (1 << (axis_is_strided_ ? lane_tail_ : axis_simd_tail_)) - 1;
         Reg32 regw_tmp = reg_tmp.cvt32();
         mov(regw_tmp, mask_f32);
         kmovw(tail_opmask, regw_tmp);
@@ -326,7 +414,7 @@ struct jit_softmax_t<avx512_common> : public jit_softmax_base_t<avx512_common> {
         axis_loop([&](int unroll, bool tail = false) {
             for (int i = 0; i < unroll; i++) {
                 Vmm vreg_tmp_src = Vmm(i + 1);
-                load(vreg_tmp_src, src_ptr(axis_stride_ * i), tail);
+                load_src(vreg_tmp_src, axis_stride_ * i, tail);
                 if (tail)
                     uni_vmaxps(vmax | tail_opmask, vmax, vreg_tmp_src);
                 else
@@ -334,7 +422,8 @@ struct jit_softmax_t<avx512_common> : public jit_softmax_base_t<avx512_common> {
             }
         });
 
-        get_horizontal_op(vmax, vtmp = vsum, op_t::max);
+        if (!axis_is_strided_)
+            get_horizontal_op(vmax, vtmp = vsum, op_t::max);
     }
 
     void accumulate_vsum() override {
@@ -343,22 +432,29 @@ struct jit_softmax_t<avx512_common> : public jit_softmax_base_t<avx512_common> {
         axis_loop([&](int unroll, bool tail = false) {
             for (int i = 0; i < unroll; i++) {
                 Vmm vreg_tmp_src = Vmm(i + 1);
-                load(vreg_tmp_src, src_ptr(axis_stride_ * i), tail);
+                load_src(vreg_tmp_src, axis_stride_ * i, tail);
                 uni_vsubps(vreg_tmp_src, vreg_tmp_src, vmax);
-                if (is_logsoftmax_) // store before applying exp
-                    store(dst_ptr(axis_stride_ * i), vreg_tmp_src, tail);
+                if (is_logsoftmax_ && !need_recompute_) // store before exp
+                    store(dst_ptr(axis_stride_ * i), vreg_tmp_src, dst_dt_,
+                            tail);
                 exp_injector_->compute_vector(vreg_tmp_src.getIdx());
                 if (tail)
                     uni_vaddps(vsum | tail_opmask, vsum, vreg_tmp_src);
                 else
                     uni_vaddps(vsum, vsum, vreg_tmp_src);
-                if (is_softmax_) // store after applying exp
-                    store(dst_ptr(axis_stride_ * i), vreg_tmp_src, tail);
+                if (is_softmax_ && !need_recompute_) // store after exp
+                    store(dst_ptr(axis_stride_ * i), vreg_tmp_src, dst_dt_,
+                            tail);
             }
         });
 
-        get_horizontal_op(vsum, vtmp = vmax, op_t::sum);
-        if (is_softmax_) uni_vdivps(vsum, vone, vsum, vtmp = vmax);
+        // vmax is kept for the recomputation of the exponents
+        if (!axis_is_strided_)
+            get_horizontal_op(vsum, vtmp = Vmm(1), op_t::sum);
+        if (is_softmax_) {
+            uni_vdivps(vsum, vone, vsum, vtmp = Vmm(1));
+            if (dst_scale_ != 1.f) uni_vmulps(vsum, vsum, vdst_scale);
+        }
         if (is_logsoftmax_) log_injector_->compute_vector(vsum.getIdx());
     }
 
@@ -366,15 +462,21 @@ struct jit_softmax_t<avx512_common> : public jit_softmax_base_t<avx512_common> {
         axis_loop([&](int unroll, bool tail = false) {
             for (int i = 0; i < unroll; i++) {
                 Vmm vreg_tmp_src = Vmm(i + 1);
-                if (is_softmax_) {
-                    load(vreg_tmp_src, dst_ptr(axis_stride_ * i), tail);
-                    uni_vmulps(vreg_tmp_src, vreg_tmp_src, vsum);
-                }
+                if (need_recompute_) {
+                    load_src(vreg_tmp_src, axis_stride_ * i, tail);
+                    uni_vsubps(vreg_tmp_src, vreg_tmp_src, vmax);
+                    if (is_softmax_)
+                        exp_injector_->compute_vector(vreg_tmp_src.getIdx());
+                } else
+                    load(vreg_tmp_src, dst_ptr(axis_stride_ * i), dst_dt_,
+                            tail);
+                if (is_softmax_) uni_vmulps(vreg_tmp_src, vreg_tmp_src, vsum);
                 if (is_logsoftmax_) {
-                    load(vreg_tmp_src, dst_ptr(axis_stride_ * i), tail);
                     uni_vsubps(vreg_tmp_src, vreg_tmp_src, vsum);
+                    if (dst_scale_ != 1.f)
+                        uni_vmulps(vreg_tmp_src, vreg_tmp_src, vdst_scale);
                 }
-                store(dst_ptr(axis_stride_ * i), vreg_tmp_src, tail);
+                store(dst_ptr(axis_stride_ * i), vreg_tmp_src, dst_dt_, tail);
             }
         });
     }
@@ -386,9 +488,11 @@ struct jit_softmax_t<avx512_common> : public jit_softmax_base_t<avx512_common> {
             for (int i = 0; i < unroll; i++) {
                 Vmm vreg_tmp_dst = Vmm(i * 2 + 1);
                 Vmm vreg_tmp_diff_dst = Vmm(i * 2 + 2);
-                load(vreg_tmp_diff_dst, diff_dst_ptr(axis_stride_ * i), tail);
+                load(vreg_tmp_diff_dst, diff_dst_ptr(axis_stride_ * i),
+                        dst_dt_, tail);
                 if (is_softmax_) {
-                    load(vreg_tmp_dst, dst_ptr(axis_stride_ * i), tail);
+                    load(vreg_tmp_dst, dst_ptr(axis_stride_ * i), dst_dt_,
+                            tail);
                     uni_vmulps(
                             vreg_tmp_diff_dst, vreg_tmp_diff_dst, vreg_tmp_dst);
                 }
@@ -396,7 +500,8 @@ struct jit_softmax_t<avx512_common> : public jit_softmax_base_t<avx512_common> {
             }
         });
 
-        get_horizontal_op(vsbr, vtmp = vmax, op_t::sum);
+        if (!axis_is_strided_)
+            get_horizontal_op(vsbr, vtmp = vmax, op_t::sum);
     }
 
     void compute_diff_src() override {
@@ -404,8 +509,9 @@ struct jit_softmax_t<avx512_common> : public jit_softmax_base_t<avx512_common> {
             for (int i = 0; i < unroll; i++) {
                 Vmm vreg_tmp_dst = Vmm(i * 2 + 1);
                 Vmm vreg_tmp_diff_dst = Vmm(i * 2 + 2);
-                load(vreg_tmp_dst, dst_ptr(axis_stride_ * i), tail);
-                load(vreg_tmp_diff_dst, diff_dst_ptr(axis_stride_ * i), tail);
+                load(vreg_tmp_dst, dst_ptr(axis_stride_ * i), dst_dt_, tail);
+                load(vreg_tmp_diff_dst, diff_dst_ptr(axis_stride_ * i),
+                        dst_dt_, tail);
                 if (is_softmax_) {
                     vsubps(vreg_tmp_diff_dst, vreg_tmp_diff_dst, vsbr);
                     vmulps(vreg_tmp_diff_dst, vreg_tmp_dst, vreg_tmp_diff_dst);
@@ -414,17 +520,29 @@ struct jit_softmax_t<avx512_common> : public jit_softmax_base_t<avx512_common> {
                     exp_injector_->compute_vector(vreg_tmp_dst.getIdx());
                     uni_vfnmadd231ps(vreg_tmp_diff_dst, vreg_tmp_dst, vsbr);
                 }
-                store(diff_src_ptr(axis_stride_ * i), vreg_tmp_diff_dst, tail);
+                store(diff_src_ptr(axis_stride_ * i), vreg_tmp_diff_dst,
+                        src_dt_, tail);
             }
         });
     }
 
+    void broadcast_float(const Vmm &vmm, float f) {
+        mov(reg_tmp, float2int(f));
+        uni_vmovq(Xmm(vmm.getIdx()), reg_tmp);
+        uni_vbroadcastss(vmm, Xmm(vmm.getIdx()));
+    }
+
     void initialization_hook() override {
         if (bf16_emu_) bf16_emu_->init_vcvtneps2bf16();
+        if (src_scale_ != 1.f) broadcast_float(vsrc_scale, src_scale_);
+        if (dst_scale_ != 1.f) broadcast_float(vdst_scale, dst_scale_);
+        init_saturate_f32(vsaturation_lbound, vsaturation_ubound, reg_tmp,
+                data_type::f32, dst_dt_);
     }
 
-    jit_softmax_t(const softmax_pd_t *pd) : jit_softmax_base_t(pd) {
-        if (is_bf16_ && !mayiuse(avx512_core_bf16))
+    jit_softmax_t(const softmax_pd_t *pd, bool lane_tail = false)
+        : jit_softmax_base_t(pd, lane_tail) {
+        if (dst_dt_ == data_type::bf16 && !mayiuse(avx512_core_bf16))
             bf16_emu_.reset(new bf16_emulation_t(this, bf16_emu_zmm_1,
                     bf16_emu_zmm_2, bf16_emu_zmm_3, bf16_emu_gpr,
                     bf16_emu_zmm_4, bf16_emu_zmm_5));
@@ -540,7 +658,8 @@ struct jit_softmax_t<avx2> : public jit_softmax_base_t<avx2> {
         });
     }
 
-    jit_softmax_t(const softmax_pd_t *pd) : jit_softmax_base_t(pd) {
+    jit_softmax_t(const softmax_pd_t *pd, bool lane_tail = false)
+        : jit_softmax_base_t(pd, lane_tail) {
         get_code();
     }
 };
@@ -581,9 +700,7 @@ struct jit_softmax_t<sse41> : public jit_softmax_base_t<sse41> {
 
                     for (size_t j = 0; j < axis_simd_tail_; j++) {
                         uni_vmovups(vreg_tmp_src, vneg_flt_max);
-                        uni_vmovss(vtmp,
-                                src_ptr(axis_stride_ * i
-                                        + data_type_size_ * j));
+                        uni_vmovss(vtmp, src_ptr(axis_stride_ * i + j));
                         uni_vblendvps(
                                 vreg_tmp_src, vreg_tmp_src, vtmp, tail_vmask);
                         uni_vmaxps(vmax, vmax, vreg_tmp_src);
@@ -613,21 +730,17 @@ struct jit_softmax_t<sse41> : public jit_softmax_base_t<sse41> {
                 } else {
                     vtmp = Vmm(vreg_tmp_src.getIdx() + 1);
                     for (size_t j = 0; j < axis_simd_tail_; j++) {
-                        uni_vmovss(vreg_tmp_src,
-                                src_ptr(axis_stride_ * i
-                                        + data_type_size_ * j));
+                        uni_vmovss(vreg_tmp_src, src_ptr(axis_stride_ * i + j));
                         uni_vsubps(vreg_tmp_src, vreg_tmp_src, vmax);
                         if (is_logsoftmax_) // store before applying exp
-                            uni_vmovss(dst_ptr(axis_stride_ * i
-                                               + data_type_size_ * j),
+                            uni_vmovss(dst_ptr(axis_stride_ * i + j),
                                     vreg_tmp_src);
                         exp_injector_->compute_vector(vreg_tmp_src.getIdx());
                         uni_vpxor(vtmp, vtmp, vtmp);
                         uni_vblendvps(vtmp, vtmp, vreg_tmp_src, tail_vmask);
                         uni_vaddps(vsum, vsum, vtmp);
                         if (is_softmax_) // store after applying exp
-                            uni_vmovss(dst_ptr(axis_stride_ * i
-                                               + data_type_size_ * j),
+                            uni_vmovss(dst_ptr(axis_stride_ * i + j),
                                     vreg_tmp_src);
                     }
                 }
@@ -652,23 +765,20 @@ struct jit_softmax_t<sse41> : public jit_softmax_base_t<sse41> {
                     uni_vmovups(dst_ptr(axis_stride_ * i), vreg_tmp_src);
                 } else {
                     for (size_t j = 0; j < axis_simd_tail_; j++) {
-                        uni_vmovss(vreg_tmp_src,
-                                dst_ptr(axis_stride_ * i
-                                        + data_type_size_ * j));
+                        uni_vmovss(vreg_tmp_src, dst_ptr(axis_stride_ * i + j));
                         if (is_softmax_)
                             uni_vmulps(vreg_tmp_src, vreg_tmp_src, vsum);
                         if (is_logsoftmax_)
                             uni_vsubps(vreg_tmp_src, vreg_tmp_src, vsum);
-                        uni_vmovss(
-                                dst_ptr(axis_stride_ * i + data_type_size_ * j),
-                                vreg_tmp_src);
+                        uni_vmovss(dst_ptr(axis_stride_ * i + j), vreg_tmp_src);
                     }
                 }
             }
         });
     }
 
-    jit_softmax_t(const softmax_pd_t *pd) : jit_softmax_base_t(pd) {
+    jit_softmax_t(const softmax_pd_t *pd, bool lane_tail = false)
+        : jit_softmax_base_t(pd, lane_tail) {
         get_code();
     }
 };
@@ -688,14 +798,15 @@ jit_uni_softmax_fwd_t<isa>::~jit_uni_softmax_fwd_t() {
 template <cpu_isa_t isa>
 status_t jit_uni_softmax_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
     auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto mask = CTX_IN_MEM(const float *, DNNL_ARG_SRC_1);
     auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
 
     const memory_desc_wrapper data_d(pd()->src_md());
-    const auto data_type_size = data_d.data_type() == data_type::bf16
-            ? sizeof(bfloat16_t)
-            : sizeof(float);
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper mask_d(pd()->src_md(1));
     const auto &bd = data_d.blocking_desc();
     const auto axis = pd()->axis();
+    const int ndims = pd()->ndims();
 
     const auto inner_stride
             = bd.inner_nblks ? bd.inner_blks[bd.inner_nblks - 1] : (dim_t)1;
@@ -703,11 +814,31 @@ status_t jit_uni_softmax_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
     const auto outer_stride = data_d.padded_dims()[axis] * inner_size;
     const auto outer_size = data_d.nelems(true) / outer_stride;
 
-    parallel_nd(outer_size, inner_size, [&](dim_t ou, dim_t in) {
-        dim_t offset = (ou * outer_stride + in * inner_stride) * data_type_size;
-        const char *src_ptr = src + offset;
-        char *dst_ptr = dst + offset;
-        softmax_driver_->exec(src_ptr, dst_ptr, outer_stride);
+    // The mask is supported for plain layouts only, so the logical position
+    // of a row follows from the strides of the source. The mask is broadcast
+    // along the dimensions of size 1.
+    auto mask_offset = [&](dim_t offset) {
+        dim_t off = 0;
+        for (int d = 0; d < ndims; ++d) {
+            if (d == axis || mask_d.dims()[d] == 1) continue;
+            const dim_t pos = (offset / bd.strides[d]) % data_d.dims()[d];
+            off += pos * mask_d.blocking_desc().strides[d];
+        }
+        return off;
+    };
+
+    // A call computes a vector of the inner elements if the axis is strided
+    const dim_t inner_blk = softmax_driver_->inner_blk();
+    const dim_t inner_nblks = utils::div_up(inner_size, inner_blk);
+
+    parallel_nd(outer_size, inner_nblks, [&](dim_t ou, dim_t in) {
+        dim_t offset = ou * outer_stride + in * inner_blk * inner_stride;
+        const char *src_ptr = src + offset * data_d.data_type_size();
+        char *dst_ptr = dst + offset * dst_d.data_type_size();
+        const float *mask_ptr = mask ? mask + mask_offset(offset) : nullptr;
+        const bool lane_tail = (in + 1) * inner_blk > inner_size;
+        softmax_driver_->exec(
+                src_ptr, dst_ptr, mask_ptr, outer_stride, lane_tail);
     });
 
     return status::success;
@@ -742,13 +873,19 @@ status_t jit_uni_softmax_bwd_t<isa>::execute(const exec_ctx_t &ctx) const {
     const auto outer_stride = data_d.padded_dims()[axis] * inner_size;
     const auto outer_size = data_d.nelems(true) / outer_stride;
 
-    parallel_nd(outer_size, inner_size, [&](dim_t ou, dim_t in) {
-        dim_t offset = (ou * outer_stride + in * inner_stride) * data_type_size;
+    // A call computes a vector of the inner elements if the axis is strided
+    const dim_t inner_blk = softmax_driver_->inner_blk();
+    const dim_t inner_nblks = utils::div_up(inner_size, inner_blk);
+
+    parallel_nd(outer_size, inner_nblks, [&](dim_t ou, dim_t in) {
+        dim_t offset = (ou * outer_stride + in * inner_blk * inner_stride)
+                * data_type_size;
         char *diff_src_ptr = diff_src + offset;
         const char *dst_ptr = dst + offset;
         const char *diff_dst_ptr = diff_dst + offset;
-        softmax_driver_->exec(
-                diff_src_ptr, dst_ptr, diff_dst_ptr, outer_stride);
+        const bool lane_tail = (in + 1) * inner_blk > inner_size;
+        softmax_driver_->exec(diff_src_ptr, dst_ptr, diff_dst_ptr,
+                outer_stride, lane_tail);
     });
 
     return status::success;
@@ -759,29 +896,47 @@ namespace softmax_impl {
 template <cpu_isa_t isa>
 struct driver_t : public c_compatible {
 
-    driver_t(const softmax_pd_t *pd) : pd_(pd), ker_(pd_) {}
+    driver_t(const softmax_pd_t *pd) : pd_(pd), ker_(pd_) {
+        if (ker_.axis_is_strided_) {
+            const auto &bd = ker_.data_d_.blocking_desc();
+            if (bd.strides[pd_->axis()] % inner_blk())
+                ker_tail_.reset(new jit_softmax_t<isa>(pd_, true));
+        }
+    }
+
+    // Returns the number of the inner elements computed by a kernel call
+    dim_t inner_blk() const {
+        return ker_.axis_is_strided_ ? (dim_t)ker_.simd_w_ : 1;
+    }
 
-    void exec(const void *src, void *dst, const dim_t outer_stride) {
+    void exec(const void *src, void *dst, const void *mask,
+            const dim_t outer_stride, bool lane_tail = false) {
         typename jit_softmax_t<isa>::call_params_t p;
-        p.spat_offt_count = outer_stride * ker_.data_type_size_;
+        p.spat_offt_count = outer_stride;
         p.src = src;
         p.dst = dst;
-        ker_(&p);
+        p.mask = mask;
+        ker(lane_tail)(&p);
     }
 
     void exec(void *diff_src, const void *dst, const void *diff_dst,
-            const dim_t outer_stride) {
+            const dim_t outer_stride, bool lane_tail = false) {
         typename jit_softmax_t<isa>::call_params_t p;
-        p.spat_offt_count = outer_stride * ker_.data_type_size_;
+        p.spat_offt_count = outer_stride;
         p.src = diff_src;
         p.dst = dst;
         p.diff_dst = diff_dst;
-        ker_(&p);
+        ker(lane_tail)(&p);
     }
 
 private:
     const softmax_pd_t *pd_;
     jit_softmax_t<isa> ker_;
+    std::unique_ptr<jit_softmax_t<isa>> ker_tail_;
+
+    jit_softmax_t<isa> &ker(bool lane_tail) {
+        return lane_tail && ker_tail_ ? *ker_tail_ : ker_;
+    }
 };
 
 } // namespace softmax_impl
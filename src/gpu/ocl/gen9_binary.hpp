@@ -62,7 +62,9 @@ struct gen9_binary_t : public gpu_primitive_t {
                             utils::one_of(src_md(0)->data_type, s8, u8)
                                     && utils::one_of(
                                             attr()->output_scales_.mask_, 0,
-                                            1 << 1))
+                                            1 << 1)
+                                    && attr()->scales_.get(DNNL_ARG_DST)
+                                               .has_default_values())
                     && attr()->has_default_values(attr_skip_mask)
                     && compute_engine->mayiuse(
                             compute::device_ext_t::intel_subgroups)
@@ -55,7 +55,9 @@ struct ref_binary_t : public gpu_primitive_t {
                             utils::one_of(src_md(0)->data_type, s8, u8)
                                     && utils::one_of(
                                             attr()->output_scales_.mask_, 0,
-                                            1 << 1))
+                                            1 << 1)
+                                    && attr()->scales_.get(DNNL_ARG_DST)
+                                               .has_default_values())
                     && attr()->has_default_values(attr_skip_mask)
                     && attr_post_ops_ok();
 
@@ -55,7 +55,9 @@ struct ref_softmax_fwd_t : public gpu_primitive_t {
                             desc()->data_desc.data_type == data_type::f16,
                             compute_engine->mayiuse(
                                     compute::device_ext_t::khr_fp16))
-                    && attr()->has_default_values();
+                    && memory_desc_wrapper(src_md())
+                            == memory_desc_wrapper(dst_md())
+                    && !with_mask() && attr()->has_default_values();
             if (!ok) return status::unimplemented;
 
             gws[0] = 1;
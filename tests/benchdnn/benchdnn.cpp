@@ -37,6 +37,7 @@
 #include "lnorm/lnorm.hpp"
 #include "lrn/lrn.hpp"
 #include "matmul/matmul.hpp"
+#include "model/model.hpp"
 #include "pool/pool.hpp"
 #include "reorder/reorder.hpp"
 #include "resampling/resampling.hpp"
@@ -57,6 +58,10 @@ const char *driver_name = "";
 double max_ms_per_prb {3e3};
 int min_times_per_prb {5};
 int fix_times_per_prb {0};
+cold_cache_mode_t cold_cache_mode {COLD_CACHE_NONE};
+int instances {1};
+int threads_per_instance {0};
+std::vector<int> thread_sweep;
 
 bool fast_ref_gpu {true};
 
@@ -112,6 +117,8 @@ int main(int argc, char **argv) {
         matmul::bench(--argc, ++argv);
     } else if (!strcmp("--resampling", argv[0])) {
         resampling::bench(--argc, ++argv);
+    } else if (!strcmp("--model", argv[0])) {
+        model::bench(--argc, ++argv);
     } else {
         fprintf(stderr, "err: unknown driver\n");
     }
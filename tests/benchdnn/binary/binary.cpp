@@ -222,7 +222,7 @@ int doit(const prb_t *p, res_t *r) {
         SAFE(compare(p, dst_fp, dst, r), WARN);
     }
 
-    measure_perf(r->timer, b, args);
+    measure_perf(r, b, args);
 
     DNN_SAFE_V(dnnl_primitive_destroy(b));
 
@@ -18,6 +18,7 @@
 #include <limits.h>
 #include <stdint.h>
 
+#include <algorithm>
 #include <fstream>
 #include <functional>
 #include <string>
@@ -68,6 +69,23 @@ bench_mode_t str2bench_mode(const char *str) {
     return mode;
 }
 
+const char *cold_cache_mode2str(cold_cache_mode_t mode) {
+    const char *modes[] = {"none", "flush", "rotate"};
+    assert((int)mode < sizeof(modes) / sizeof(*modes));
+    return modes[(int)mode];
+}
+
+cold_cache_mode_t str2cold_cache_mode(const char *str) {
+    if (!strcmp("none", str)) return COLD_CACHE_NONE;
+    if (!strcmp("flush", str)) return COLD_CACHE_FLUSH;
+    if (!strcmp("rotate", str)) return COLD_CACHE_ROTATE;
+    []() {
+        SAFE(FAIL, CRIT);
+        return 0;
+    }();
+    return COLD_CACHE_NONE;
+}
+
 /* perf */
 #include <chrono>
 
@@ -100,6 +118,10 @@ void benchdnn_timer_t::reset() {
     for (int i = 0; i < n_modes; ++i)
         ms_[i] = 0;
     ms_start_ = 0;
+    samples_ms_.clear();
+    sorted_ms_.clear();
+    n_samples_ = 0;
+    seed_ = 1;
 
     start();
 }
@@ -115,9 +137,6 @@ void benchdnn_timer_t::stop(int add_times) {
     unsigned long long d_ticks = ticks_now() - ticks_start_;
     double d_ms = ms_now() - ms_start_;
 
-    ticks_start_ += d_ticks;
-    ms_start_ += d_ms;
-
     ms_[benchdnn_timer_t::avg] += d_ms;
     ticks_[benchdnn_timer_t::avg] += d_ticks;
 
@@ -135,6 +154,71 @@ void benchdnn_timer_t::stop(int add_times) {
             = times_ ? MAX2(ticks_[benchdnn_timer_t::max], d_ticks) : d_ticks;
 
     times_ += add_times;
+
+    if (samples_ms_.size() < max_samples) {
+        samples_ms_.push_back(d_ms);
+    } else {
+        // a cheap LCG is enough to pick the sample to replace
+        seed_ = seed_ * 6364136223846793005ULL + 1442695040888963407ULL;
+        const size_t idx = (size_t)((seed_ >> 16) % (n_samples_ + 1));
+        if (idx < max_samples) samples_ms_[idx] = d_ms;
+    }
+    n_samples_++;
+    sorted_ms_.clear();
+
+    // the clock restarts after the bookkeeping above, so the time spent on
+    // it (e.g. reallocation of the samples) is not charged to the next stamp
+    start();
+}
+
+double benchdnn_timer_t::percentile(double p) const {
+    if (samples_ms_.empty()) return 0; // nothing to report
+    // the samples are sorted once for all percentiles requested until the
+    // next stop()
+    if (sorted_ms_.empty()) {
+        sorted_ms_ = samples_ms_;
+        std::sort(sorted_ms_.begin(), sorted_ms_.end());
+    }
+    // nearest-rank definition, p100 is the maximum
+    const size_t n = sorted_ms_.size();
+    const size_t rank = (size_t)ceil(p / 100. * n);
+    return sorted_ms_[MIN2(MAX2(rank, (size_t)1), n) - 1];
+}
+
+double benchdnn_timer_t::stddev() const {
+    const size_t n = samples_ms_.size();
+    if (n < 2) return 0;
+    double mean = 0;
+    for (double v : samples_ms_)
+        mean += v;
+    mean /= n;
+    double var = 0;
+    for (double v : samples_ms_)
+        var += (v - mean) * (v - mean);
+    return sqrt(var / (n - 1));
+}
+
+int benchdnn_timer_t::outliers() const {
+    // Tukey's far-out fence, only the slow side is of interest: preemption,
+    // interrupts and thread wake-ups only add time.
+    const double q1 = percentile(25), q3 = percentile(75);
+    const double fence = q3 + 3 * (q3 - q1);
+    int n = 0;
+    for (double v : samples_ms_)
+        n += v > fence;
+    return n;
+}
+
+std::vector<int> benchdnn_timer_t::histogram(int nbins) const {
+    std::vector<int> bins(nbins, 0);
+    if (samples_ms_.empty() || nbins <= 0) return bins;
+    const auto mm = std::minmax_element(samples_ms_.begin(), samples_ms_.end());
+    const double lo = *mm.first, width = (*mm.second - lo) / nbins;
+    for (double v : samples_ms_) {
+        const int b = width > 0 ? (int)((v - lo) / width) : 0;
+        bins[MIN2(b, nbins - 1)]++;
+    }
+    return bins;
 }
 
 benchdnn_timer_t &benchdnn_timer_t::operator=(const benchdnn_timer_t &rhs) {
@@ -146,6 +230,10 @@ benchdnn_timer_t &benchdnn_timer_t::operator=(const benchdnn_timer_t &rhs) {
     for (int i = 0; i < n_modes; ++i)
         ms_[i] = rhs.ms_[i];
     ms_start_ = rhs.ms_start_;
+    samples_ms_ = rhs.samples_ms_;
+    sorted_ms_ = rhs.sorted_ms_;
+    n_samples_ = rhs.n_samples_;
+    seed_ = rhs.seed_;
     return *this;
 }
 
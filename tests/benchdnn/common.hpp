@@ -133,6 +133,19 @@ extern double max_ms_per_prb; /** maximum time spends per prb in ms */
 extern int min_times_per_prb; /** minimal amount of runs per prb */
 extern int fix_times_per_prb; /** if non-zero run prb that many times */
 
+enum cold_cache_mode_t {
+    COLD_CACHE_NONE = 0, /** measure with warm caches only */
+    COLD_CACHE_FLUSH, /** evict the caches before every iteration */
+    COLD_CACHE_ROTATE, /** run each iteration on a distinct set of buffers */
+};
+const char *cold_cache_mode2str(cold_cache_mode_t mode);
+cold_cache_mode_t str2cold_cache_mode(const char *str);
+extern cold_cache_mode_t cold_cache_mode; /** additional cold-cache run */
+
+extern int instances; /** concurrent instances in the multi-instance mode */
+extern int threads_per_instance; /** if zero, threads are split evenly */
+extern std::vector<int> thread_sweep; /** thread counts, 0 stands for auto */
+
 extern bool fast_ref_gpu;
 
 struct benchdnn_timer_t {
@@ -163,11 +176,26 @@ struct benchdnn_timer_t {
         return ticks_[mode] / (mode == avg ? times() : 1);
     }
 
+    // Distribution of the measured time. Every stop() adds one sample, so
+    // iterations measured in a batch contribute their average only.
+    double percentile(double p) const; /** p is in [0, 100] */
+    double stddev() const;
+    int outliers() const; /** samples beyond `q3 + 3 * (q3 - q1)` */
+    std::vector<int> histogram(int nbins) const; /** bins over [min, max] */
+
     benchdnn_timer_t &operator=(const benchdnn_timer_t &rhs);
 
     int times_;
     unsigned long long ticks_[n_modes], ticks_start_;
     double ms_[n_modes], ms_start_;
+
+    // After max_samples the samples are kept with reservoir sampling, which
+    // bounds every timer to 128 KB while keeping p99 well resolved
+    static constexpr size_t max_samples = 1 << 14;
+    std::vector<double> samples_ms_;
+    mutable std::vector<double> sorted_ms_; // cache of percentile()
+    size_t n_samples_;
+    uint64_t seed_; // state of the reservoir LCG, per timer for thread safety
 };
 
 /* global stats */
@@ -209,6 +237,12 @@ struct res_t {
     res_state_t state;
     size_t errors, total;
     benchdnn_timer_t timer;
+    benchdnn_timer_t cold_timer; /** filled when cold_cache_mode is set */
+    int64_t instances_times; /** executions of all concurrent instances */
+    double instances_ms; /** wall time of the concurrent instances */
+    int sweep_best_nthr; /** the fastest thread count of the sweep */
+    double sweep_speedup; /** at the largest thread count of the sweep */
+    double sweep_eff; /** parallel efficiency in %, the same */
     std::string impl_name;
     skip_reason_t reason;
 };
@@ -230,6 +264,7 @@ bool match_regex(const char *str, const char *pattern);
 bool maybe_skip(const std::string &impl_str);
 
 typedef int (*bench_f)(int argc, char **argv);
+std::string locate_batch_file(const std::string &fname);
 int batch(const char *fname, bench_f bench);
 
 /* returns 1 with given probability */
@@ -217,7 +217,7 @@ int doit(const prb_t *p, res_t *r) {
         SAFE(compare(p, dst_data_type, dst_fp, dst, r), WARN);
     }
 
-    measure_perf(r->timer, c, args);
+    measure_perf(r, c, args);
 
     DNN_SAFE_V(dnnl_primitive_destroy(c));
 
@@ -15,8 +15,23 @@
 *******************************************************************************/
 
 #include <assert.h>
+#if defined(__linux__)
+#include <sched.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
 #include "dnnl.h"
 
+#include "tests/test_thread.hpp"
+
 #include "dnnl_common.hpp"
 #include "dnnl_memory.hpp"
 
@@ -92,7 +107,7 @@ int execute_and_wait(dnnl_primitive_t prim, const args_t &args) {
     return OK;
 }
 
-inline bool should_stop(const benchdnn_timer_t &t) {
+bool should_stop(const benchdnn_timer_t &t) {
     const bool stop = false
             || (fix_times_per_prb && t.times() >= fix_times_per_prb)
             || (!fix_times_per_prb && t.total_ms() >= max_ms_per_prb
@@ -155,7 +170,468 @@ inline int measure_perf_aggregate(benchdnn_timer_t &t, dnnl_stream_t stream,
     return OK;
 }
 
-int measure_perf(benchdnn_timer_t &t, dnnl_primitive_t prim, args_t &args) {
+// Returns the size of the last level cache in bytes
+static size_t get_llc_size() {
+    long llc_size = 0;
+#if defined(__linux__) && defined(_SC_LEVEL3_CACHE_SIZE)
+    llc_size = MAX2(sysconf(_SC_LEVEL3_CACHE_SIZE),
+            sysconf(_SC_LEVEL2_CACHE_SIZE));
+#endif
+    // Fall back to a value exceeding the last level cache of most CPUs
+    if (llc_size <= 0) llc_size = 64 * 1024 * 1024;
+    return (size_t)llc_size;
+}
+
+// Working set size which is guaranteed to not fit the caches
+static size_t get_cold_cache_working_set_size() {
+    return 2 * get_llc_size();
+}
+
+// Evicts the data from all cache levels by touching a buffer which exceeds
+// the last level cache. Every thread touches its own part of the buffer, as
+// the data of a multi-threaded primitive is also kept in the private caches
+// of the cores it ran on.
+struct cache_flusher_t {
+    cache_flusher_t() : size_(get_cold_cache_working_set_size()) {
+        buf_ = (char *)zmalloc(size_, 64);
+        if (buf_) memset(buf_, 0, size_);
+    }
+    ~cache_flusher_t() { zfree(buf_); }
+
+    void flush() const {
+        if (!buf_) return;
+        const size_t line_size = 64;
+        const size_t nlines = size_ / line_size;
+        char *buf = buf_;
+        dnnl::impl::parallel(0, [&](int ithr, int nthr) {
+            size_t start {0}, end {0};
+            dnnl::impl::balance211(nlines, nthr, ithr, start, end);
+            for (size_t l = start; l < end; ++l)
+                buf[l * line_size]++;
+        });
+    }
+
+private:
+    size_t size_;
+    char *buf_;
+};
+
+// Creates unmapped copies of the execution arguments and fills `dnnl_args`
+// with them. The original arguments are expected to be mapped.
+static int copy_args(const args_t &args,
+        std::vector<std::unique_ptr<dnn_mem_t>> &mem_copies,
+        std::vector<dnnl_exec_arg_t> &dnnl_args) {
+    dnnl_args.resize(args.size());
+    for (int i = 0; i < args.size(); ++i) {
+        const dnn_mem_t &mem = args.dnn_mem(i);
+        dnnl_args[i].arg = args.arg(i);
+        dnnl_args[i].memory = mem.m_;
+        if (mem.size() == 0) continue;
+
+        // An in-place argument must stay shared in the copy
+        int j = 0;
+        for (; j < i; ++j)
+            if (&args.dnn_mem(j) == &mem) break;
+        if (j < i) {
+            dnnl_args[i].memory = dnnl_args[j].memory;
+            continue;
+        }
+
+        mem_copies.emplace_back(new dnn_mem_t(mem.md_, get_test_engine()));
+        dnn_mem_t &copy = *mem_copies.back();
+        SAFE(copy.reorder(mem), WARN);
+        copy.unmap();
+        dnnl_args[i].memory = copy.m_;
+    }
+    return OK;
+}
+
+// Creates copies of the execution arguments, so that the total size of all
+// the sets exceeds the last level cache and an execution never finds its
+// data in the caches if the sets are used in a round-robin manner. The first
+// set is the original arguments.
+static int prepare_rotated_args(const args_t &args,
+        std::vector<std::unique_ptr<dnn_mem_t>> &mem_copies,
+        std::vector<std::vector<dnnl_exec_arg_t>> &dnnl_args_sets) {
+    // The limit keeps the number of memory objects reasonable for tiny
+    // problems which cannot exceed the cache this way; use `flush` for them
+    const size_t max_sets = 256;
+
+    size_t args_size = 0;
+    for (int i = 0; i < args.size(); ++i)
+        args_size += args.dnn_mem(i).size();
+    const size_t working_set_size = get_cold_cache_working_set_size();
+    const size_t n_sets = MIN2(max_sets,
+            MAX2((size_t)2, working_set_size / MAX2((size_t)1, args_size) + 1));
+
+    std::vector<dnnl_exec_arg_t> dnnl_args(args.size());
+    for (int i = 0; i < args.size(); ++i) {
+        dnnl_args[i].arg = args.arg(i);
+        dnnl_args[i].memory = args.dnn_mem(i).m_;
+    }
+    dnnl_args_sets.push_back(dnnl_args);
+
+    for (size_t s = 1; s < n_sets; ++s) {
+        SAFE(copy_args(args, mem_copies, dnnl_args), WARN);
+        dnnl_args_sets.push_back(dnnl_args);
+    }
+
+    return OK;
+}
+
+// Measures the primitive with data that is not in the caches. The time spent
+// on flushing the caches counts toward the stop criteria, hence the separate
+// wall-clock timer.
+static int measure_perf_cold(benchdnn_timer_t &t, dnnl_stream_t stream,
+        dnnl_primitive_t prim, const args_t &args, cold_cache_mode_t mode) {
+    std::unique_ptr<cache_flusher_t> flusher;
+    std::vector<std::unique_ptr<dnn_mem_t>> mem_copies;
+    std::vector<std::vector<dnnl_exec_arg_t>> dnnl_args_sets;
+
+    if (mode == COLD_CACHE_FLUSH) flusher.reset(new cache_flusher_t());
+    if (mode == COLD_CACHE_ROTATE)
+        SAFE(prepare_rotated_args(args, mem_copies, dnnl_args_sets), WARN);
+
+    // The copies are unmapped already, the original arguments are unmapped
+    // here
+    std::vector<dnnl_exec_arg_t> dnnl_args;
+    execute_unmap_args(args, dnnl_args);
+    if (dnnl_args_sets.empty()) dnnl_args_sets.push_back(dnnl_args);
+
+    benchdnn_timer_t wall;
+    t.reset();
+    for (size_t iter = 0;; ++iter) {
+        auto &set = dnnl_args_sets[iter % dnnl_args_sets.size()];
+        if (flusher) flusher->flush();
+
+        t.start();
+        DNN_SAFE(dnnl_primitive_execute(
+                         prim, stream, (int)set.size(), set.data()),
+                WARN);
+        DNN_SAFE(dnnl_stream_wait(stream), WARN);
+        t.stamp();
+
+        wall.stamp();
+        if (should_stop(wall)) break;
+    }
+
+    execute_map_args(args);
+    return OK;
+}
+
+namespace {
+struct prim_factory_entry_t {
+    dnnl_primitive_t prim;
+    prim_factory_t factory;
+};
+
+// Only the most recently created primitives are kept, as a driver measures
+// the last or one of the last primitives it creates
+std::vector<prim_factory_entry_t> &prim_factories() {
+    static std::vector<prim_factory_entry_t> factories;
+    return factories;
+}
+} // namespace
+
+void register_prim_factory(
+        dnnl_primitive_t prim, const prim_factory_t &factory) {
+    const size_t max_entries = 4;
+    auto &factories = prim_factories();
+    // A handle of a destroyed primitive may be reused for a new one
+    for (auto it = factories.begin(); it != factories.end(); ++it)
+        if (it->prim == prim) {
+            factories.erase(it);
+            break;
+        }
+    if (factories.size() == max_entries) factories.erase(factories.begin());
+    factories.push_back({prim, factory});
+}
+
+static const prim_factory_t *get_prim_factory(dnnl_primitive_t prim) {
+    for (const auto &e : prim_factories())
+        if (e.prim == prim) return &e.factory;
+    return nullptr;
+}
+
+static double percentile(const std::vector<double> &sorted, double p) {
+    if (sorted.empty()) return 0;
+    const size_t idx = (size_t)ceil(p * sorted.size());
+    return sorted[MAX2((size_t)1, MIN2(idx, sorted.size())) - 1];
+}
+
+// Runs `instances` copies of the primitive concurrently. Every instance is a
+// thread that owns a primitive created for its own thread count, a stream and
+// copies of the execution arguments, and is pinned to its own subset of the
+// CPUs available to the process. All the instances stop as soon as one of
+// them meets the stop criteria to not measure the tail with less contention.
+static int measure_perf_instances(
+        res_t *r, dnnl_primitive_t prim, const args_t &args) {
+#if DNNL_CPU_THREADING_RUNTIME != DNNL_RUNTIME_OMP
+    BENCHDNN_PRINT(0, "%s\n",
+            "WARNING: multi-instance mode requires OpenMP threading "
+            "runtime, skipping.");
+    return OK;
+#else
+    const prim_factory_t *factory = get_prim_factory(prim);
+    if (!factory) {
+        BENCHDNN_PRINT(0, "%s\n",
+                "WARNING: the primitive cannot be re-created for "
+                "multi-instance mode, skipping.");
+        return OK;
+    }
+
+    std::vector<int> cpus;
+#if defined(__linux__)
+    cpu_set_t process_set;
+    CPU_ZERO(&process_set);
+    if (sched_getaffinity(0, sizeof(process_set), &process_set) == 0)
+        for (int c = 0; c < CPU_SETSIZE; ++c)
+            if (CPU_ISSET(c, &process_set)) cpus.push_back(c);
+#endif
+
+    const int nthr = threads_per_instance
+            ? threads_per_instance
+            : MAX2(1, dnnl_get_max_threads() / instances);
+
+    using inst_clock_t = std::chrono::steady_clock;
+    struct instance_t {
+        int status = OK;
+        int first_cpu = -1, last_cpu = -1;
+        std::vector<double> samples;
+        inst_clock_t::time_point start, end;
+    };
+    std::vector<instance_t> inst(instances);
+
+    std::mutex setup_mutex;
+    std::atomic<int> n_ready(0);
+    std::atomic<bool> stop(false);
+
+    auto run_instance = [&](int i) {
+        instance_t &self = inst[i];
+
+        // The threads of the OpenMP team inherit the affinity mask
+#if defined(__linux__)
+        const size_t cpu_start = (size_t)i * nthr;
+        if (cpu_start + nthr <= cpus.size()) {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            for (size_t c = cpu_start; c < cpu_start + nthr; ++c)
+                CPU_SET(cpus[c], &set);
+            if (sched_setaffinity(0, sizeof(set), &set) == 0) {
+                self.first_cpu = cpus[cpu_start];
+                self.last_cpu = cpus[cpu_start + nthr - 1];
+            }
+        }
+#endif
+        omp_set_num_threads(nthr);
+
+        dnnl_primitive_t inst_prim {};
+        std::vector<std::unique_ptr<dnn_mem_t>> mem_copies;
+        std::vector<dnnl_exec_arg_t> dnnl_args;
+        {
+            // The original arguments are remapped while being copied
+            std::lock_guard<std::mutex> guard(setup_mutex);
+            self.status = (*factory)(&inst_prim);
+            if (self.status == OK)
+                self.status = copy_args(args, mem_copies, dnnl_args);
+        }
+        if (self.status != OK) stop = true;
+
+        n_ready++;
+        while (n_ready < instances)
+            std::this_thread::yield();
+
+        if (self.status == OK) {
+            stream_t stream(get_test_engine());
+            benchdnn_timer_t t;
+            self.start = inst_clock_t::now();
+            while (!stop) {
+                t.start();
+                dnnl_status_t st = dnnl_primitive_execute(inst_prim, stream,
+                        (int)dnnl_args.size(), dnnl_args.data());
+                if (st == dnnl_success) st = dnnl_stream_wait(stream);
+                if (st != dnnl_success) {
+                    self.status = FAIL;
+                    stop = true;
+                    break;
+                }
+                t.stamp();
+                self.samples.push_back(t.ms());
+                if (should_stop(t)) stop = true;
+            }
+            self.end = inst_clock_t::now();
+        }
+        dnnl_primitive_destroy(inst_prim);
+    };
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < instances; ++i)
+        threads.emplace_back(run_instance, i);
+    for (auto &thr : threads)
+        thr.join();
+
+    for (const auto &self : inst)
+        SAFE(self.status, WARN);
+
+    inst_clock_t::time_point start = inst[0].start, end = inst[0].end;
+    r->instances_times = 0;
+    for (int i = 0; i < instances; ++i) {
+        auto &self = inst[i];
+        start = std::min(start, self.start);
+        end = std::max(end, self.end);
+        r->instances_times += (int64_t)self.samples.size();
+
+        std::sort(self.samples.begin(), self.samples.end());
+        const std::string cpus_str = self.first_cpu < 0
+                ? std::string("n/a")
+                : std::to_string(self.first_cpu) + "-"
+                        + std::to_string(self.last_cpu);
+        BENCHDNN_PRINT(0,
+                "instance:%d nthr:%d cpus:%s times:%d p50(ms):%g "
+                "p90(ms):%g p99(ms):%g max(ms):%g\n",
+                i, nthr, cpus_str.c_str(), (int)self.samples.size(), percentile(self.samples, 0.5),
+                percentile(self.samples, 0.9), percentile(self.samples, 0.99),
+                percentile(self.samples, 1.0));
+    }
+    r->instances_ms
+            = std::chrono::duration<double, std::milli>(end - start).count();
+
+    return OK;
+#endif
+}
+
+#if defined(__linux__)
+// Returns the number of CPUs of the first NUMA node (a CMG on A64FX) that are
+// available to the process, or 0 if it cannot be found.
+static int get_numa_domain_nthr() {
+    cpu_set_t process_set;
+    CPU_ZERO(&process_set);
+    if (sched_getaffinity(0, sizeof(process_set), &process_set) != 0) return 0;
+
+    FILE *f = fopen("/sys/devices/system/node/node0/cpulist", "r");
+    if (!f) return 0;
+
+    // The list looks like `0-11,48-59`
+    int nthr = 0, first = 0, last = 0;
+    while (true) {
+        const int n = fscanf(f, "%d-%d", &first, &last);
+        if (n < 1) break;
+        if (n == 1) last = first;
+        for (int c = first; c <= last && c < CPU_SETSIZE; ++c)
+            nthr += CPU_ISSET(c, &process_set) ? 1 : 0;
+        if (fgetc(f) != ',') break;
+    }
+    fclose(f);
+    return nthr;
+}
+#endif
+
+// Expands the `auto` entry (0) of the sweep into powers of two, the size of a
+// NUMA domain and the maximal number of threads.
+static std::vector<int> get_thread_sweep(int max_nthr) {
+    std::vector<int> counts;
+    for (int nthr : thread_sweep) {
+        if (nthr > 0) {
+            counts.push_back(nthr);
+            continue;
+        }
+        for (int n = 1; n < max_nthr; n *= 2)
+            counts.push_back(n);
+#if defined(__linux__)
+        const int domain_nthr = get_numa_domain_nthr();
+        if (domain_nthr > 0 && domain_nthr < max_nthr)
+            counts.push_back(domain_nthr);
+#endif
+        counts.push_back(max_nthr);
+    }
+    std::sort(counts.begin(), counts.end());
+    counts.erase(std::unique(counts.begin(), counts.end()), counts.end());
+    return counts;
+}
+
+// Measures the primitive re-created for every thread count of the sweep and
+// reports the speedup and the parallel efficiency relative to the smallest
+// count. A problem stops scaling when adding threads does not make it faster,
+// e.g. when the work is split into fewer chunks than there are threads.
+static int measure_perf_thread_sweep(
+        res_t *r, dnnl_primitive_t prim, args_t &args) {
+#if DNNL_CPU_THREADING_RUNTIME != DNNL_RUNTIME_OMP
+    BENCHDNN_PRINT(0, "%s\n",
+            "WARNING: thread sweep requires OpenMP threading runtime, "
+            "skipping.");
+    return OK;
+#else
+    const prim_factory_t *factory = get_prim_factory(prim);
+    if (!factory) {
+        BENCHDNN_PRINT(0, "%s\n",
+                "WARNING: the primitive cannot be re-created for thread "
+                "sweep, skipping.");
+        return OK;
+    }
+
+    const int max_nthr = dnnl_get_max_threads();
+    const auto counts = get_thread_sweep(max_nthr);
+
+    stream_t stream(get_test_engine());
+    std::vector<dnnl_exec_arg_t> dnnl_args;
+    execute_unmap_args(args, dnnl_args);
+
+    int sweep_status = OK;
+    std::vector<double> times;
+    for (int nthr : counts) {
+        // The primitive cache keys the primitives by the thread count, so
+        // every count gets its own primitive
+        omp_set_num_threads(nthr);
+        dnnl_primitive_t sweep_prim {};
+        sweep_status = (*factory)(&sweep_prim);
+        if (sweep_status == OK) {
+            benchdnn_timer_t t;
+            sweep_status = measure_perf_individual(
+                    t, stream, sweep_prim, dnnl_args);
+            times.push_back(t.ms());
+        }
+        dnnl_primitive_destroy(sweep_prim);
+        if (sweep_status != OK) break;
+    }
+    omp_set_num_threads(max_nthr);
+    execute_map_args(args);
+    SAFE(sweep_status, WARN);
+    if (times.size() < counts.size()) return FAIL;
+
+    r->sweep_best_nthr = counts[0];
+    double best_ms = times[0];
+    for (size_t i = 0; i < counts.size(); ++i) {
+        const double speedup = times[0] / times[i];
+        const double eff = 100. * speedup * counts[0] / counts[i];
+        // Efficiency of the threads added since the previous count
+        double step_eff = 100.;
+        if (i > 0)
+            step_eff = 100. * times[i - 1] / times[i] * counts[i - 1]
+                    / counts[i];
+        BENCHDNN_PRINT(0,
+                "threads:%d time(ms):%g speedup:%g efficiency:%.1f%% "
+                "step-efficiency:%.1f%%\n",
+                counts[i], times[i], speedup, eff, step_eff);
+        if (times[i] < best_ms) {
+            best_ms = times[i];
+            r->sweep_best_nthr = counts[i];
+        }
+        r->sweep_speedup = speedup;
+        r->sweep_eff = eff;
+    }
+
+    if (r->sweep_best_nthr < counts.back())
+        BENCHDNN_PRINT(0,
+                "WARNING: the problem stops scaling at %d threads, %d "
+                "threads are %.1f%% slower\n",
+                r->sweep_best_nthr, counts.back(),
+                100. * (times.back() / best_ms - 1.));
+
+    return OK;
+#endif
+}
+
+int measure_perf(res_t *r, dnnl_primitive_t prim, args_t &args) {
     dnnl_engine_kind_t engine_kind;
     DNN_SAFE(dnnl_engine_get_kind(get_test_engine(), &engine_kind), CRIT);
 
@@ -168,11 +644,37 @@ int measure_perf(benchdnn_timer_t &t, dnnl_primitive_t prim, args_t &args) {
         // For CPU: measure indiividual iterations
         // For GPU: measure iterations in batches to hide driver overhead
         if (engine_kind == dnnl_cpu)
-            ret = measure_perf_individual(t, stream, prim, dnnl_args);
+            ret = measure_perf_individual(r->timer, stream, prim, dnnl_args);
         else
-            ret = measure_perf_aggregate(t, stream, prim, dnnl_args);
+            ret = measure_perf_aggregate(r->timer, stream, prim, dnnl_args);
 
         if (ret == OK) execute_map_args(args);
+
+        // Flushing the host caches has no effect on a device, so the buffers
+        // are rotated instead
+        cold_cache_mode_t mode = cold_cache_mode;
+        if (mode == COLD_CACHE_FLUSH && engine_kind != dnnl_cpu)
+            mode = COLD_CACHE_ROTATE;
+        if (ret == OK && mode != COLD_CACHE_NONE)
+            ret = measure_perf_cold(r->cold_timer, stream, prim, args, mode);
+
+        if (ret == OK && instances > 1) {
+            if (engine_kind == dnnl_cpu)
+                ret = measure_perf_instances(r, prim, args);
+            else
+                BENCHDNN_PRINT(0, "%s\n",
+                        "WARNING: multi-instance mode is supported for CPU "
+                        "engine only, skipping.");
+        }
+
+        if (ret == OK && !thread_sweep.empty()) {
+            if (engine_kind == dnnl_cpu)
+                ret = measure_perf_thread_sweep(r, prim, args);
+            else
+                BENCHDNN_PRINT(0, "%s\n",
+                        "WARNING: thread sweep is supported for CPU engine "
+                        "only, skipping.");
+        }
     }
     return ret;
 }
@@ -19,6 +19,9 @@
 
 #include <stddef.h>
 #include <stdint.h>
+#include <functional>
+#include <memory>
+#include <type_traits>
 #include <vector>
 
 #include "dnnl.h"
@@ -248,6 +251,42 @@ inline const engine_t &get_cpu_engine() {
     return instance;
 }
 
+// Creates a primitive in the calling thread. The multi-instance mode and the
+// thread sweep use it to get the measured primitive configured for another
+// thread count.
+using prim_factory_t = std::function<int(dnnl_primitive_t *)>;
+void register_prim_factory(
+        dnnl_primitive_t prim, const prim_factory_t &factory);
+
+template <typename func_t, typename prb_t>
+int register_prim_factory(dnnl_primitive_t prim, const func_t &init_pd_func,
+        prb_t *p, dir_t dir, const_dnnl_primitive_desc_t hint) {
+    // The hint may be destroyed before the primitive is measured
+    std::shared_ptr<dnnl_primitive_desc> hint_copy;
+    if (hint) {
+        dnnl_primitive_desc_t pd {};
+        DNN_SAFE(dnnl_primitive_desc_clone(&pd, hint), WARN);
+        hint_copy.reset(pd, dnnl_primitive_desc_destroy);
+    }
+
+    // The factory outlives the call, so a functor is copied and a function
+    // decays to a pointer
+    typename std::decay<func_t>::type init_pd = init_pd_func;
+    register_prim_factory(prim, [=](dnnl_primitive_t *new_prim) -> int {
+        dnnl_primitive_desc_t pd {};
+        res_t res {};
+        int status
+                = init_pd(get_test_engine(), p, pd, &res, dir, hint_copy.get());
+        if (status != OK) return status;
+        if (res.state == SKIPPED || res.state == UNIMPLEMENTED) return FAIL;
+        dnnl_status_t dnnl_status = dnnl_primitive_create(new_prim, pd);
+        dnnl_primitive_desc_destroy(pd);
+        DNN_SAFE(dnnl_status, WARN);
+        return OK;
+    });
+    return OK;
+}
+
 template <typename func_t, typename prb_t>
 int init_prim(dnnl_primitive_t *prim, const func_t &init_pd_func, prb_t *p,
         res_t *r, dir_t dir = FLAG_FWD,
@@ -289,13 +328,23 @@ int init_prim(dnnl_primitive_t *prim, const func_t &init_pd_func, prb_t *p,
     // This primitive is expected to come from the cache.
     DNN_SAFE_CLEAN(dnnl_primitive_create(&return_prim, pd), WARN, cleanup_pd);
     DNN_SAFE_CLEAN(dnnl_primitive_desc_destroy(pd), WARN, cleanup_prim);
+    if (instances > 1 || !thread_sweep.empty())
+        SAFE_CLEAN(register_prim_factory(
+                           return_prim, init_pd_func, p, dir, hint),
+                WARN, cleanup_prim);
     (*prim) = return_prim;
     return OK;
 }
 
 int execute_and_wait(dnnl_primitive_t prim, const args_t &args);
 
-int measure_perf(benchdnn_timer_t &t, dnnl_primitive_t prim, args_t &args);
+// Helpers for drivers running their own execution loop
+void execute_unmap_args(
+        const args_t &args, std::vector<dnnl_exec_arg_t> &dnnl_args);
+void execute_map_args(const args_t &args);
+bool should_stop(const benchdnn_timer_t &t);
+
+int measure_perf(res_t *r, dnnl_primitive_t prim, args_t &args);
 
 void maybe_prepare_runtime_scales(dnn_mem_t &scales_m, const attr_t &attr,
         int64_t scale_cnt, const float *scales);
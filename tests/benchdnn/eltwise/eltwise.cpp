@@ -406,7 +406,7 @@ int doit(const prb_t *p, res_t *r) {
         }
     }
 
-    measure_perf(r->timer, e, args);
+    measure_perf(r, e, args);
 
     DNN_SAFE_V(dnnl_primitive_destroy(e));
 
@@ -398,7 +398,7 @@ int doit(const prb_t *p, res_t *r) {
         }
     }
 
-    measure_perf(r->timer, ip, args);
+    measure_perf(r, ip, args);
 
     DNN_SAFE_V(dnnl_primitive_destroy(ip));
 
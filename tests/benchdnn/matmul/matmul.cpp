@@ -363,7 +363,7 @@ int doit(const prb_t *p, res_t *r) {
         SAFE(compare_dat(p, DST, c, dst_fp, r), WARN);
     }
 
-    measure_perf(r->timer, m, args);
+    measure_perf(r, m, args);
 
     DNN_SAFE_V(dnnl_primitive_destroy(m));
 
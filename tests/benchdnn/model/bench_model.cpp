@@ -0,0 +1,75 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <sstream>
+
+#include "dnnl_common.hpp"
+#include "dnnl_memory.hpp"
+#include "parser.hpp"
+
+#include "model/model.hpp"
+
+namespace model {
+
+void check_correctness(const settings_t &s, const char *log) {
+    prb_t p(log);
+    SAFE_V(read_log(&p));
+
+    std::stringstream ss;
+    ss << p;
+    const std::string cpp_pstr = ss.str();
+    const char *pstr = cpp_pstr.c_str();
+    BENCHDNN_PRINT(1, "run: %s\n", pstr);
+
+    res_t res {};
+    int status = doit(&p, &res);
+
+    bool want_perf_report = false;
+    parse_result(res, want_perf_report, status, pstr);
+
+    if (want_perf_report && bench_mode & PERF) {
+        perf_report_t pr(s.perf_template);
+        pr.report(&p, &res, pstr);
+    }
+
+    benchdnn_stat.tests++;
+}
+
+int bench(int argc, char **argv) {
+    driver_name = "model";
+    using namespace parser;
+    static settings_t s;
+    static const settings_t def {};
+    for (; argc > 0; --argc, ++argv) {
+        const bool parsed_options = parse_bench_settings(argv[0])
+                || parse_batch(bench, argv[0])
+                || parse_perf_template(s.perf_template, s.perf_template_def,
+                        s.perf_template_csv, argv[0])
+                || parse_reset(s, argv[0]);
+        if (!parsed_options) {
+            catch_unknown_options(argv[0]);
+
+            check_correctness(s, argv[0]);
+        }
+    }
+
+    return parse_last_argument();
+}
+
+} // namespace model
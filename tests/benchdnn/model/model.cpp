@@ -0,0 +1,762 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <ctype.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <map>
+#include <memory>
+#include <sstream>
+
+#include "dnnl.h"
+#include "dnnl_debug.h"
+
+#include "dnnl_common.hpp"
+#include "dnnl_debug.hpp"
+#include "dnnl_memory.hpp"
+#include "parser.hpp"
+
+#include "model/model.hpp"
+
+namespace model {
+
+namespace {
+
+// benchdnn dims_t has no constructors of std::vector
+using shape_t = std::vector<int64_t>;
+
+// Numbers of a problem string, e.g. `mb2_ic16oc32_ih7oh7kh3sh1dh0ph1`
+struct prb_params_t {
+    prb_params_t(const std::string &str) {
+        size_t i = 0;
+        while (i < str.size()) {
+            std::string key;
+            while (i < str.size() && isalpha(str[i]))
+                key += str[i++];
+            std::string val;
+            while (i < str.size() && (isdigit(str[i]) || strchr(".*", str[i])))
+                val += str[i++];
+            // runtime values cannot be replayed and are marked as negative
+            if (!key.empty()) vals_[key] = val == "*" ? -1 : atof(val.c_str());
+            if (key.empty() && val.empty()) ++i; // skip delimiters
+        }
+    }
+
+    bool has(const char *key) const { return vals_.count(key) != 0; }
+    double getf(const char *key, double def = 0) const {
+        return has(key) ? vals_.at(key) : def;
+    }
+    int64_t get(const char *key, int64_t def = 0) const {
+        return (int64_t)getf(key, (double)def);
+    }
+
+    // Values of the last `ndims - 2` spatial dimensions for a given prefix:
+    // `get_sp('k', 4)` returns {kh, kw}.
+    shape_t get_sp(char prefix, int ndims, int64_t def = 0) const {
+        shape_t sp;
+        for (int d = 5 - ndims; d < 3; ++d) {
+            const char key[3] = {prefix, "dhw"[d], '\0'};
+            sp.push_back(get(key, def));
+        }
+        return sp;
+    }
+
+private:
+    std::map<std::string, double> vals_;
+};
+
+// Space separated `key:value` pairs of the auxiliary field
+std::map<std::string, std::string> parse_aux(const std::string &str) {
+    std::map<std::string, std::string> aux;
+    std::stringstream ss(str);
+    std::string kv;
+    while (ss >> kv) {
+        const size_t pos = kv.find(':');
+        if (pos != std::string::npos)
+            aux[kv.substr(0, pos)] = kv.substr(pos + 1);
+    }
+    return aux;
+}
+
+dnnl_alg_kind_t str2alg_kind(const std::string &str) {
+    static const dnnl_alg_kind_t algs[] = {dnnl_convolution_direct,
+            dnnl_convolution_winograd, dnnl_convolution_auto,
+            dnnl_deconvolution_direct, dnnl_deconvolution_winograd,
+            dnnl_eltwise_relu, dnnl_eltwise_tanh, dnnl_eltwise_elu,
+            dnnl_eltwise_square, dnnl_eltwise_abs, dnnl_eltwise_sqrt,
+            dnnl_eltwise_linear, dnnl_eltwise_bounded_relu,
+            dnnl_eltwise_soft_relu, dnnl_eltwise_logistic, dnnl_eltwise_exp,
+            dnnl_eltwise_gelu_tanh, dnnl_eltwise_swish, dnnl_eltwise_log,
+            dnnl_eltwise_clip, dnnl_eltwise_pow, dnnl_eltwise_gelu_erf,
+            dnnl_eltwise_round, dnnl_eltwise_relu_use_dst_for_bwd,
+            dnnl_eltwise_tanh_use_dst_for_bwd,
+            dnnl_eltwise_elu_use_dst_for_bwd,
+            dnnl_eltwise_sqrt_use_dst_for_bwd,
+            dnnl_eltwise_logistic_use_dst_for_bwd,
+            dnnl_eltwise_exp_use_dst_for_bwd, dnnl_pooling_max,
+            dnnl_pooling_avg_include_padding,
+            dnnl_pooling_avg_exclude_padding, dnnl_lrn_across_channels,
+            dnnl_lrn_within_channel, dnnl_binary_add, dnnl_binary_mul,
+            dnnl_binary_max, dnnl_binary_min};
+    for (auto alg : algs)
+        if (str == dnnl_alg_kind2str(alg)) return alg;
+    return dnnl_alg_kind_undef;
+}
+
+unsigned str2flags(const std::string &str) {
+    unsigned flags = 0;
+    if (str.find('G') != std::string::npos) flags |= dnnl_use_global_stats;
+    if (str.find('S') != std::string::npos) flags |= dnnl_use_scaleshift;
+    if (str.find('R') != std::string::npos) flags |= dnnl_fuse_norm_relu;
+    return flags;
+}
+
+// Returns the number of dimensions a tag describes, or 0 if it is unknown
+int tag_ndims(dnnl_format_tag_t tag) {
+    if (tag == dnnl_format_tag_any) return 0;
+    const char *str = fmt_tag2str(tag);
+    int ndims = 0;
+    while (isalpha(str[ndims]))
+        ++ndims;
+    return ndims;
+}
+
+const md_entry_t *find_md(const layer_t &l, const char *name, int idx = 0) {
+    for (const auto &e : l.mds)
+        if (e.name == name && idx-- == 0) return &e;
+    return nullptr;
+}
+
+int count_mds(const layer_t &l, const char *name) {
+    int n = 0;
+    while (find_md(l, name, n))
+        ++n;
+    return n;
+}
+
+int init_md(dnnl_memory_desc_t &md, const shape_t &dims, const md_entry_t *e) {
+    if (!e) return FAIL;
+    DNN_SAFE(dnnl_memory_desc_init_by_tag(
+                     &md, (int)dims.size(), dims.data(), e->dt, e->tag),
+            WARN);
+    return OK;
+}
+
+// Runtime arguments requested by the attributes
+struct attr_args_t {
+    bool oscale_runtime = false;
+    std::vector<int> zp_runtime_args;
+};
+
+// `oscale:mask[:value];zero_points:'src:0:1_dst:0:*';post_ops:'sum;...';`
+int init_attr(dnnl_primitive_attr_t attr, attr_args_t &attr_args,
+        const std::string &str, const dnnl_memory_desc_t &dst_md) {
+    DNN_SAFE(dnnl_primitive_attr_set_scratchpad_mode(attr, scratchpad_mode),
+            WARN);
+
+    size_t pos = 0;
+    while (pos < str.size()) {
+        const size_t colon = str.find(':', pos);
+        if (colon == std::string::npos) break;
+        const std::string key = str.substr(pos, colon - pos);
+        std::string val;
+        if (str[colon + 1] == '\'') {
+            const size_t end = str.find('\'', colon + 2);
+            if (end == std::string::npos) return FAIL;
+            val = str.substr(colon + 2, end - colon - 2);
+            pos = end + 2;
+        } else {
+            const size_t end = str.find(';', colon);
+            val = str.substr(colon + 1, end - colon - 1);
+            pos = end == std::string::npos ? str.size() : end + 1;
+        }
+
+        std::vector<std::string> entries;
+        {
+            std::stringstream ss(val);
+            std::string e;
+            const char delim = key == "post_ops" ? ';' : '_';
+            while (std::getline(ss, e, delim))
+                if (!e.empty()) entries.push_back(e);
+        }
+
+        if (key == "oscale") {
+            const int mask = atoi(val.c_str());
+            const size_t v = val.find(':');
+            float scale = v == std::string::npos ? 1.f : atof(&val[v + 1]);
+            if (isnan(scale)) {
+                attr_args.oscale_runtime = true;
+                scale = DNNL_RUNTIME_F32_VAL;
+            }
+            int64_t count = 1;
+            for (int d = 0; d < dst_md.ndims; ++d)
+                if (mask & (1 << d)) count *= dst_md.dims[d];
+            std::vector<float> scales(count, scale);
+            DNN_SAFE(dnnl_primitive_attr_set_output_scales(
+                             attr, count, mask, scales.data()),
+                    WARN);
+        } else if (key == "zero_points") {
+            for (const auto &e : entries) {
+                // `arg:mask[:value]`, per-channel values are not logged
+                const size_t c0 = e.find(':');
+                const size_t c1 = e.find(':', c0 + 1);
+                const std::string arg_str = e.substr(0, c0);
+                const int arg = arg_str == "src"
+                        ? DNNL_ARG_SRC
+                        : arg_str == "wei" ? DNNL_ARG_WEIGHTS : DNNL_ARG_DST;
+                const int mask = atoi(&e[c0 + 1]);
+                int zp = 0;
+                if (c1 == std::string::npos || e.substr(c1 + 1) == "*") {
+                    attr_args.zp_runtime_args.push_back(arg);
+                    zp = DNNL_RUNTIME_S32_VAL;
+                } else {
+                    zp = atoi(&e[c1 + 1]);
+                }
+                DNN_SAFE(dnnl_primitive_attr_set_zero_points(
+                                 attr, arg, 1, mask, &zp),
+                        WARN);
+            }
+        } else if (key == "post_ops") {
+            dnnl_post_ops_t ops;
+            DNN_SAFE(dnnl_post_ops_create(&ops), WARN);
+            for (const auto &e : entries) {
+                std::vector<std::string> f;
+                std::stringstream ss(e);
+                std::string s;
+                while (std::getline(ss, s, ':'))
+                    f.push_back(s);
+                float v[3] = {0.f, 0.f, 1.f};
+                for (size_t i = 1; i < f.size() && i <= 3; ++i)
+                    v[i - 1] = atof(f[i].c_str());
+
+                dnnl_status_t st = dnnl_success;
+                if (f[0] == "sum") {
+                    st = dnnl_post_ops_append_sum(
+                            ops, f.size() > 1 ? v[0] : 1.f);
+                } else {
+                    const dnnl_alg_kind_t alg = str2alg_kind(f[0]);
+                    st = alg == dnnl_alg_kind_undef
+                            ? dnnl_invalid_arguments
+                            : dnnl_post_ops_append_eltwise(
+                                    ops, v[2], alg, v[0], v[1]);
+                }
+                if (st == dnnl_success) continue;
+                dnnl_post_ops_destroy(ops);
+                DNN_SAFE(st, WARN);
+            }
+            dnnl_status_t st = dnnl_primitive_attr_set_post_ops(attr, ops);
+            dnnl_post_ops_destroy(ops);
+            DNN_SAFE(st, WARN);
+        }
+        // scratchpad_mode, scales and rnn_data_qparams are not replayed
+    }
+
+    return OK;
+}
+
+// Creates a primitive descriptor for a logged layer. Sets `reason` and
+// returns OK if the layer cannot be replayed.
+int init_pd(const layer_t &l, dnnl_primitive_desc_t &pd,
+        attr_args_t &attr_args, const char *&reason) {
+    const auto &engine = get_test_engine();
+    const auto aux = parse_aux(l.aux);
+    const prb_params_t pp(l.prb);
+    const dnnl_prop_kind_t prop
+            = l.prop == dnnl_prop_kind_undef ? dnnl_forward_inference : l.prop;
+
+    auto alg = [&]() {
+        return str2alg_kind(aux.count("alg") ? aux.at("alg") : "");
+    };
+    auto aux_f = [&](const char *key, double def) {
+        return aux.count(key) ? atof(aux.at(key).c_str()) : def;
+    };
+    auto prb_dims = [&](const std::string &str) -> shape_t {
+        dims_t dims;
+        parser::parse_dims(dims, str.c_str());
+        return dims;
+    };
+    auto prb_multi_dims = [&](const std::string &str) {
+        std::vector<dims_t> dims;
+        parser::parse_multi_dims(dims, str.c_str());
+        return std::vector<shape_t>(dims.begin(), dims.end());
+    };
+    // Number of dimensions of `mb ic [id] [ih] [iw]` problems
+    auto data_ndims = [&]() {
+        return 2 + pp.has("id") + pp.has("ih") + pp.has("iw");
+    };
+    auto data_dims = [&](int ndims) {
+        shape_t dims = {pp.get("mb"), pp.get("ic")};
+        for (auto d : pp.get_sp('i', ndims))
+            dims.push_back(d);
+        return dims;
+    };
+
+    reason = nullptr;
+    std::unique_ptr<dnnl_primitive_attr, decltype(&dnnl_primitive_attr_destroy)>
+            attr(nullptr, dnnl_primitive_attr_destroy);
+    {
+        dnnl_primitive_attr_t a;
+        DNN_SAFE(dnnl_primitive_attr_create(&a), WARN);
+        attr.reset(a);
+    }
+
+    // The dst descriptor is needed first to size per-channel output scales
+    dnnl_memory_desc_t src_md {}, wei_md {}, bia_md {}, dst_md {};
+    const md_entry_t *bia = find_md(l, "bia");
+    dnnl_status_t st = dnnl_unimplemented;
+
+    if (l.kind == "convolution" || l.kind == "deconvolution") {
+        const bool is_deconv = l.kind == "deconvolution";
+        const md_entry_t *src = find_md(l, "src");
+        int ndims = src ? tag_ndims(src->tag) : 0;
+        if (ndims == 0) ndims = pp.has("id") ? 5 : 4;
+        const int64_t g = pp.get("g", 1), oc = pp.get("oc"), ic = pp.get("ic");
+
+        const auto i = pp.get_sp('i', ndims), o = pp.get_sp('o', ndims);
+        const auto k = pp.get_sp('k', ndims), s = pp.get_sp('s', ndims, 1);
+        const auto d = pp.get_sp('d', ndims), p = pp.get_sp('p', ndims);
+        shape_t p_r(p.size());
+        for (size_t n = 0; n < p.size(); ++n) {
+            const int64_t ext = (k[n] - 1) * (d[n] + 1) + 1;
+            p_r[n] = is_deconv ? (i[n] - 1) * s[n] - o[n] + ext - p[n]
+                               : (o[n] - 1) * s[n] - i[n] + ext - p[n];
+        }
+
+        shape_t src_dims = {pp.get("mb"), ic}, dst_dims = {pp.get("mb"), oc};
+        shape_t wei_dims = {oc, ic};
+        if (pp.has("g")) wei_dims = {g, oc / g, ic / g};
+        src_dims.insert(src_dims.end(), i.begin(), i.end());
+        dst_dims.insert(dst_dims.end(), o.begin(), o.end());
+        wei_dims.insert(wei_dims.end(), k.begin(), k.end());
+
+        SAFE(init_md(src_md, src_dims, src), WARN);
+        SAFE(init_md(wei_md, wei_dims, find_md(l, "wei")), WARN);
+        SAFE(init_md(dst_md, dst_dims, find_md(l, "dst")), WARN);
+        if (bia) SAFE(init_md(bia_md, {oc}, bia), WARN);
+        SAFE(init_attr(attr.get(), attr_args, l.attr, dst_md), WARN);
+
+        dnnl_convolution_desc_t cd;
+        if (is_deconv)
+            DNN_SAFE(dnnl_dilated_deconvolution_forward_desc_init(&cd, prop,
+                             alg(), &src_md, &wei_md, bia ? &bia_md : nullptr,
+                             &dst_md, s.data(), d.data(), p.data(),
+                             p_r.data()),
+                    WARN);
+        else
+            DNN_SAFE(dnnl_dilated_convolution_forward_desc_init(&cd, prop,
+                             alg(), &src_md, &wei_md, bia ? &bia_md : nullptr,
+                             &dst_md, s.data(), d.data(), p.data(),
+                             p_r.data()),
+                    WARN);
+        st = dnnl_primitive_desc_create(&pd, &cd, attr.get(), engine, nullptr);
+    } else if (l.kind == "inner_product") {
+        const int ndims = data_ndims();
+        const int64_t oc = pp.get("oc");
+        shape_t wei_dims = data_dims(ndims);
+        wei_dims[0] = oc;
+
+        SAFE(init_md(src_md, data_dims(ndims), find_md(l, "src")), WARN);
+        SAFE(init_md(wei_md, wei_dims, find_md(l, "wei")), WARN);
+        SAFE(init_md(dst_md, {pp.get("mb"), oc}, find_md(l, "dst")), WARN);
+        if (bia) SAFE(init_md(bia_md, {oc}, bia), WARN);
+        SAFE(init_attr(attr.get(), attr_args, l.attr, dst_md), WARN);
+
+        dnnl_inner_product_desc_t ipd;
+        DNN_SAFE(dnnl_inner_product_forward_desc_init(&ipd, prop, &src_md,
+                         &wei_md, bia ? &bia_md : nullptr, &dst_md),
+                WARN);
+        st = dnnl_primitive_desc_create(&pd, &ipd, attr.get(), engine, nullptr);
+    } else if (l.kind == "pooling") {
+        const md_entry_t *src = find_md(l, "src");
+        int ndims = src ? tag_ndims(src->tag) : 0;
+        if (ndims == 0) ndims = pp.has("id") ? 5 : 4;
+
+        const auto i = pp.get_sp('i', ndims), o = pp.get_sp('o', ndims);
+        const auto k = pp.get_sp('k', ndims), s = pp.get_sp('s', ndims, 1);
+        const auto p = pp.get_sp('p', ndims);
+        shape_t p_r(p.size());
+        for (size_t n = 0; n < p.size(); ++n)
+            p_r[n] = (o[n] - 1) * s[n] - i[n] + k[n] - p[n];
+
+        shape_t src_dims = data_dims(ndims);
+        shape_t dst_dims = {pp.get("mb"), pp.get("ic")};
+        dst_dims.insert(dst_dims.end(), o.begin(), o.end());
+
+        SAFE(init_md(src_md, src_dims, src), WARN);
+        SAFE(init_md(dst_md, dst_dims, find_md(l, "dst")), WARN);
+        SAFE(init_attr(attr.get(), attr_args, l.attr, dst_md), WARN);
+
+        dnnl_pooling_desc_t pod;
+        DNN_SAFE(dnnl_pooling_forward_desc_init(&pod, prop, alg(), &src_md,
+                         &dst_md, s.data(), k.data(), p.data(), p_r.data()),
+                WARN);
+        st = dnnl_primitive_desc_create(&pd, &pod, attr.get(), engine, nullptr);
+    } else if (l.kind == "eltwise") {
+        SAFE(init_md(src_md, prb_dims(l.prb), find_md(l, "data")), WARN);
+        SAFE(init_attr(attr.get(), attr_args, l.attr, src_md), WARN);
+
+        dnnl_eltwise_desc_t ed;
+        DNN_SAFE(dnnl_eltwise_forward_desc_init(&ed, prop, alg(), &src_md,
+                         aux_f("alpha", 0), aux_f("beta", 0)),
+                WARN);
+        st = dnnl_primitive_desc_create(&pd, &ed, attr.get(), engine, nullptr);
+    } else if (l.kind == "softmax" || l.kind == "logsoftmax") {
+        SAFE(init_md(src_md, prb_dims(l.prb), find_md(l, "data")), WARN);
+        SAFE(init_attr(attr.get(), attr_args, l.attr, src_md), WARN);
+
+        const int axis = (int)aux_f("axis", 1);
+        dnnl_softmax_desc_t sd;
+        if (l.kind == "softmax")
+            DNN_SAFE(dnnl_softmax_forward_desc_init(&sd, prop, &src_md, axis),
+                    WARN);
+        else
+            DNN_SAFE(dnnl_logsoftmax_forward_desc_init(
+                             &sd, prop, &src_md, axis),
+                    WARN);
+        st = dnnl_primitive_desc_create(&pd, &sd, attr.get(), engine, nullptr);
+    } else if (l.kind == "batch_normalization") {
+        SAFE(init_md(src_md, data_dims(data_ndims()), find_md(l, "data")),
+                WARN);
+        SAFE(init_attr(attr.get(), attr_args, l.attr, src_md), WARN);
+
+        // epsilon is not logged, benchdnn default is used
+        const unsigned flags
+                = str2flags(aux.count("flags") ? aux.at("flags") : "");
+        dnnl_batch_normalization_desc_t bd;
+        DNN_SAFE(dnnl_batch_normalization_forward_desc_init(
+                         &bd, prop, &src_md, 1.f / 16, flags),
+                WARN);
+        st = dnnl_primitive_desc_create(&pd, &bd, attr.get(), engine, nullptr);
+    } else if (l.kind == "layer_normalization") {
+        const shape_t dims = prb_dims(l.prb);
+        SAFE(init_md(src_md, dims, find_md(l, "data")), WARN);
+        const md_entry_t *stats = find_md(l, "stats");
+        if (stats)
+            SAFE(init_md(wei_md, shape_t(dims.begin(), dims.end() - 1), stats),
+                    WARN);
+        SAFE(init_attr(attr.get(), attr_args, l.attr, src_md), WARN);
+
+        const unsigned flags
+                = str2flags(aux.count("flags") ? aux.at("flags") : "");
+        dnnl_layer_normalization_desc_t lnd;
+        DNN_SAFE(dnnl_layer_normalization_forward_desc_init(&lnd, prop,
+                         &src_md, stats ? &wei_md : nullptr, 1.f / 16, flags),
+                WARN);
+        st = dnnl_primitive_desc_create(&pd, &lnd, attr.get(), engine, nullptr);
+    } else if (l.kind == "lrn") {
+        SAFE(init_md(src_md, data_dims(data_ndims()), find_md(l, "data")),
+                WARN);
+        SAFE(init_attr(attr.get(), attr_args, l.attr, src_md), WARN);
+
+        // alpha and k are not logged, benchdnn defaults are used
+        dnnl_lrn_desc_t lrnd;
+        DNN_SAFE(dnnl_lrn_forward_desc_init(&lrnd, prop, alg(), &src_md,
+                         pp.get("ls", 5), 1.f / 8, pp.getf("beta", 0.75), 1.f),
+                WARN);
+        st = dnnl_primitive_desc_create(
+                &pd, &lrnd, attr.get(), engine, nullptr);
+    } else if (l.kind == "shuffle") {
+        SAFE(init_md(src_md, prb_dims(l.prb), find_md(l, "data")), WARN);
+        SAFE(init_attr(attr.get(), attr_args, l.attr, src_md), WARN);
+
+        dnnl_shuffle_desc_t shd;
+        DNN_SAFE(dnnl_shuffle_forward_desc_init(&shd, prop, &src_md,
+                         (int)aux_f("axis", 1), (dnnl_dim_t)aux_f("group", 1)),
+                WARN);
+        st = dnnl_primitive_desc_create(&pd, &shd, attr.get(), engine, nullptr);
+    } else if (l.kind == "binary") {
+        // `src0_dims:src1_dims dst_dims`
+        const auto sp = l.prb.find(' ');
+        const auto sdims = prb_multi_dims(l.prb.substr(0, sp));
+        if (sdims.size() != 2 || sp == std::string::npos) return FAIL;
+
+        dnnl_memory_desc_t src1_md;
+        SAFE(init_md(src_md, sdims[0], find_md(l, "src", 0)), WARN);
+        SAFE(init_md(src1_md, sdims[1], find_md(l, "src", 1)), WARN);
+        SAFE(init_md(dst_md, prb_dims(l.prb.substr(sp + 1)),
+                     find_md(l, "dst")),
+                WARN);
+        SAFE(init_attr(attr.get(), attr_args, l.attr, dst_md), WARN);
+
+        dnnl_binary_desc_t bd;
+        DNN_SAFE(dnnl_binary_desc_init(&bd, alg(), &src_md, &src1_md, &dst_md),
+                WARN);
+        st = dnnl_primitive_desc_create(&pd, &bd, attr.get(), engine, nullptr);
+    } else if (l.kind == "matmul") {
+        const bool batched = pp.has("b");
+        const int64_t b = pp.get("b", 1), m = pp.get("m"), n = pp.get("n"),
+                      k = pp.get("k");
+        if (b < 0 || m < 0 || n < 0 || k < 0) {
+            reason = "runtime dimensions";
+            return OK;
+        }
+        shape_t src_dims = {m, k}, wei_dims = {k, n}, dst_dims = {m, n};
+        if (batched) {
+            src_dims.insert(src_dims.begin(), b);
+            wei_dims.insert(wei_dims.begin(), b);
+            dst_dims.insert(dst_dims.begin(), b);
+        }
+
+        SAFE(init_md(src_md, src_dims, find_md(l, "src")), WARN);
+        SAFE(init_md(wei_md, wei_dims, find_md(l, "wei")), WARN);
+        SAFE(init_md(dst_md, dst_dims, find_md(l, "dst")), WARN);
+        if (bia) {
+            shape_t bia_dims = dst_dims;
+            for (size_t d = 0; d < bia_dims.size(); ++d)
+                if (!(bia->mask & (1 << d))) bia_dims[d] = 1;
+            SAFE(init_md(bia_md, bia_dims, bia), WARN);
+        }
+        SAFE(init_attr(attr.get(), attr_args, l.attr, dst_md), WARN);
+
+        dnnl_matmul_desc_t md;
+        DNN_SAFE(dnnl_matmul_desc_init(&md, &src_md, &wei_md,
+                         bia ? &bia_md : nullptr, &dst_md),
+                WARN);
+        st = dnnl_primitive_desc_create(&pd, &md, attr.get(), engine, nullptr);
+    } else if (l.kind == "reorder") {
+        const shape_t dims = prb_dims(l.prb);
+        SAFE(init_md(src_md, dims, find_md(l, "src")), WARN);
+        SAFE(init_md(dst_md, dims, find_md(l, "dst")), WARN);
+        SAFE(init_attr(attr.get(), attr_args, l.attr, dst_md), WARN);
+
+        st = dnnl_reorder_primitive_desc_create(
+                &pd, &src_md, engine, &dst_md, engine, attr.get());
+    } else if (l.kind == "sum" || l.kind == "concat") {
+        const int n = count_mds(l, "src");
+        std::vector<shape_t> sdims(n, prb_dims(l.prb));
+        shape_t ddims = sdims.empty() ? shape_t() : sdims[0];
+        if (l.kind == "concat") {
+            // `src0_dims:src1_dims:... dst_dims`
+            const auto sp = l.prb.find(' ');
+            if (sp == std::string::npos) return FAIL;
+            sdims = prb_multi_dims(l.prb.substr(0, sp));
+            ddims = prb_dims(l.prb.substr(sp + 1));
+            if ((int)sdims.size() != n) return FAIL;
+        }
+
+        std::vector<dnnl_memory_desc_t> src_mds(n);
+        for (int i = 0; i < n; ++i)
+            SAFE(init_md(src_mds[i], sdims[i], find_md(l, "src", i)), WARN);
+        SAFE(init_md(dst_md, ddims, find_md(l, "dst")), WARN);
+        SAFE(init_attr(attr.get(), attr_args, l.attr, dst_md), WARN);
+
+        if (l.kind == "sum") {
+            const std::vector<float> scales(n, 1.f);
+            st = dnnl_sum_primitive_desc_create(&pd, &dst_md, n,
+                    scales.data(), src_mds.data(), attr.get(), engine);
+        } else {
+            st = dnnl_concat_primitive_desc_create(&pd, &dst_md, n,
+                    (int)aux_f("axis", 1), src_mds.data(), attr.get(),
+                    engine);
+        }
+    } else {
+        reason = "primitive kind is not supported";
+        return OK;
+    }
+
+    if (st == dnnl_unimplemented) {
+        reason = "no implementation found";
+        return OK;
+    }
+    DNN_SAFE(st, WARN);
+    return OK;
+}
+
+// Arguments a layer may take. Activation inputs may come from a previous
+// layer, everything else gets its own buffer.
+const int exec_args[] = {DNNL_ARG_SRC, DNNL_ARG_SRC_1, DNNL_ARG_WEIGHTS,
+        DNNL_ARG_BIAS, DNNL_ARG_MEAN, DNNL_ARG_VARIANCE, DNNL_ARG_WORKSPACE,
+        DNNL_ARG_SCRATCHPAD, DNNL_ARG_DST};
+
+bool is_activation_input(int arg) {
+    return arg == DNNL_ARG_SRC || arg == DNNL_ARG_SRC_1
+            || arg >= DNNL_ARG_MULTIPLE_SRC;
+}
+
+int fill_mem(dnn_mem_t &mem) {
+    if (mem.nelems() == 0) return OK;
+    dnn_mem_t mem_fp(mem.md_, dnnl_f32, get_abx_tag(mem.md_.ndims),
+            get_test_engine());
+    // small positive values keep every primitive away from special values
+    const int64_t n = mem_fp.nelems();
+    for (int64_t i = 0; i < n; ++i)
+        mem_fp.set_elem(i, ((i % 13) + 1) / 16.f);
+    SAFE(mem.reorder(mem_fp), WARN);
+    return OK;
+}
+
+// A replayed layer with its primitive and buffers
+struct layer_exec_t {
+    const layer_t *l;
+    dnnl_primitive_t prim {};
+    std::string impl;
+    args_t args;
+    std::vector<std::shared_ptr<dnn_mem_t>> mems;
+    benchdnn_timer_t timer;
+
+    ~layer_exec_t() { dnnl_primitive_destroy(prim); }
+};
+
+// Destination buffers of the layers created so far
+using produced_t = std::vector<
+        std::pair<dnnl_memory_desc_t, std::shared_ptr<dnn_mem_t>>>;
+
+int init_layer(layer_exec_t &le, produced_t &produced, const char *&reason) {
+    const layer_t &l = *le.l;
+    dnnl_primitive_desc_t pd {};
+    attr_args_t attr_args;
+    SAFE(init_pd(l, pd, attr_args, reason), WARN);
+    if (reason) return OK;
+
+    dnnl_status_t st = dnnl_primitive_create(&le.prim, pd);
+    le.impl = query_impl_info(pd);
+
+    std::vector<int> args(std::begin(exec_args), std::end(exec_args));
+    const int n_inputs = dnnl_primitive_desc_query_s32(
+            pd, dnnl_query_num_of_inputs_s32, 0);
+    for (int i = 0; i < n_inputs; ++i)
+        args.push_back(DNNL_ARG_MULTIPLE_SRC + i);
+
+    for (int arg : args) {
+        const dnnl_memory_desc_t &md = *dnnl_primitive_desc_query_md(
+                pd, dnnl_query_exec_arg_md, arg);
+        if (md.ndims == 0) continue;
+
+        std::shared_ptr<dnn_mem_t> mem;
+        if (is_activation_input(arg)) {
+            for (auto it = produced.rbegin(); it != produced.rend(); ++it)
+                if (dnnl_memory_desc_equal(&it->first, &md)) {
+                    mem = it->second;
+                    break;
+                }
+        }
+        if (!mem) {
+            mem = std::make_shared<dnn_mem_t>(md, get_test_engine());
+            if (arg != DNNL_ARG_SCRATCHPAD && arg != DNNL_ARG_WORKSPACE)
+                SAFE(fill_mem(*mem), WARN);
+        }
+        if (arg == DNNL_ARG_DST) produced.emplace_back(md, mem);
+
+        le.mems.push_back(mem);
+        le.args.set(arg, *mem);
+    }
+    dnnl_primitive_desc_destroy(pd);
+    DNN_SAFE(st, WARN);
+
+    // runtime attribute values get neutral values
+    if (attr_args.oscale_runtime) {
+        auto mem = std::make_shared<dnn_mem_t>(
+                1, shape_t {1}.data(), dnnl_f32, dnnl_x, get_test_engine());
+        mem->set_elem(0, 1.f);
+        le.mems.push_back(mem);
+        le.args.set(DNNL_ARG_ATTR_OUTPUT_SCALES, *mem);
+    }
+    for (int arg : attr_args.zp_runtime_args) {
+        auto mem = std::make_shared<dnn_mem_t>(
+                1, shape_t {1}.data(), dnnl_s32, dnnl_x, get_test_engine());
+        mem->set_elem(0, 0);
+        le.mems.push_back(mem);
+        le.args.set(DNNL_ARG_ATTR_ZERO_POINTS | arg, *mem);
+    }
+
+    return OK;
+}
+
+} // namespace
+
+int doit(const prb_t *p, res_t *r) {
+    if (bench_mode == LIST) return r->state = LISTED, OK;
+
+    std::vector<std::unique_ptr<layer_exec_t>> layers;
+    produced_t produced;
+    int n_skipped = p->n_skipped;
+    for (const auto &l : p->layers) {
+        std::unique_ptr<layer_exec_t> le(new layer_exec_t());
+        le->l = &l;
+        const char *reason = nullptr;
+        if (init_layer(*le, produced, reason) != OK)
+            reason = "layer cannot be created";
+        if (reason) {
+            BENCHDNN_PRINT(0, "WARNING: %s:%d: %s layer skipped (%s)\n",
+                    p->log.c_str(), l.line, l.kind.c_str(), reason);
+            n_skipped++;
+            continue;
+        }
+        layers.push_back(std::move(le));
+    }
+
+    if (layers.empty()) return r->state = SKIPPED, OK;
+    if (n_skipped)
+        BENCHDNN_PRINT(0, "WARNING: %d of %d logged layers are not replayed\n",
+                n_skipped, p->n_layers() + p->n_skipped);
+
+    // The first run passes the data through the whole model
+    for (const auto &le : layers)
+        SAFE(execute_and_wait(le->prim, le->args), WARN);
+
+    if (bench_mode & CORR) r->state = PASSED;
+
+    if (bench_mode & PERF) {
+        stream_t stream(get_test_engine());
+        std::vector<std::vector<dnnl_exec_arg_t>> dnnl_args(layers.size());
+        for (size_t i = 0; i < layers.size(); ++i)
+            execute_unmap_args(layers[i]->args, dnnl_args[i]);
+
+        benchdnn_timer_t &t = r->timer;
+        t.reset();
+        while (true) {
+            t.start();
+            for (size_t i = 0; i < layers.size(); ++i) {
+                auto &le = *layers[i];
+                le.timer.start();
+                DNN_SAFE(dnnl_primitive_execute(le.prim, stream,
+                                 (int)dnnl_args[i].size(), dnnl_args[i].data()),
+                        WARN);
+                DNN_SAFE(dnnl_stream_wait(stream), WARN);
+                le.timer.stamp();
+            }
+            t.stamp();
+            if (should_stop(t)) break;
+        }
+
+        for (const auto &le : layers)
+            execute_map_args(le->args);
+
+        // Per-layer breakdown, the implementation recorded in the log is
+        // shown if the replay picked a different one
+        const double total_ms = t.ms(benchdnn_timer_t::avg);
+        for (size_t i = 0; i < layers.size(); ++i) {
+            const auto &le = *layers[i];
+            const double avg_ms = le.timer.ms(benchdnn_timer_t::avg);
+            const bool same_impl = le.impl == le.l->impl;
+            BENCHDNN_PRINT(0,
+                    "layer:%d line:%d kind:%s impl:%s%s%s min(ms):%g "
+                    "avg(ms):%g log(ms):%g share:%.1f%% prb:%s\n",
+                    (int)i, le.l->line, le.l->kind.c_str(), le.impl.c_str(),
+                    same_impl ? "" : " log_impl:",
+                    same_impl ? "" : le.l->impl.c_str(), le.timer.ms(),
+                    avg_ms, le.l->log_ms,
+                    total_ms > 0 ? 100. * avg_ms / total_ms : 0.,
+                    le.l->prb.c_str());
+        }
+    }
+
+    return OK;
+}
+
+} // namespace model
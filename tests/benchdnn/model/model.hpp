@@ -0,0 +1,105 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef MODEL_HPP
+#define MODEL_HPP
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "dnnl.h"
+
+#include "common.hpp"
+#include "dnn_types.hpp"
+#include "dnnl_common.hpp"
+#include "dnnl_memory.hpp"
+#include "perf_report.hpp"
+
+namespace model {
+
+struct settings_t {
+    settings_t() = default;
+
+    // ctor to save certain fields from resetting
+    settings_t(const char *perf_template) : settings_t() {
+        this->perf_template = perf_template;
+    }
+
+    const char *perf_template_csv = "perf,%engine%,%DESC%,%-time%,%0time%";
+    const char *perf_template_def = "perf,%engine%,%prb%,%-time%,%0time%";
+    const char *perf_template = perf_template_def;
+
+    void reset() { *this = settings_t(perf_template); }
+};
+
+// A memory descriptor as printed by verbose, e.g. `src_f32::blocked:aBcd8b:f0`
+struct md_entry_t {
+    std::string name; // src, wei, bia, dst, data, diff, ws, ...
+    dnnl_data_type_t dt;
+    dnnl_format_tag_t tag; // dnnl_format_tag_any if cannot be reproduced
+    int mask; // broadcast mask of matmul bias
+};
+
+// A single `exec` line of a verbose log
+struct layer_t {
+    int line; // line number in the log, for messages
+    std::string kind;
+    std::string impl;
+    dnnl_prop_kind_t prop;
+    std::vector<md_entry_t> mds;
+    std::string attr;
+    std::string aux;
+    std::string prb;
+    double log_ms; // time reported in the log
+};
+
+struct prb_t {
+    prb_t(const std::string &log) : log(log) {}
+
+    std::string log;
+    std::vector<layer_t> layers;
+    int n_skipped = 0; // lines which cannot be replayed
+
+    int n_layers() const { return (int)layers.size(); }
+};
+std::ostream &operator<<(std::ostream &s, const prb_t &p);
+
+// Reads the log and fills the layers to replay on the target engine
+int read_log(prb_t *p);
+
+struct perf_report_t : public base_perf_report_t {
+    using base_perf_report_t::base_perf_report_t;
+
+    void report(const prb_t *p, const res_t *r, const char *prb_str) {
+        p_ = p;
+        base_report(r, prb_str);
+    }
+
+    void dump_desc(std::ostream &s) const override { s << p_->log; }
+
+    void dump_desc_csv(std::ostream &s) const override { s << p_->log; }
+
+private:
+    const prb_t *p_ = NULL;
+};
+
+int doit(const prb_t *p, res_t *res);
+int bench(int argc, char **argv);
+
+} // namespace model
+
+#endif
@@ -0,0 +1,152 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <fstream>
+#include <map>
+#include <sstream>
+
+#include "dnnl_debug.hpp"
+#include "model/model.hpp"
+
+namespace model {
+
+std::ostream &operator<<(std::ostream &s, const prb_t &p) {
+    dump_global_params(s);
+    s << p.log;
+    return s;
+}
+
+namespace {
+
+// str2fmt_tag() asserts on unknown names, while verbose prints any blocked
+// layout, so the tags are looked up among the known ones only.
+dnnl_format_tag_t str2known_tag(const std::string &str) {
+    static std::map<std::string, dnnl_format_tag_t> tags;
+    if (tags.empty()) {
+        for (int t = dnnl_format_tag_undef + 1; t < dnnl_format_tag_last; ++t) {
+            const dnnl_format_tag_t tag = (dnnl_format_tag_t)t;
+            tags.emplace(fmt_tag2str(tag), tag);
+        }
+    }
+    const auto it = tags.find(str);
+    return it == tags.end() ? dnnl_format_tag_any : it->second;
+}
+
+std::vector<std::string> split(const std::string &str, char delim) {
+    std::vector<std::string> tokens;
+    std::stringstream ss(str);
+    std::string token;
+    while (std::getline(ss, token, delim))
+        tokens.push_back(token);
+    return tokens;
+}
+
+// `name_dt:padding:format_kind:tag:flags[_maskN]`
+int str2md_entry(md_entry_t &e, const std::string &str) {
+    const auto fields = split(str, ':');
+    if (fields.size() < 4) return FAIL;
+
+    const auto &name_dt = fields[0];
+    const size_t pos = name_dt.rfind('_');
+    if (pos == std::string::npos) return FAIL;
+    e.name = name_dt.substr(0, pos);
+
+    const std::string dt = name_dt.substr(pos + 1);
+    e.dt = dnnl_data_type_undef;
+    for (auto d : {dnnl_f16, dnnl_bf16, dnnl_f32, dnnl_s32, dnnl_s8, dnnl_u8})
+        if (dt == dt2str(d)) e.dt = d;
+    if (e.dt == dnnl_data_type_undef) return FAIL;
+
+    // Extra flags (e.g. s8 weights compensation) cannot be requested through
+    // a tag, so the implementation is let to choose the layout.
+    const bool has_extra = fields.size() > 4 && fields[4].size() > 1
+            && strtol(fields[4].c_str() + 1, NULL, 16) != 0;
+    e.tag = fields[2] == "blocked" && !has_extra ? str2known_tag(fields[3])
+                                                 : dnnl_format_tag_any;
+
+    e.mask = 0;
+    const size_t mask_pos = str.find("_mask");
+    if (mask_pos != std::string::npos) e.mask = atoi(&str[mask_pos + 5]);
+    return OK;
+}
+
+dnnl_prop_kind_t str2prop(const std::string &str) {
+    if (str == "forward_training") return dnnl_forward_training;
+    if (str == "forward_inference") return dnnl_forward_inference;
+    if (str == "undef") return dnnl_prop_kind_undef;
+    return dnnl_backward;
+}
+
+} // namespace
+
+int read_log(prb_t *p) {
+    std::ifstream ifs(locate_batch_file(p->log));
+    SAFE(ifs.is_open() ? OK : FAIL, CRIT);
+
+    const std::string engine = engine_kind2str(engine_tgt_kind);
+
+    std::string str;
+    int line = 0;
+    while (std::getline(ifs, str)) {
+        ++line;
+        // dnnl_verbose,exec,engine,kind,impl,prop,mds,attr,aux,prb,time
+        const auto fields = split(str, ',');
+        if (fields.size() < 11 || fields[0] != "dnnl_verbose"
+                || fields[1] != "exec")
+            continue;
+
+        layer_t l;
+        l.line = line;
+        l.kind = fields[3];
+        l.impl = fields[4];
+        l.prop = str2prop(fields[5]);
+        l.attr = fields[7];
+        l.aux = fields[8];
+        l.prb = fields[9];
+        l.log_ms = atof(fields[10].c_str());
+
+        const char *reason = nullptr;
+        if (fields[2] != engine)
+            reason = "engine kind does not match the target engine";
+        else if (l.prop == dnnl_backward)
+            reason = "backward propagation is not supported";
+
+        for (const auto &md_str : split(fields[6], ' ')) {
+            if (reason || md_str.empty()) continue;
+            md_entry_t e;
+            if (str2md_entry(e, md_str) != OK)
+                reason = "memory descriptor cannot be parsed";
+            else
+                l.mds.push_back(e);
+        }
+
+        if (reason) {
+            BENCHDNN_PRINT(2, "%s:%d: skipped (%s)\n", p->log.c_str(), line,
+                    reason);
+            p->n_skipped++;
+            continue;
+        }
+
+        p->layers.push_back(l);
+    }
+
+    return OK;
+}
+
+} // namespace model
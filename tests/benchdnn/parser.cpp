@@ -248,6 +248,36 @@ static bool parse_fix_times_per_prb(
     return false;
 }
 
+static bool parse_cold_cache(
+        const char *str, const std::string &option_name = "cold-cache") {
+    return parse_single_value_option(cold_cache_mode, COLD_CACHE_NONE,
+            str2cold_cache_mode, str, option_name);
+}
+
+static bool parse_instances(
+        const char *str, const std::string &option_name = "instances") {
+    if (parse_single_value_option(instances, 1, atoi, str, option_name))
+        return instances = MAX2(1, instances), true;
+    return false;
+}
+
+static bool parse_threads_per_instance(const char *str,
+        const std::string &option_name = "threads-per-instance") {
+    if (parse_single_value_option(
+                threads_per_instance, 0, atoi, str, option_name))
+        return threads_per_instance = MAX2(0, threads_per_instance), true;
+    return false;
+}
+
+static bool parse_thread_sweep(
+        const char *str, const std::string &option_name = "thread-sweep") {
+    static const std::vector<int> def {};
+    auto str2nthr = [](const char *s) {
+        return strcmp(s, "auto") ? MAX2(1, atoi(s)) : 0;
+    };
+    return parse_vector_option(thread_sweep, def, str2nthr, str, option_name);
+}
+
 static bool parse_verbose(
         const char *str, const std::string &option_name = "verbose") {
     const std::string pattern("-v"); // check short option first
@@ -318,7 +348,9 @@ bool parse_bench_settings(const char *str) {
     last_parsed_is_problem = false; // if start parsing, expect an option
 
     return parse_bench_mode(str) || parse_max_ms_per_prb(str)
-            || parse_fix_times_per_prb(str) || parse_verbose(str)
+            || parse_fix_times_per_prb(str) || parse_cold_cache(str)
+            || parse_instances(str) || parse_threads_per_instance(str)
+            || parse_thread_sweep(str) || parse_verbose(str)
             || parse_engine_kind(str) || parse_fast_ref_gpu(str)
             || parse_canonical(str) || parse_mem_check(str)
             || parse_scratchpad_mode(str) || parse_attr_scratchpad_mode(str)
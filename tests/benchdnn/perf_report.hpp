@@ -65,6 +65,11 @@ struct base_perf_report_t {
 
         auto get_bw = [&]() -> double { return get_flops(); };
 
+        auto get_tput = [&]() -> double {
+            if (!r->instances_ms) return 0;
+            return r->instances_times / (r->instances_ms / 1e3) / unit;
+        };
+
         auto get_freq = [&]() -> double {
             if (!t.sec(mode)) return 0;
             return t.ticks(mode) / t.sec(mode) / unit;
@@ -101,6 +106,22 @@ struct base_perf_report_t {
         HANDLE("freq", s << get_freq());
         HANDLE("ops", s << ops() / unit);
         HANDLE("time", s << t.ms(mode) / unit);
+        HANDLE("p50", s << t.percentile(50) / unit);
+        HANDLE("p90", s << t.percentile(90) / unit);
+        HANDLE("p99", s << t.percentile(99) / unit);
+        HANDLE("p999", s << t.percentile(99.9) / unit);
+        HANDLE("stddev", s << t.stddev() / unit);
+        HANDLE("outliers", s << t.outliers());
+        HANDLE("hist", {
+            const auto bins = t.histogram(10);
+            for (size_t b = 0; b < bins.size(); ++b)
+                s << (b ? ":" : "") << bins[b];
+        });
+        HANDLE("ctime", s << r->cold_timer.ms(mode) / unit);
+        HANDLE("tput", s << get_tput());
+        HANDLE("bnthr", s << r->sweep_best_nthr);
+        HANDLE("speedup", s << r->sweep_speedup);
+        HANDLE("eff", s << r->sweep_eff);
         HANDLE("impl", s << r->impl_name);
 
 #undef HANDLE
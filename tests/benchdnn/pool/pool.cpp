@@ -350,7 +350,7 @@ int doit(const prb_t *p, res_t *r) {
         }
     }
 
-    measure_perf(r->timer, pp, args);
+    measure_perf(r, pp, args);
 
     DNN_SAFE_V(dnnl_primitive_destroy(pp));
 
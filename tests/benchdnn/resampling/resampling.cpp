@@ -295,7 +295,7 @@ int doit(const prb_t *p, res_t *r) {
         }
     }
 
-    measure_perf(r->timer, rp, args);
+    measure_perf(r, rp, args);
 
     DNN_SAFE_V(dnnl_primitive_destroy(rp));
 
@@ -967,7 +967,7 @@ int doit(const prb_t &p, res_t *r) {
         }
     }
 
-    measure_perf(r->timer, c, args);
+    measure_perf(r, c, args);
     cleanup();
 
     return OK;
@@ -207,7 +207,7 @@ int doit(const prb_t *p, res_t *r) {
         SAFE(compare(p, dst_fp, data, r), WARN);
     }
 
-    measure_perf(r->timer, s, args);
+    measure_perf(r, s, args);
 
     DNN_SAFE_V(dnnl_primitive_destroy(s));
 
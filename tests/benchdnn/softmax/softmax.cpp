@@ -297,7 +297,7 @@ int doit(const prb_t *p, res_t *r) {
         }
     }
 
-    measure_perf(r->timer, s, args);
+    measure_perf(r, s, args);
 
     DNN_SAFE_V(dnnl_primitive_destroy(s));
 
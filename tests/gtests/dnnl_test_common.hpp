@@ -633,6 +633,8 @@ struct allows_attr_t {
     bool po_eltwise;
     bool zp;
     bool scales;
+    // Scales of floating-point data, e.g. of the softmax source
+    bool fp_scales;
 };
 
 using engine = dnnl::engine;
@@ -692,8 +694,8 @@ void test_fwd_pd_attr_zp(
 }
 
 template <typename op_desc_t, typename pd_t>
-void test_fwd_pd_attr_scales(
-        const op_desc_t &op_desc, const engine &eng, bool supports_scales) {
+void test_fwd_pd_attr_scales(const op_desc_t &op_desc, const engine &eng,
+        bool supports_scales, bool supports_fp_scales = false) {
     using dt_t = memory::data_type;
 
     dnnl::primitive_attr attr_scales;
@@ -704,8 +706,9 @@ void test_fwd_pd_attr_scales(
     const bool dt_is_integral
             = dt == dt_t::s32 || dt == dt_t::s8 || dt == dt_t::u8;
 
-    // Scales are supposed to work on int8 data type only.
-    if (supports_scales && dt_is_integral) {
+    // Scales are supposed to work on int8 data type only, unless the
+    // primitive scales floating-point data explicitly.
+    if (supports_scales && (dt_is_integral || supports_fp_scales)) {
         EXPECT_NO_THROW(pd_t pd(op_desc, attr_scales, eng));
 
         // Check oscale and scales don't work together
@@ -743,7 +746,8 @@ void test_fwd_pd_constructors(
     test_fwd_pd_attr_po_sum<op_desc_t, pd_t>(op_desc, eng, aa.po_sum);
     test_fwd_pd_attr_po_eltwise<op_desc_t, pd_t>(op_desc, eng, aa.po_eltwise);
     test_fwd_pd_attr_zp<op_desc_t, pd_t>(op_desc, eng, aa.zp);
-    test_fwd_pd_attr_scales<op_desc_t, pd_t>(op_desc, eng, aa.scales);
+    test_fwd_pd_attr_scales<op_desc_t, pd_t>(
+            op_desc, eng, aa.scales, aa.fp_scales);
     // check allow empty, should not throw
     test_fwd_pd_allow_empty<op_desc_t, pd_t>(test_pd);
 }
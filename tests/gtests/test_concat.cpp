@@ -18,6 +18,7 @@
 #include "gtest/gtest.h"
 
 #include "dnnl.hpp"
+#include "src/cpu/simple_concat.hpp"
 
 namespace dnnl {
 
@@ -391,4 +392,120 @@ GPU_INSTANTIATE_TEST_SUITE_P(TestConcat, concat_test_float, cases_concat_gpu());
 GPU_INSTANTIATE_TEST_SUITE_P(
         TestConcat, concat_test_float16, cases_concat_gpu());
 
+TEST(concat_in_place_test, TestSrcImages) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "In-place sources are skipped by CPU implementations only");
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+
+    std::vector<memory::desc> srcs_md {
+            memory::desc({2, 16, 3, 3}, dt::f32, tag::nchw),
+            memory::desc({2, 32, 3, 3}, dt::f32, tag::nchw)};
+    auto concat_pd = concat::primitive_desc(
+            memory::desc({2, 48, 3, 3}, dt::f32, tag::nchw), 1, srcs_md, eng);
+
+    auto dst = memory(concat_pd.dst_desc(), eng);
+    const size_t nelems = dst.get_desc().get_size() / sizeof(float);
+    {
+        auto dst_ptr = map_memory<float>(dst);
+        for (size_t i = 0; i < nelems; ++i)
+            dst_ptr[i] = (float)i;
+    }
+
+    // The producers are supposed to have written the sources to their images
+    std::unordered_map<int, memory> args = {{DNNL_ARG_DST, dst}};
+    for (int i = 0; i < (int)srcs_md.size(); ++i) {
+        const auto image_md = concat_pd.src_image_desc(i);
+        ASSERT_NE(image_md, memory::desc());
+        args.insert({DNNL_ARG_MULTIPLE_SRC + i,
+                memory(image_md, eng, dst.get_data_handle())});
+    }
+    concat(concat_pd).execute(strm, args);
+    strm.wait();
+
+    auto dst_ptr = map_memory<float>(dst);
+    for (size_t i = 0; i < nelems; ++i)
+        ASSERT_EQ(dst_ptr[i], (float)i);
+}
+
+TEST(concat_in_place_test, TestSrcImageLayoutMismatch) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "In-place sources are skipped by CPU implementations only");
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+
+    std::vector<memory::desc> srcs_md {
+            memory::desc({2, 16, 3, 3}, dt::f32, tag::nchw),
+            memory::desc({2, 32, 3, 3}, dt::f32, tag::nchw)};
+    auto concat_pd = concat::primitive_desc(
+            memory::desc({2, 48, 3, 3}, dt::f32, tag::nchw), 1, srcs_md, eng);
+    auto dst = memory(concat_pd.dst_desc(), eng);
+
+    // The first source is at its image, but is not laid out as the image
+    std::unordered_map<int, memory> args = {{DNNL_ARG_DST, dst},
+            {DNNL_ARG_MULTIPLE_SRC,
+                    memory(memory::desc({2, 16, 3, 3}, dt::f32, tag::nhwc), eng,
+                            dst.get_data_handle())},
+            {DNNL_ARG_MULTIPLE_SRC + 1, memory(srcs_md[1], eng)}};
+    EXPECT_ANY_THROW(concat(concat_pd).execute(strm, args));
+}
+
+TEST(concat_nt_stores_test, TestMatchesRegularCopy) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Non-temporal stores are used by CPU implementations only");
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+
+    // The sizes of the copied chunks are not multiples of a vector, and the
+    // chunks of the second source are not aligned in the destination
+    std::vector<memory::desc> srcs_md {
+            memory::desc({3, 17, 5, 7}, dt::f32, tag::nchw),
+            memory::desc({3, 9, 5, 7}, dt::f32, tag::nchw)};
+    const memory::desc dst_md({3, 26, 5, 7}, dt::f32, tag::nchw);
+
+    std::unordered_map<int, memory> args;
+    for (int i = 0; i < (int)srcs_md.size(); ++i) {
+        auto src = memory(srcs_md[i], eng);
+        fill_data<float>(
+                srcs_md[i].get_size() / sizeof(float), src, float(i), 1.f);
+        args.insert({DNNL_ARG_MULTIPLE_SRC + i, src});
+    }
+
+    // The primitives differ only in the threshold, so they must not be
+    // taken from the cache
+    const int capacity = get_primitive_cache_capacity();
+    set_primitive_cache_capacity(0);
+
+    auto run = [&](ptrdiff_t threshold) {
+        impl::cpu::concat_utils::set_nt_stores_threshold(threshold);
+        auto concat_pd = concat::primitive_desc(dst_md, 1, srcs_md, eng);
+        impl::cpu::concat_utils::set_nt_stores_threshold(-1);
+
+        auto dst = memory(concat_pd.dst_desc(), eng);
+        args[DNNL_ARG_DST] = dst;
+        concat(concat_pd).execute(strm, args);
+        strm.wait();
+        return dst;
+    };
+    auto dst_nt = run(0);
+    auto dst = run(-1);
+
+    set_primitive_cache_capacity(capacity);
+
+    const size_t nelems = dst_md.get_size() / sizeof(float);
+    auto dst_nt_ptr = map_memory<const float>(dst_nt);
+    auto dst_ptr = map_memory<const float>(dst);
+    for (size_t i = 0; i < nelems; ++i)
+        ASSERT_EQ(dst_nt_ptr[i], dst_ptr[i]);
+}
+
 } // namespace dnnl
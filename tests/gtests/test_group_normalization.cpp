@@ -0,0 +1,419 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "dnnl.hpp"
+
+namespace dnnl {
+
+struct test_gnorm_params_t {
+    memory::format_tag data_tag;
+    memory::dims dims;
+    memory::dim groups;
+    float epsilon;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+class gnorm_test : public ::testing::TestWithParam<test_gnorm_params_t> {
+private:
+    std::shared_ptr<test_memory> src, dst, diff_src, diff_dst;
+    memory weights, diff_weights, mean, variance;
+
+    std::shared_ptr<memory::desc> data_d;
+
+    group_normalization_forward::primitive_desc gnorm_fwd_pd;
+    group_normalization_backward::primitive_desc gnorm_bwd_pd;
+
+    test_gnorm_params_t p;
+    engine eng;
+    stream strm;
+
+    memory::dim N, C, G, C_per_G, SP;
+
+protected:
+    virtual void SetUp() {
+        p = ::testing::TestWithParam<decltype(p)>::GetParam();
+        catch_expected_failures(
+                [=]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    void Test() {
+        eng = get_test_engine();
+        strm = make_stream(eng);
+
+        N = p.dims[0];
+        C = p.dims[1];
+        G = p.groups;
+        C_per_G = G > 0 ? C / G : 0;
+        SP = std::accumulate(p.dims.begin() + 2, p.dims.end(),
+                memory::dim(1), std::multiplies<memory::dim>());
+
+        data_d.reset(
+                new memory::desc(p.dims, memory::data_type::f32, p.data_tag));
+
+        src.reset(new test_memory(*data_d, eng));
+        dst.reset(new test_memory(*data_d, eng));
+        diff_src.reset(new test_memory(*data_d, eng));
+        diff_dst.reset(new test_memory(*data_d, eng));
+
+        auto training = prop_kind::forward_training;
+        auto inference = prop_kind::forward_inference;
+
+        using flags = normalization_flags;
+        Forward(training);
+        Forward(training, flags::use_global_stats);
+        Forward(training, flags::use_scale_shift);
+        Forward(inference);
+        Forward(inference, flags::use_scale_shift | flags::use_global_stats);
+
+        Backward(prop_kind::backward_data);
+        Backward(prop_kind::backward_data, flags::use_global_stats);
+        Backward(prop_kind::backward, flags::use_scale_shift);
+        Backward(prop_kind::backward,
+                flags::use_scale_shift | flags::use_global_stats);
+    }
+
+    void Forward(prop_kind pk,
+            normalization_flags flags = normalization_flags::none) {
+        const bool use_scale_shift
+                = (bool)(flags & normalization_flags::use_scale_shift);
+        const bool use_global_stats
+                = (bool)(flags & normalization_flags::use_global_stats);
+        const bool is_training = pk == prop_kind::forward_training;
+
+        auto gnorm_fwd_d = group_normalization_forward::desc(
+                pk, *data_d, p.groups, p.epsilon, flags);
+        gnorm_fwd_pd
+                = group_normalization_forward::primitive_desc(gnorm_fwd_d, eng);
+        gnorm_fwd_pd = group_normalization_forward::primitive_desc(
+                gnorm_fwd_pd.get()); // test construction from a C pd
+
+        ASSERT_TRUE(gnorm_fwd_pd.query_md(query::exec_arg_md, DNNL_ARG_SRC)
+                == gnorm_fwd_pd.src_desc());
+        ASSERT_TRUE(gnorm_fwd_pd.query_md(query::exec_arg_md, DNNL_ARG_DST)
+                == gnorm_fwd_pd.dst_desc());
+        ASSERT_TRUE(gnorm_fwd_pd.query_md(
+                            query::exec_arg_md, DNNL_ARG_SCALE_SHIFT)
+                == gnorm_fwd_pd.weights_desc());
+
+        const memory::desc stat_d({N, G}, memory::data_type::f32,
+                memory::format_tag::ab);
+        if (is_training || use_global_stats) {
+            EXPECT_EQ(gnorm_fwd_pd.mean_desc(), stat_d);
+            EXPECT_EQ(gnorm_fwd_pd.variance_desc(), stat_d);
+        }
+
+        weights = memory(gnorm_fwd_pd.weights_desc(), eng);
+        mean = memory(stat_d, eng);
+        variance = memory(stat_d, eng);
+
+        fill_data<float>(src->get_size() / sizeof(float), src->get());
+        fill_data<float>(dst->get_size() / sizeof(float), dst->get());
+        if (use_scale_shift) fill_data<float>(2 * C, weights);
+        if (use_global_stats) fill_stats();
+
+        std::unordered_map<int, memory> args = {
+                {DNNL_ARG_SRC, src->get()},
+                {DNNL_ARG_DST, dst->get()},
+        };
+        if (use_scale_shift) args.insert({DNNL_ARG_SCALE_SHIFT, weights});
+        if (is_training || use_global_stats) {
+            args.insert({DNNL_ARG_MEAN, mean});
+            args.insert({DNNL_ARG_VARIANCE, variance});
+        }
+        group_normalization_forward(gnorm_fwd_pd).execute(strm, args);
+        strm.wait();
+
+        check_gnorm_fwd(flags, is_training);
+    }
+
+    void Backward(prop_kind pk,
+            normalization_flags flags = normalization_flags::none) {
+        const bool use_scale_shift
+                = (bool)(flags & normalization_flags::use_scale_shift);
+
+        auto gnorm_fwd_d = group_normalization_forward::desc(
+                prop_kind::forward_training, *data_d, p.groups, p.epsilon,
+                flags);
+        gnorm_fwd_pd
+                = group_normalization_forward::primitive_desc(gnorm_fwd_d, eng);
+
+        auto gnorm_bwd_d = group_normalization_backward::desc(
+                pk, *data_d, *data_d, p.groups, p.epsilon, flags);
+        gnorm_bwd_pd = group_normalization_backward::primitive_desc(
+                gnorm_bwd_d, eng, gnorm_fwd_pd);
+        gnorm_bwd_pd = group_normalization_backward::primitive_desc(
+                gnorm_bwd_pd.get()); // test construction from a C pd
+
+        ASSERT_TRUE(gnorm_bwd_pd.query_md(query::exec_arg_md, DNNL_ARG_DIFF_SRC)
+                == gnorm_bwd_pd.diff_src_desc());
+        ASSERT_TRUE(gnorm_bwd_pd.query_md(query::exec_arg_md, DNNL_ARG_MEAN)
+                == gnorm_bwd_pd.mean_desc());
+        ASSERT_TRUE(gnorm_bwd_pd.query_md(
+                            query::exec_arg_md, DNNL_ARG_DIFF_SCALE_SHIFT)
+                == gnorm_bwd_pd.diff_weights_desc());
+
+        weights = memory(gnorm_bwd_pd.weights_desc(), eng);
+        diff_weights = memory(gnorm_bwd_pd.diff_weights_desc(), eng);
+        mean = memory(gnorm_bwd_pd.mean_desc(), eng);
+        variance = memory(gnorm_bwd_pd.variance_desc(), eng);
+
+        fill_data<float>(src->get_size() / sizeof(float), src->get());
+        fill_data<float>(diff_dst->get_size() / sizeof(float), diff_dst->get());
+        if (use_scale_shift) fill_data<float>(2 * C, weights);
+        fill_stats();
+
+        std::unordered_map<int, memory> args = {
+                {DNNL_ARG_SRC, src->get()},
+                {DNNL_ARG_DIFF_DST, diff_dst->get()},
+                {DNNL_ARG_MEAN, mean},
+                {DNNL_ARG_VARIANCE, variance},
+                {DNNL_ARG_DIFF_SRC, diff_src->get()},
+        };
+        if (use_scale_shift) {
+            args.insert({DNNL_ARG_SCALE_SHIFT, weights});
+            if (pk == prop_kind::backward)
+                args.insert({DNNL_ARG_DIFF_SCALE_SHIFT, diff_weights});
+        }
+        group_normalization_backward(gnorm_bwd_pd).execute(strm, args);
+        strm.wait();
+
+        check_gnorm_bwd(flags, pk);
+    }
+
+    // The mean and the variance are taken from the actual source, so the
+    // results are well conditioned
+    void fill_stats() {
+        auto src_data = map_memory<const float>(src->get());
+        auto mean_data = map_memory<float>(mean);
+        auto variance_data = map_memory<float>(variance);
+        const dnnl::impl::memory_desc_wrapper src_mdw(data_d->data);
+        for (memory::dim n = 0; n < N; ++n)
+            for (memory::dim g = 0; g < G; ++g) {
+                float m = 0, v = 0;
+                for_group(n, g, [&](memory::dim l_off) {
+                    m += src_data[src_mdw.off_l(l_off)];
+                });
+                m /= C_per_G * SP;
+                for_group(n, g, [&](memory::dim l_off) {
+                    const float d = src_data[src_mdw.off_l(l_off)] - m;
+                    v += d * d;
+                });
+                mean_data[n * G + g] = m;
+                variance_data[n * G + g] = v / (C_per_G * SP);
+            }
+    }
+
+    template <typename F>
+    void for_group(memory::dim n, memory::dim g, F f) const {
+        for (memory::dim c = g * C_per_G; c < (g + 1) * C_per_G; ++c)
+            for (memory::dim sp = 0; sp < SP; ++sp)
+                f((n * C + c) * SP + sp);
+    }
+
+    void check_gnorm_fwd(normalization_flags flags, bool is_training) {
+        const bool use_weights
+                = (bool)(flags & normalization_flags::use_scale_shift);
+        const bool calculate_stats
+                = !(bool)(flags & normalization_flags::use_global_stats);
+
+        auto src_data = map_memory<const float>(src->get());
+        auto dst_data = map_memory<const float>(dst->get());
+        auto weights_data = map_memory<const float>(weights);
+        auto mean_data = map_memory<const float>(mean);
+        auto variance_data = map_memory<const float>(variance);
+        const dnnl::impl::memory_desc_wrapper src_mdw(data_d->data);
+
+        const float eps = static_cast<float>(1.e-4 * C_per_G * SP);
+        dnnl::impl::parallel_nd(N, G, [&](memory::dim n, memory::dim g) {
+            if (is_current_test_failed()) return;
+            float ref_mean = 0, ref_variance = 0;
+            if (calculate_stats) {
+                for_group(n, g, [&](memory::dim l_off) {
+                    ref_mean += src_data[src_mdw.off_l(l_off)];
+                });
+                ref_mean /= C_per_G * SP;
+                for_group(n, g, [&](memory::dim l_off) {
+                    const float d = src_data[src_mdw.off_l(l_off)] - ref_mean;
+                    ref_variance += d * d;
+                });
+                ref_variance /= C_per_G * SP;
+
+                if (is_training) {
+                    ASSERT_NEAR(mean_data[n * G + g], ref_mean, eps);
+                    float norm_max = std::max(
+                            std::abs(variance_data[n * G + g]), ref_variance);
+                    if (norm_max < eps) norm_max = 1.f;
+                    ASSERT_NEAR((variance_data[n * G + g] - ref_variance)
+                                    / norm_max,
+                            0., eps);
+                }
+            } else {
+                ref_mean = mean_data[n * G + g];
+                ref_variance = variance_data[n * G + g];
+            }
+
+            const float inv_std = 1.f / std::sqrt(ref_variance + p.epsilon);
+            for (memory::dim c = g * C_per_G; c < (g + 1) * C_per_G; ++c) {
+                const float gamma = use_weights ? weights_data[c] : 1.f;
+                const float beta = use_weights ? weights_data[C + c] : 0.f;
+                for (memory::dim sp = 0; sp < SP; ++sp) {
+                    const auto off = src_mdw.off_l((n * C + c) * SP + sp);
+                    const float ref_dst
+                            = gamma * (src_data[off] - ref_mean) * inv_std
+                            + beta;
+                    const float out = dst_data[off];
+                    float norm_max = std::max(std::abs(out), std::abs(ref_dst));
+                    if (norm_max < 1e-2) norm_max = 1.f;
+                    ASSERT_NEAR((out - ref_dst) / norm_max, 0., eps);
+                }
+            }
+        });
+    }
+
+    void check_gnorm_bwd(normalization_flags flags, prop_kind pk) {
+        const bool use_weights
+                = (bool)(flags & normalization_flags::use_scale_shift);
+        const bool calculate_diff_stats
+                = !(bool)(flags & normalization_flags::use_global_stats);
+
+        auto src_data = map_memory<const float>(src->get());
+        auto diff_dst_data = map_memory<const float>(diff_dst->get());
+        auto diff_src_data = map_memory<const float>(diff_src->get());
+        auto weights_data = map_memory<const float>(weights);
+        auto diff_weights_data = map_memory<const float>(diff_weights);
+        auto mean_data = map_memory<const float>(mean);
+        auto variance_data = map_memory<const float>(variance);
+        const dnnl::impl::memory_desc_wrapper src_mdw(data_d->data);
+
+        auto inv_std = [&](memory::dim n, memory::dim g) {
+            return 1.f / std::sqrt(variance_data[n * G + g] + p.epsilon);
+        };
+
+        const float eps = static_cast<float>(1.e-4 * N * SP);
+        if (pk == prop_kind::backward) {
+            dnnl::impl::parallel_nd(C, [&](memory::dim c) {
+                if (is_current_test_failed()) return;
+                const memory::dim g = c / C_per_G;
+                float ref_diff_gamma = 0, ref_diff_beta = 0;
+                for (memory::dim n = 0; n < N; ++n)
+                    for (memory::dim sp = 0; sp < SP; ++sp) {
+                        const auto off = src_mdw.off_l((n * C + c) * SP + sp);
+                        const float dd = diff_dst_data[off];
+                        ref_diff_gamma += dd
+                                * (src_data[off] - mean_data[n * G + g])
+                                * inv_std(n, g);
+                        ref_diff_beta += dd;
+                    }
+
+                float norm_max = std::max(std::abs(diff_weights_data[c]),
+                        std::abs(ref_diff_gamma));
+                if (norm_max < 1e-2) norm_max = 1.f;
+                ASSERT_NEAR((diff_weights_data[c] - ref_diff_gamma) / norm_max,
+                        0., eps);
+                norm_max = std::max(std::abs(diff_weights_data[C + c]),
+                        std::abs(ref_diff_beta));
+                if (norm_max < 1e-2) norm_max = 1.f;
+                ASSERT_NEAR((diff_weights_data[C + c] - ref_diff_beta)
+                                / norm_max,
+                        0., eps);
+            });
+        }
+
+        const memory::dim M = C_per_G * SP;
+        dnnl::impl::parallel_nd(N, G, [&](memory::dim n, memory::dim g) {
+            if (is_current_test_failed()) return;
+            const float v_mean = mean_data[n * G + g];
+            const float v_inv_std = inv_std(n, g);
+            auto gamma = [&](memory::dim l_off) {
+                return use_weights ? weights_data[l_off / SP % C] : 1.f;
+            };
+
+            float dd_gamma = 0, dd_gamma_x = 0;
+            if (calculate_diff_stats) {
+                for_group(n, g, [&](memory::dim l_off) {
+                    const auto off = src_mdw.off_l(l_off);
+                    dd_gamma += diff_dst_data[off] * gamma(l_off);
+                    dd_gamma_x += diff_dst_data[off] * gamma(l_off)
+                            * (src_data[off] - v_mean);
+                });
+                dd_gamma_x *= v_inv_std;
+            }
+
+            const float eps_n = static_cast<float>(1.e-4 * M);
+            for_group(n, g, [&](memory::dim l_off) {
+                if (is_current_test_failed()) return;
+                const auto off = src_mdw.off_l(l_off);
+                float ref_diff_src = diff_dst_data[off] * gamma(l_off);
+                if (calculate_diff_stats)
+                    ref_diff_src -= dd_gamma / M
+                            + (src_data[off] - v_mean) * dd_gamma_x
+                                    * v_inv_std / M;
+                ref_diff_src *= v_inv_std;
+                const float out = diff_src_data[off];
+                float norm_max
+                        = std::max(std::abs(out), std::abs(ref_diff_src));
+                if (norm_max < eps_n) norm_max = 1.f;
+                ASSERT_NEAR((out - ref_diff_src) / norm_max, 0., eps_n);
+            });
+        });
+    }
+};
+
+TEST_P(gnorm_test, TestsGnormF32) {}
+
+#define EPS 1e-5f
+
+#define PARAMS(tag, groups, ...) \
+    test_gnorm_params_t { \
+        memory::format_tag::tag, {__VA_ARGS__}, groups, EPS, false, \
+                dnnl_success \
+    }
+
+#define PARAMS_EF(tag, groups, ...) \
+    test_gnorm_params_t { \
+        memory::format_tag::tag, {__VA_ARGS__}, groups, EPS, true, \
+                dnnl_invalid_arguments \
+    }
+
+#define CPU_INST_TEST_CASE(str, ...) \
+    CPU_INSTANTIATE_TEST_SUITE_P( \
+            str, gnorm_test, ::testing::Values(__VA_ARGS__));
+
+CPU_INST_TEST_CASE(TestGnormEF, PARAMS_EF(nchw, 3, 2, 8, 4, 4),
+        PARAMS_EF(nchw, 0, 2, 8, 4, 4), PARAMS_EF(nchw, 16, 2, 8, 4, 4));
+
+CPU_INST_TEST_CASE(TestGnormNC, PARAMS(nc, 1, 3, 32), PARAMS(nc, 4, 3, 32),
+        PARAMS(nc, 32, 3, 32));
+
+CPU_INST_TEST_CASE(TestGnormNCSP, PARAMS(ncw, 2, 2, 6, 7),
+        PARAMS(nchw, 1, 2, 16, 5, 5), PARAMS(nchw, 4, 2, 16, 5, 5),
+        PARAMS(nchw, 16, 2, 16, 5, 5), PARAMS(ncdhw, 4, 2, 8, 3, 4, 5));
+
+CPU_INST_TEST_CASE(TestGnormNSPC, PARAMS(nwc, 2, 2, 6, 7),
+        PARAMS(nhwc, 1, 2, 16, 5, 5), PARAMS(nhwc, 4, 2, 16, 5, 5),
+        PARAMS(nhwc, 16, 2, 16, 5, 5), PARAMS(ndhwc, 4, 2, 8, 3, 4, 5),
+        PARAMS(nhwc, 8, 3, 64, 32, 40));
+
+CPU_INST_TEST_CASE(TestGnormBlocked, PARAMS(nChw16c, 4, 2, 32, 5, 5),
+        PARAMS(nChw8c, 2, 2, 20, 3, 3));
+
+} // namespace dnnl
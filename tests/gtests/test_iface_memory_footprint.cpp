@@ -0,0 +1,83 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <string>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "dnnl.hpp"
+
+namespace dnnl {
+
+class memory_footprint_test : public ::testing::Test {
+protected:
+    convolution_forward::primitive_desc conv_pd(
+            const engine &eng, const primitive_attr &attr) const {
+        using tag = memory::format_tag;
+        using dt = memory::data_type;
+        memory::desc src_md({2, 16, 10, 10}, dt::f32, tag::any);
+        memory::desc wei_md({32, 16, 3, 3}, dt::f32, tag::any);
+        memory::desc dst_md({2, 32, 8, 8}, dt::f32, tag::any);
+        auto desc = convolution_forward::desc(prop_kind::forward_training,
+                algorithm::convolution_direct, src_md, wei_md, dst_md, {1, 1},
+                {0, 0}, {0, 0});
+        return convolution_forward::primitive_desc(desc, attr, eng);
+    }
+};
+
+TEST_F(memory_footprint_test, TestInvalidArguments) {
+    dnnl_memory_footprint_t footprint;
+    ASSERT_EQ(dnnl_get_memory_footprint(nullptr), dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_primitive_get_memory_footprint(nullptr, &footprint),
+            dnnl_invalid_arguments);
+}
+
+TEST_F(memory_footprint_test, TestPrimitive) {
+    auto eng = get_test_engine();
+    primitive_attr attr;
+    attr.set_scratchpad_mode(scratchpad_mode::user);
+    auto pd = conv_pd(eng, attr);
+    auto conv = convolution_forward(pd);
+
+    const auto footprint = conv.get_memory_footprint();
+    ASSERT_EQ(footprint.scratchpad_size, pd.scratchpad_desc().get_size());
+    ASSERT_EQ(footprint.peak_size,
+            footprint.scratchpad_size + footprint.jit_code_size
+                    + footprint.constant_size);
+
+    const std::string impl = pd.impl_info_str();
+    if (get_test_engine_kind() == engine::kind::cpu
+            && impl.find("jit") == 0) {
+        ASSERT_GT(footprint.jit_code_size, 0u);
+    }
+}
+
+TEST_F(memory_footprint_test, TestGlobal) {
+    auto eng = get_test_engine();
+    auto conv = convolution_forward(conv_pd(eng, primitive_attr()));
+
+    const auto footprint = get_memory_footprint();
+    ASSERT_GE(footprint.peak_size,
+            footprint.scratchpad_size + footprint.jit_code_size
+                    + footprint.constant_size);
+    if (get_test_engine_kind() == engine::kind::cpu) {
+        ASSERT_GE(footprint.jit_code_size,
+                conv.get_memory_footprint().jit_code_size);
+    }
+}
+
+} // namespace dnnl
@@ -0,0 +1,123 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "dnnl.hpp"
+
+namespace dnnl {
+
+class primitive_tuning_test : public ::testing::Test {
+protected:
+    const std::string fname = "dnnl_test_tuning.csv";
+
+    void SetUp() override {
+        std::remove(fname.c_str());
+        ASSERT_EQ(set_primitive_tuning_file(fname), status::success);
+    }
+
+    void TearDown() override {
+        set_primitive_tuning(0);
+        std::remove(fname.c_str());
+    }
+
+    convolution_forward::desc conv_desc() const {
+        using tag = memory::format_tag;
+        using dt = memory::data_type;
+        memory::desc src_md({2, 16, 10, 10}, dt::f32, tag::any);
+        memory::desc wei_md({32, 16, 3, 3}, dt::f32, tag::any);
+        memory::desc dst_md({2, 32, 8, 8}, dt::f32, tag::any);
+        return convolution_forward::desc(prop_kind::forward_inference,
+                algorithm::convolution_direct, src_md, wei_md, dst_md,
+                {1, 1}, {0, 0}, {0, 0});
+    }
+
+    std::vector<std::string> read_lines() const {
+        std::vector<std::string> lines;
+        std::ifstream ifs(fname);
+        std::string line;
+        while (std::getline(ifs, line))
+            lines.push_back(line);
+        return lines;
+    }
+};
+
+TEST_F(primitive_tuning_test, TestInvalidMode) {
+    ASSERT_EQ(set_primitive_tuning(3), status::invalid_arguments);
+    ASSERT_EQ(set_primitive_tuning(-1), status::invalid_arguments);
+}
+
+TEST_F(primitive_tuning_test, TestTuneAndReplay) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Tuning is supported for CPU engine only");
+    auto eng = get_test_engine();
+
+    ASSERT_EQ(set_primitive_tuning(1), status::success);
+    auto tuned_pd = convolution_forward::primitive_desc(conv_desc(), eng);
+    const std::string tuned_impl = tuned_pd.impl_info_str();
+
+    auto lines = read_lines();
+    ASSERT_EQ(lines.size(), 1u);
+    ASSERT_NE(lines[0].find("," + tuned_impl + ","), std::string::npos);
+
+    // The problem is known, so it is not tuned again
+    auto cached_pd = convolution_forward::primitive_desc(conv_desc(), eng);
+    ASSERT_EQ(tuned_impl, cached_pd.impl_info_str());
+    ASSERT_EQ(read_lines().size(), 1u);
+
+    // The decision is read back from the file
+    ASSERT_EQ(set_primitive_tuning_file(fname), status::success);
+    ASSERT_EQ(set_primitive_tuning(2), status::success);
+    auto replayed_pd = convolution_forward::primitive_desc(conv_desc(), eng);
+    ASSERT_EQ(tuned_impl, replayed_pd.impl_info_str());
+}
+
+TEST_F(primitive_tuning_test, TestForcedImpl) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Tuning is supported for CPU engine only");
+    auto eng = get_test_engine();
+
+    auto pd = convolution_forward::primitive_desc(conv_desc(), eng);
+    const std::string first_impl = pd.impl_info_str();
+    std::string other_impl;
+    while (other_impl.empty() && pd.next_impl())
+        if (first_impl != pd.impl_info_str()) other_impl = pd.impl_info_str();
+    SKIP_IF(other_impl.empty(), "A single implementation is available");
+
+    // Tune to learn the key, then replace the decision
+    ASSERT_EQ(set_primitive_tuning(1), status::success);
+    convolution_forward::primitive_desc(conv_desc(), eng);
+    auto lines = read_lines();
+    ASSERT_EQ(lines.size(), 1u);
+    const std::string key = lines[0].substr(0, lines[0].find(','));
+    {
+        std::ofstream ofs(fname, std::ios::app);
+        ofs << key << "," << other_impl << ",forced" << std::endl;
+    }
+
+    ASSERT_EQ(set_primitive_tuning_file(fname), status::success);
+    ASSERT_EQ(set_primitive_tuning(2), status::success);
+    auto forced_pd = convolution_forward::primitive_desc(conv_desc(), eng);
+    ASSERT_EQ(other_impl, forced_pd.impl_info_str());
+}
+
+} // namespace dnnl
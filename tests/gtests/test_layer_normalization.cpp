@@ -576,4 +576,156 @@ private:
 TEST_P(lnorm_test, TestsLnormF32) {}
 
 #include "layer_normalization.h"
+
+struct lnorm_fused_test_params {
+    memory::data_type dst_dt;
+    memory::dims dims;
+    bool with_residual;
+    bool with_sum;
+    bool use_global_stats;
+    float dst_scale;
+};
+
+// Layer normalization of src + residual, as in the transformer blocks, with
+// the result scaled and converted to the destination data type
+class lnorm_fused_test
+    : public ::testing::TestWithParam<lnorm_fused_test_params> {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "Fused layer normalization is supported by CPU only");
+        catch_expected_failures([=]() { Test(); }, false, dnnl_success);
+    }
+
+    void Test() {
+        using tag = memory::format_tag;
+        const auto p = GetParam();
+        const memory::dim C = p.dims.back();
+        memory::dim nelems = 1;
+        for (auto d : p.dims)
+            nelems *= d;
+        const memory::dim N = nelems / C;
+        const float epsilon = 1e-5f;
+
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+
+        memory::desc src_md(p.dims, memory::data_type::f32, tag::abc);
+        memory::desc dst_md(p.dims, p.dst_dt, tag::any);
+        memory::desc residual_md = p.with_residual ? src_md : memory::desc();
+        memory::desc sum_md = p.with_sum ? src_md : memory::desc();
+
+        primitive_attr attr;
+        attr.set_output_scales(0, {p.dst_scale});
+
+        const auto flags = normalization_flags::use_scale_shift
+                | (p.use_global_stats ? normalization_flags::use_global_stats
+                                      : normalization_flags::none);
+        auto op_desc = layer_normalization_forward::desc(
+                prop_kind::forward_training, src_md, dst_md, residual_md,
+                sum_md, memory::desc(), epsilon, flags);
+        auto pd = layer_normalization_forward::primitive_desc(
+                op_desc, attr, eng);
+        ASSERT_EQ(pd.residual_desc(), residual_md);
+        ASSERT_EQ(pd.sum_desc(), sum_md);
+        ASSERT_EQ(pd.dst_desc().data_type(), p.dst_dt);
+
+        auto src = memory(src_md, eng);
+        auto residual = memory(src_md, eng);
+        auto sum = memory(src_md, eng);
+        auto dst = memory(pd.dst_desc(), eng);
+        auto weights = memory(pd.weights_desc(), eng);
+        auto mean = memory(pd.mean_desc(), eng);
+        auto variance = memory(pd.variance_desc(), eng);
+        fill_data<float>(nelems, src);
+        fill_data<float>(nelems, residual);
+        fill_data<float>(2 * C, weights);
+
+        // The global statistics are the ones of the source with the residual
+        std::vector<float> x(nelems);
+        {
+            auto src_ptr = map_memory<float>(src);
+            auto residual_ptr = map_memory<float>(residual);
+            for (memory::dim i = 0; i < nelems; ++i)
+                x[i] = src_ptr[i] + (p.with_residual ? residual_ptr[i] : 0.f);
+        }
+        std::vector<float> ref_mean(N, 0.f), ref_var(N, 0.f);
+        for (memory::dim n = 0; n < N; ++n) {
+            for (memory::dim c = 0; c < C; ++c)
+                ref_mean[n] += x[n * C + c];
+            ref_mean[n] /= C;
+            for (memory::dim c = 0; c < C; ++c) {
+                const float d = x[n * C + c] - ref_mean[n];
+                ref_var[n] += d * d;
+            }
+            ref_var[n] /= C;
+        }
+        if (p.use_global_stats) {
+            auto mean_ptr = map_memory<float>(mean);
+            auto variance_ptr = map_memory<float>(variance);
+            for (memory::dim n = 0; n < N; ++n) {
+                mean_ptr[n] = ref_mean[n];
+                variance_ptr[n] = ref_var[n];
+            }
+        }
+
+        layer_normalization_forward(pd).execute(strm,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_SRC_1, residual},
+                        {DNNL_ARG_DST, dst}, {DNNL_ARG_DST_1, sum},
+                        {DNNL_ARG_SCALE_SHIFT, weights}, {DNNL_ARG_MEAN, mean},
+                        {DNNL_ARG_VARIANCE, variance}});
+        strm.wait();
+
+        auto weights_ptr = map_memory<float>(weights);
+        auto sum_ptr = map_memory<float>(sum);
+        auto mean_ptr = map_memory<float>(mean);
+        auto dst_mapped = map_memory<char>(dst);
+        const char *dst_ptr = dst_mapped;
+
+        for (memory::dim n = 0; n < N; ++n) {
+            ASSERT_NEAR(mean_ptr[n], ref_mean[n], 1e-5f * C);
+            const float inv_std = 1.f / sqrtf(ref_var[n] + epsilon);
+            for (memory::dim c = 0; c < C; ++c) {
+                const memory::dim off = n * C + c;
+                if (p.with_sum) {
+                    ASSERT_FLOAT_EQ(sum_ptr[off], x[off]);
+                }
+                const float ref = p.dst_scale
+                        * (weights_ptr[c] * (x[off] - ref_mean[n]) * inv_std
+                                + weights_ptr[C + c]);
+                switch (p.dst_dt) {
+                    case memory::data_type::f32:
+                        ASSERT_NEAR(((const float *)dst_ptr)[off], ref,
+                                1e-4f * std::max(1.f, std::abs(ref)));
+                        break;
+                    case memory::data_type::u8:
+                        ASSERT_NEAR(((const uint8_t *)dst_ptr)[off],
+                                std::min(255.f, std::max(0.f, ref)), 1.f);
+                        break;
+                    case memory::data_type::s8:
+                        ASSERT_NEAR(((const int8_t *)dst_ptr)[off],
+                                std::min(127.f, std::max(-128.f, ref)), 1.f);
+                        break;
+                    default: FAIL() << "unexpected data type";
+                }
+            }
+        }
+    }
+};
+
+TEST_P(lnorm_fused_test, TestsLnorm) {}
+INSTANTIATE_TEST_SUITE_P(TestLnormFused, lnorm_fused_test,
+        ::testing::Values(
+                lnorm_fused_test_params {memory::data_type::f32,
+                        {2, 3, 37}, true, true, false, 1.f},
+                lnorm_fused_test_params {memory::data_type::f32,
+                        {4, 2, 100}, false, false, false, 0.5f},
+                lnorm_fused_test_params {memory::data_type::s8,
+                        {2, 3, 768}, true, true, false, 32.f},
+                lnorm_fused_test_params {memory::data_type::s8,
+                        {2, 5, 64}, true, false, true, 16.f},
+                lnorm_fused_test_params {memory::data_type::u8,
+                        {3, 2, 17}, true, false, false, 50.f},
+                lnorm_fused_test_params {memory::data_type::u8,
+                        {1, 4, 256}, false, false, true, 64.f}));
 } // namespace dnnl
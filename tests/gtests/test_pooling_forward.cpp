@@ -420,6 +420,43 @@ INSTANTIATE_TEST_SUITE_P(TestPoolingForwardAvgS8, pooling_test_s8,
                         EXPAND_SIZES_2D(
                                 16, 64, 32, 32, 16, 16, 3, 3, 0, 0, 2, 2)}));
 
+CPU_INSTANTIATE_TEST_SUITE_P(TestPoolingForwardTrainingS8, pooling_test_s8,
+        ::testing::Values(
+                pool_test_params {prop_kind::forward_training,
+                        algorithm::pooling_max, memory::format_tag::nhwc,
+                        memory::format_tag::nhwc,
+                        EXPAND_SIZES_2D(2, 96, 4, 4, 2, 2, 3, 3, 0, 0, 1, 1)},
+                pool_test_params {prop_kind::forward_training,
+                        algorithm::pooling_max, memory::format_tag::ndhwc,
+                        memory::format_tag::ndhwc,
+                        EXPAND_SIZES_3D(2, 19, 5, 5, 5, 3, 3, 3, 3, 3, 3, 1,
+                                1, 1, 2, 2, 2)},
+                pool_test_params {prop_kind::forward_training,
+                        algorithm::pooling_avg_exclude_padding,
+                        memory::format_tag::nhwc, memory::format_tag::nhwc,
+                        EXPAND_SIZES_2D(2, 4, 4, 4, 4, 4, 3, 3, 1, 1, 1, 1)}));
+
+CPU_INSTANTIATE_TEST_SUITE_P(TestPoolingForwardBlockedS8, pooling_test_s8,
+        ::testing::Values(
+                pool_test_params {prop_kind::forward_inference,
+                        algorithm::pooling_max, memory::format_tag::nChw16c,
+                        memory::format_tag::nChw16c,
+                        EXPAND_SIZES_2D(2, 40, 8, 8, 4, 4, 3, 3, 1, 1, 2, 2)},
+                pool_test_params {prop_kind::forward_inference,
+                        algorithm::pooling_avg_include_padding,
+                        memory::format_tag::nChw16c,
+                        memory::format_tag::nChw16c,
+                        EXPAND_SIZES_2D(2, 40, 8, 8, 4, 4, 3, 3, 1, 1, 2, 2)},
+                pool_test_params {prop_kind::forward_inference,
+                        algorithm::pooling_avg_exclude_padding,
+                        memory::format_tag::nChw8c, memory::format_tag::nChw8c,
+                        EXPAND_SIZES_2D(2, 20, 5, 5, 5, 5, 3, 3, 1, 1, 1, 1)},
+                pool_test_params {prop_kind::forward_inference,
+                        algorithm::pooling_max, memory::format_tag::nCdhw16c,
+                        memory::format_tag::nCdhw16c,
+                        EXPAND_SIZES_3D(2, 32, 5, 5, 5, 3, 3, 3, 3, 3, 3, 1,
+                                1, 1, 2, 2, 2)}));
+
 GPU_INST_TEST_CASE(pooling_test_s8);
 
 TEST_P(pooling_test_u8, TestsPooling) {}
@@ -493,6 +530,29 @@ INSTANTIATE_TEST_SUITE_P(TestPoolingForwardAvgU8, pooling_test_u8,
                         EXPAND_SIZES_2D(
                                 16, 64, 32, 32, 16, 16, 3, 3, 0, 0, 2, 2)}));
 
+CPU_INSTANTIATE_TEST_SUITE_P(TestPoolingForwardTrainingU8, pooling_test_u8,
+        ::testing::Values(
+                pool_test_params {prop_kind::forward_training,
+                        algorithm::pooling_max, memory::format_tag::nhwc,
+                        memory::format_tag::nhwc,
+                        EXPAND_SIZES_2D(2, 64, 1, 1, 1, 1, 3, 3, 1, 1, 1, 1)},
+                pool_test_params {prop_kind::forward_training,
+                        algorithm::pooling_avg_include_padding,
+                        memory::format_tag::nhwc, memory::format_tag::nhwc,
+                        EXPAND_SIZES_2D(2, 35, 1, 9, 1, 5, 1, 3, 0, 1, 1, 2)}));
+
+CPU_INSTANTIATE_TEST_SUITE_P(TestPoolingForwardBlockedU8, pooling_test_u8,
+        ::testing::Values(
+                pool_test_params {prop_kind::forward_inference,
+                        algorithm::pooling_max, memory::format_tag::nChw8c,
+                        memory::format_tag::nChw8c,
+                        EXPAND_SIZES_2D(2, 13, 6, 6, 3, 3, 2, 2, 0, 0, 2, 2)},
+                pool_test_params {prop_kind::forward_inference,
+                        algorithm::pooling_avg_exclude_padding,
+                        memory::format_tag::nChw16c,
+                        memory::format_tag::nChw16c,
+                        EXPAND_SIZES_2D(2, 64, 7, 7, 4, 4, 3, 3, 1, 1, 2, 2)}));
+
 GPU_INST_TEST_CASE(pooling_test_u8);
 
 TEST_P(pooling_test_s32, TestsPooling) {}
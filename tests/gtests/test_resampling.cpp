@@ -408,6 +408,27 @@ INSTANTIATE_TEST_SUITE_P(TestResampleForwardPlainNN, resampling_test_float,
                         EXPAND_SIZES_3D(
                                 5, 5, 5, 10, 15, 10, 5, 7, 2.f, 0.5f, 0.5f)}));
 
+INSTANTIATE_TEST_SUITE_P(TestResamplePlainTails, resampling_test_float,
+        ::testing::Values(
+                resampling_test_params {prop_kind::forward,
+                        algorithm::resampling_linear, memory::format_tag::nhwc,
+                        EXPAND_SIZES_2D(2, 37, 5, 6, 9, 11, 1.8f, 1.84f)},
+                resampling_test_params {prop_kind::forward,
+                        algorithm::resampling_linear, memory::format_tag::nchw,
+                        EXPAND_SIZES_2D(2, 3, 7, 13, 15, 29, 2.15f, 2.24f)},
+                resampling_test_params {prop_kind::forward,
+                        algorithm::resampling_linear, memory::format_tag::ncdhw,
+                        EXPAND_SIZES_3D(2, 4, 3, 5, 17, 4, 9, 35, 1.34f, 1.8f,
+                                2.06f)},
+                resampling_test_params {prop_kind::forward,
+                        algorithm::resampling_nearest,
+                        memory::format_tag::ndhwc,
+                        EXPAND_SIZES_3D(
+                                1, 70, 3, 4, 5, 6, 7, 9, 2.f, 1.75f, 1.8f)},
+                resampling_test_params {prop_kind::forward,
+                        algorithm::resampling_nearest, memory::format_tag::ncw,
+                        EXPAND_SIZES_1D(3, 5, 40, 19, 0.475f)}));
+
 INSTANTIATE_TEST_SUITE_P(TestResampleForwardBlockedNN, resampling_test_float,
         ::testing::Values(
                 resampling_test_params {prop_kind::forward,
@@ -221,7 +221,9 @@ using shuffle_test_u8 = shuffle_test<uint8_t>;
                     shuffle_test_params {prop_kind::forward_training, \
                             memory::format_tag::nchw, {2, 10, 4, 4}, 2, 2}, \
                     shuffle_test_params {prop_kind::forward_training, \
-                            memory::format_tag::nchw, {2, 10, 4, 4}, 1, 5})); \
+                            memory::format_tag::nchw, {2, 10, 4, 4}, 1, 5}, \
+                    shuffle_test_params {prop_kind::forward_training, \
+                            memory::format_tag::nchw, {2, 24, 5, 7}, 1, 3})); \
 \
     INSTANTIATE_TEST_SUITE_P(TestShuffle_NCDHW, test, \
             ::testing::Values( \
@@ -259,7 +261,13 @@ using shuffle_test_u8 = shuffle_test<uint8_t>;
                     shuffle_test_params {prop_kind::forward_training, \
                             memory::format_tag::nhwc, {2, 10, 4, 4}, 1, 2}, \
                     shuffle_test_params {prop_kind::forward_training, \
-                            memory::format_tag::nhwc, {2, 10, 4, 4}, 1, 2})); \
+                            memory::format_tag::nhwc, {2, 10, 4, 4}, 1, 2}, \
+                    shuffle_test_params {prop_kind::forward_training, \
+                            memory::format_tag::nhwc, {2, 36, 3, 5}, 1, 3}, \
+                    shuffle_test_params {prop_kind::forward_training, \
+                            memory::format_tag::nhwc, {2, 36, 3, 5}, 1, 4}, \
+                    shuffle_test_params {prop_kind::forward_training, \
+                            memory::format_tag::nhwc, {1, 48, 7, 7}, 1, 2})); \
 \
     INSTANTIATE_TEST_SUITE_P(TestShuffle_nChw8c, test, \
             ::testing::Values( \
@@ -53,7 +53,11 @@ protected:
         // softmax specific types and values
         using op_desc_t = softmax_forward::desc;
         using pd_t = softmax_forward::primitive_desc;
-        allows_attr_t aa {0}; // doesn't support anything
+        // CPU supports the common scales of the source and the destination
+        const bool is_cpu = get_test_engine_kind() == engine::kind::cpu;
+        allows_attr_t aa {0};
+        aa.scales = is_cpu;
+        aa.fp_scales = is_cpu;
 
         auto eng = get_test_engine();
         auto strm = make_stream(eng);
@@ -231,6 +235,10 @@ INSTANTIATE_TEST_SUITE_P(TestSoftmaxForwardFloat, softmax_forward_test_float,
                         tag::undef, {2, 19, 16, 64}, 1},
                 test_params<float> {prop_kind::forward_training, tag::nchw,
                         tag::undef, {1, 8, 128, 1024}, 3},
+                test_params<float> {prop_kind::forward_training, tag::nchw,
+                        tag::undef, {2, 19, 5, 7}, 1},
+                test_params<float> {prop_kind::forward_training, tag::nchw,
+                        tag::undef, {3, 7, 16, 2}, 1},
                 test_params<float> {prop_kind::forward_inference, tag::nc,
                         tag::undef, {2, 1000}, 0},
                 test_params<float> {prop_kind::forward_inference, tag::nc,
@@ -325,6 +333,10 @@ INSTANTIATE_TEST_SUITE_P(TestSoftmaxBackward, softmax_backward_test_float,
                         tag::nchw, {2, 19, 16, 64}, 1},
                 test_params<float> {prop_kind::backward_data, tag::nhwc,
                         tag::nchw, {1, 8, 128, 1024}, 3},
+                test_params<float> {prop_kind::backward_data, tag::nchw,
+                        tag::nchw, {2, 19, 5, 7}, 1},
+                test_params<float> {prop_kind::backward_data, tag::nchw,
+                        tag::nchw, {3, 7, 16, 2}, 1},
                 test_params<float> {prop_kind::backward_data, tag::cn, tag::nc,
                         {2, 1000}, 0},
                 test_params<float> {prop_kind::backward_data, tag::nc, tag::nc,
@@ -339,4 +351,126 @@ INSTANTIATE_TEST_SUITE_P(TestSoftmaxBackward, softmax_backward_test_float,
                         tag::nChw8c, {64, 1011, 1, 1}, 1},
                 test_params<float> {prop_kind::backward_data, tag::nchw,
                         tag::nChw8c, {2, 1011, 32, 1}, 2}));
+
+struct softmax_fused_test_params {
+    memory::data_type dst_dt;
+    memory::dims dims;
+    bool with_mask;
+    float src_scale;
+    float dst_scale;
+};
+
+// Softmax of scale * src + mask, as in the attention layers, with the result
+// scaled and converted to the destination data type
+class softmax_fused_test
+    : public ::testing::TestWithParam<softmax_fused_test_params> {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "Fused softmax is supported by CPU only");
+        catch_expected_failures([=]() { Test(); }, false, dnnl_success);
+    }
+
+    void Test() {
+        const auto p = GetParam();
+        const int ndims = (int)p.dims.size();
+        const int axis = ndims - 1;
+        const memory::dim axis_size = p.dims[axis];
+        memory::dim nelems = 1;
+        for (auto d : p.dims)
+            nelems *= d;
+        const memory::dim outer_size = nelems / axis_size;
+
+        // The mask is broadcast over all but the first and the last dims
+        memory::dims mask_dims(ndims, 1);
+        mask_dims[0] = p.dims[0];
+        mask_dims[axis] = axis_size;
+
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+
+        memory::desc src_md(p.dims, memory::data_type::f32, tag::nchw);
+        memory::desc dst_md(p.dims, p.dst_dt, tag::any);
+        memory::desc mask_md = p.with_mask
+                ? memory::desc(mask_dims, memory::data_type::f32, tag::nchw)
+                : memory::desc();
+
+        primitive_attr attr;
+        attr.set_scales(DNNL_ARG_SRC, 0, {p.src_scale});
+        attr.set_scales(DNNL_ARG_DST, 0, {p.dst_scale});
+
+        auto op_desc = softmax_forward::desc(
+                prop_kind::forward_inference, src_md, dst_md, axis, mask_md);
+        auto pd = softmax_forward::primitive_desc(op_desc, attr, eng);
+        ASSERT_EQ(pd.mask_desc(), mask_md);
+
+        // The mask memory is not used by the primitive if there is no mask
+        auto src = memory(src_md, eng);
+        auto dst = memory(pd.dst_desc(), eng);
+        auto mask = memory(p.with_mask ? mask_md : src_md, eng);
+        fill_data<float>(nelems, src);
+        fill_data<float>(mask.get_desc().get_size() / sizeof(float), mask);
+
+        softmax_forward(pd).execute(strm,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_SRC_1, mask},
+                        {DNNL_ARG_DST, dst}});
+        strm.wait();
+
+        auto src_ptr = map_memory<float>(src);
+        auto mask_ptr = map_memory<float>(mask);
+        auto dst_mapped = map_memory<char>(dst);
+        const char *dst_ptr = dst_mapped;
+        const memory::dim rows_per_mb = outer_size / p.dims[0];
+
+        std::vector<float> s(axis_size);
+        for (memory::dim ou = 0; ou < outer_size; ++ou) {
+            const memory::dim mb = ou / rows_per_mb;
+            float max = -FLT_MAX;
+            for (memory::dim c = 0; c < axis_size; ++c) {
+                s[c] = p.src_scale * src_ptr[ou * axis_size + c];
+                if (p.with_mask)
+                    s[c] += mask_ptr[mb * axis_size + c];
+                max = std::max(max, s[c]);
+            }
+            float sum = 0;
+            for (memory::dim c = 0; c < axis_size; ++c)
+                sum += expf(s[c] - max);
+            for (memory::dim c = 0; c < axis_size; ++c) {
+                const float ref = p.dst_scale * expf(s[c] - max) / sum;
+                const memory::dim off = ou * axis_size + c;
+                switch (p.dst_dt) {
+                    case memory::data_type::f32:
+                        ASSERT_NEAR(((const float *)dst_ptr)[off], ref,
+                                1e-5f * std::max(1.f, ref));
+                        break;
+                    case memory::data_type::u8:
+                        ASSERT_NEAR(((const uint8_t *)dst_ptr)[off],
+                                std::min(255.f, ref), 1.f);
+                        break;
+                    case memory::data_type::s8:
+                        ASSERT_NEAR(((const int8_t *)dst_ptr)[off],
+                                std::min(127.f, ref), 1.f);
+                        break;
+                    default: FAIL() << "unexpected data type";
+                }
+            }
+        }
+    }
+};
+
+TEST_P(softmax_fused_test, TestsSoftmax) {}
+INSTANTIATE_TEST_SUITE_P(TestSoftmaxFused, softmax_fused_test,
+        ::testing::Values(
+                softmax_fused_test_params {memory::data_type::f32,
+                        {2, 3, 5, 37}, true, 0.125f, 1.f},
+                softmax_fused_test_params {memory::data_type::f32,
+                        {2, 2, 4, 100}, false, 2.f, 0.5f},
+                softmax_fused_test_params {memory::data_type::u8,
+                        {2, 3, 5, 37}, true, 0.125f, 255.f},
+                softmax_fused_test_params {memory::data_type::u8,
+                        {2, 2, 4, 100}, true, 1.f, 500.f},
+                softmax_fused_test_params {memory::data_type::s8,
+                        {2, 2, 4, 100}, false, 0.5f, 127.f},
+                softmax_fused_test_params {memory::data_type::s8,
+                        {1, 4, 2, 16}, true, 1.f, 127.f}));
 } // namespace dnnl